@@ -22,3 +22,5 @@ from ._jsbsim import (
     eTemperature,
     get_default_root_dir,
 )
+from .binary_output import read_binary_header, read_binary_output
+from .columnar_output import ColumnarReader
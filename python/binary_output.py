@@ -0,0 +1,85 @@
+# binary_output.py
+#
+# Reader of the files written by the BINARY output type of JSBSim.
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU Lesser General Public License as published by the Free
+# Software Foundation; either version 2 of the License, or (at your option) any
+# later version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+# details.
+#
+# You should have received a copy of the GNU Lesser General Public License along
+# with this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import struct
+
+import numpy as np
+
+_MAGIC = b'JSBSBIN\0'
+_PREFIX = struct.Struct('<8sIIII')
+
+
+def _read_string(header, pos):
+    (length,) = struct.unpack_from('<H', header, pos)
+    pos += 2
+    return header[pos:pos+length].decode('utf-8'), pos+length
+
+
+def read_binary_header(filename):
+    """Returns the dtype of the records of a JSBSim binary output file and the
+    offset of the first record.
+
+    The fields of the dtype are named after the columns of the file and carry
+    their unit in their metadata (``dtype.fields[name][0].metadata['unit']``).
+    """
+    with open(filename, 'rb') as f:
+        prefix = f.read(_PREFIX.size)
+        if len(prefix) < _PREFIX.size:
+            raise ValueError(f'{filename} is not a JSBSim binary output file')
+        magic, version, header_size, record_size, num_columns = _PREFIX.unpack(prefix)
+        if magic != _MAGIC:
+            raise ValueError(f'{filename} is not a JSBSim binary output file')
+        if version != 1:
+            raise ValueError(f'Unsupported version {version} of the binary format')
+        header = prefix + f.read(header_size - _PREFIX.size)
+
+    fields = []
+    pos = _PREFIX.size
+    for _ in range(num_columns):
+        kind = chr(header[pos])
+        name, pos = _read_string(header, pos+1)
+        unit, pos = _read_string(header, pos)
+        fields.append((name, np.dtype('<'+('f4' if kind == 'f' else 'f8'),
+                                      metadata={'unit': unit})))
+
+    dtype = np.dtype(fields)
+    if dtype.itemsize != record_size:
+        raise ValueError(f'The header of {filename} is corrupted')
+
+    return dtype, header_size
+
+
+def read_binary_output(filename):
+    """Maps a file written by the BINARY output type of JSBSim to a numpy
+    structured array.
+
+    The array is memory mapped in read only mode so the records are only read
+    from the disk when they are accessed. The columns are accessed by their
+    name e.g. ``data['Time']`` or ``data['/fdm/jsbsim/position/h-sl-ft']``.
+    """
+    dtype, offset = read_binary_header(filename)
+    with open(filename, 'rb') as f:
+        f.seek(0, 2)
+        num_records = (f.tell() - offset) // dtype.itemsize
+
+    if num_records == 0:
+        return np.zeros(0, dtype=dtype)
+
+    # A record that is being written is ignored.
+    return np.memmap(filename, dtype=dtype, mode='r', offset=offset,
+                     shape=(num_records,))
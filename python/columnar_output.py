@@ -0,0 +1,235 @@
+# columnar_output.py
+#
+# Reader of the files written by the COLUMNAR output type of JSBSim.
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU Lesser General Public License as published by the Free
+# Software Foundation; either version 2 of the License, or (at your option) any
+# later version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+# details.
+#
+# You should have received a copy of the GNU Lesser General Public License along
+# with this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import mmap
+import struct
+
+import numpy as np
+
+_MAGIC = b'JSBSCOL\0'
+_CHUNK_MAGIC = b'CHNK'
+_INDEX_MAGIC = b'JSBSIDX\0'
+_END_MAGIC = b'JSBSEND\0'
+_PREFIX = struct.Struct('<8sIIII')
+_CHUNK_HEADER = struct.Struct('<4sIdd')
+_INDEX_ENTRY = struct.Struct('<QQdd')
+
+
+def _read_string(header, pos):
+    (length,) = struct.unpack_from('<H', header, pos)
+    pos += 2
+    return bytes(header[pos:pos+length]).decode('utf-8'), pos+length
+
+
+def _decode(data, offset, size, n, encoding):
+    """Decodes a block of n values (see FGColumnarCodec.h for the encodings).
+    The block is decoded with vectorized numpy operations."""
+    if encoding == 'r':
+        if size != 8*n:
+            raise ValueError('Corrupted block')
+        return np.frombuffer(data, '<f8', n, offset).astype(np.float64)
+
+    if size < n:
+        raise ValueError('Corrupted block')
+
+    control = np.frombuffer(data, np.uint8, n, offset)
+    lz = (control >> 4).astype(np.int64)
+    tz = (control & 0x0f).astype(np.int64)
+    lengths = 8 - lz - tz
+    if np.any(lengths < 0):
+        raise ValueError('Corrupted block')
+
+    ends = np.cumsum(lengths)
+    starts = ends - lengths
+    if n > 0 and ends[-1] != size - n:
+        raise ValueError('Corrupted block')
+
+    payload = np.frombuffer(data, np.uint8, size-n, offset+n)
+    words = np.zeros(n, np.uint64)
+    for k in range(8):
+        sel = lengths > k
+        if not np.any(sel):
+            break
+        byte = payload[starts[sel] + k].astype(np.uint64)
+        words[sel] |= byte << (8*(tz[sel]+k)).astype(np.uint64)
+
+    if encoding == 'x':
+        bits = np.bitwise_xor.accumulate(words)
+    else:
+        delta2 = (words >> np.uint64(1)) ^ (np.uint64(0) - (words & np.uint64(1)))
+        bits = np.cumsum(np.cumsum(delta2, dtype=np.uint64), dtype=np.uint64)
+
+    return bits.view(np.float64)
+
+
+class ColumnarReader:
+    """Reads the files written by the COLUMNAR output type of JSBSim.
+
+    The file is memory mapped so that reading a column over a time window only
+    touches the pages of the chunks that overlap the window::
+
+        with jsbsim.ColumnarReader('flight.col') as log:
+            t = log.read('Time', 10.0, 20.0)
+            h = log.read('/fdm/jsbsim/position/h-sl-ft', 10.0, 20.0)
+    """
+
+    def __init__(self, filename):
+        self.filename = filename
+        with open(filename, 'rb') as f:
+            self._data = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+
+        try:
+            header_size = self._read_header()
+            self.indexed = self._read_index(header_size)
+            if not self.indexed:
+                self._scan_chunks(header_size)
+        except Exception:
+            self.close()
+            raise
+
+        self._first = np.array([c[2] for c in self._chunks])
+        self._last = np.array([c[3] for c in self._chunks])
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *args):
+        self.close()
+
+    def close(self):
+        if self._data is not None:
+            self._data.close()
+            self._data = None
+
+    @property
+    def num_records(self):
+        return sum(c[1] for c in self._chunks)
+
+    @property
+    def start_time(self):
+        return self._first[0] if self._chunks else 0.0
+
+    @property
+    def end_time(self):
+        return self._last[-1] if self._chunks else 0.0
+
+    def read(self, column, start=None, end=None):
+        """Returns the values of a column for the records whose time is in the
+        range [start, end]. The column is given by its name or its index."""
+        if isinstance(column, str):
+            column = self.names.index(column)
+        if start is None:
+            start = -np.inf
+        if end is None:
+            end = np.inf
+
+        values = []
+        first = np.searchsorted(self._last, start, 'left')
+        for i in range(first, len(self._chunks)):
+            if self._first[i] > end:
+                break
+            block = self._decode_block(i, column)
+            if self._first[i] < start or self._last[i] > end:
+                time = block if column == 0 else self._decode_block(i, 0)
+                block = block[(time >= start) & (time <= end)]
+            values.append(block)
+
+        if not values:
+            return np.zeros(0)
+        return np.concatenate(values)
+
+    def _read_header(self):
+        data = self._data
+        if len(data) < _PREFIX.size:
+            raise ValueError(f'{self.filename} is not a JSBSim columnar output file')
+        magic, version, num_columns, _, header_size = _PREFIX.unpack_from(data)
+        if magic != _MAGIC:
+            raise ValueError(f'{self.filename} is not a JSBSim columnar output file')
+        if version != 1:
+            raise ValueError(f'Unsupported version {version} of the columnar format')
+
+        self.names = []
+        self.units = []
+        self._encodings = []
+        pos = _PREFIX.size
+        for _ in range(num_columns):
+            self._encodings.append(chr(data[pos]))
+            name, pos = _read_string(data, pos+1)
+            unit, pos = _read_string(data, pos)
+            self.names.append(name)
+            self.units.append(unit)
+
+        if pos > header_size:
+            raise ValueError(f'The header of {self.filename} is corrupted')
+
+        return header_size
+
+    def _read_index(self, header_size):
+        data = self._data
+        size = len(data)
+        if size < header_size + 32 or data[size-8:] != _END_MAGIC:
+            return False
+
+        (index,) = struct.unpack_from('<Q', data, size-16)
+        if index < header_size or index > size - 32 \
+           or data[index:index+8] != _INDEX_MAGIC:
+            return False
+
+        (num_chunks,) = struct.unpack_from('<Q', data, index+8)
+        if index + 16 + num_chunks*_INDEX_ENTRY.size + 16 != size:
+            return False
+
+        self._chunks = [_INDEX_ENTRY.unpack_from(data, index+16+i*_INDEX_ENTRY.size)
+                        for i in range(num_chunks)]
+        return True
+
+    def _scan_chunks(self, header_size):
+        # The chunks of a file that has not been closed are located by scanning
+        # the file. A truncated chunk at the end of the file is ignored.
+        data = self._data
+        table_size = 8*len(self.names)
+        pos = header_size
+        self._chunks = []
+
+        while pos + _CHUNK_HEADER.size + table_size <= len(data):
+            magic, rows, first, last = _CHUNK_HEADER.unpack_from(data, pos)
+            if magic != _CHUNK_MAGIC:
+                break
+            sizes = struct.unpack_from(f'<{len(self.names)}Q', data,
+                                       pos+_CHUNK_HEADER.size)
+            end = pos + _CHUNK_HEADER.size + table_size + sum(sizes)
+            if end > len(data):
+                break
+            self._chunks.append((pos, rows, first, last))
+            pos = end
+
+    def _decode_block(self, chunk, column):
+        offset, rows = self._chunks[chunk][:2]
+        num_columns = len(self.names)
+        magic, n, _, _ = _CHUNK_HEADER.unpack_from(self._data, offset)
+        if magic != _CHUNK_MAGIC or n != rows:
+            raise ValueError(f'The chunk at offset {offset} of {self.filename} is corrupted')
+
+        sizes = struct.unpack_from(f'<{num_columns}Q', self._data,
+                                   offset+_CHUNK_HEADER.size)
+        pos = offset + _CHUNK_HEADER.size + 8*num_columns + sum(sizes[:column])
+        if pos + sizes[column] > len(self._data):
+            raise ValueError(f'The chunk at offset {offset} of {self.filename} is corrupted')
+
+        return _decode(self._data, pos, sizes[column], rows,
+                       self._encodings[column])
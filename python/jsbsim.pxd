@@ -80,6 +80,10 @@ cdef extern from "input_output/FGPropertyManager.h" namespace "JSBSim":
         c_FGPropertyNode* GetNode()
         c_FGPropertyNode* GetNode(const string& path, bool create)
         bool HasNode(const string& path) except +convertJSBSimToPyExc
+        unsigned int GetHandle(const string& path, bool create) except +convertJSBSimToPyExc
+        bool IsValidHandle(unsigned int handle)
+
+    const unsigned int InvalidHandle "JSBSim::FGPropertyManager::InvalidHandle"
 
 cdef extern from "math/FGColumnVector3.h" namespace "JSBSim":
     cdef cppclass c_FGColumnVector3 "JSBSim::FGColumnVector3":
@@ -213,6 +217,13 @@ cdef extern from "FGFDMExec.h" namespace "JSBSim":
         const c_SGPath& GetFullAircraftPath()
         double GetPropertyValue(string property) except +convertJSBSimToPyExc
         void SetPropertyValue(string property, double value) except +convertJSBSimToPyExc
+        unsigned int GetPropertyHandle(string property) except +convertJSBSimToPyExc
+        double GetPropertyValue(unsigned int handle) except +convertJSBSimToPyExc
+        void SetPropertyValue(unsigned int handle, double value) except +convertJSBSimToPyExc
+        void GetPropertyValues(const vector[unsigned int]& handles,
+                               double* values) except +convertJSBSimToPyExc
+        void SetPropertyValues(const vector[unsigned int]& handles,
+                               const double* values) except +convertJSBSimToPyExc
         string GetModelName()
         bool SetOutputDirectives(const c_SGPath& fname) except +convertJSBSimToPyExc
         #void ForceOutput(int idx=0)
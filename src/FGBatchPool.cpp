@@ -0,0 +1,312 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+  Module:       FGBatchPool.cpp
+  Author:       Dawn Aerospace
+  Date started: October 2026
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU Lesser General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option) any
+  later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+
+  You should have received a copy of the GNU Lesser General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc., 59
+  Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+  Further information about the GNU Lesser General Public License can also be
+  found on the world wide web at http://www.gnu.org.
+
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  INCLUDES
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <sstream>
+#include <thread>
+
+#include "FGBatchPool.h"
+#include "FGFDMExec.h"
+#include "input_output/FGXMLFileRead.h"
+#include "input_output/string_utilities.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  CLASS IMPLEMENTATION
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+FGBatchPool::FGBatchPool(const string& rootName, const string& kind)
+  : Kind(kind), NumThreads(0), RootName(rootName), NextTask(0), NumTasks(0)
+{
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGBatchPool::~FGBatchPool()
+{
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGBatchPool::Load(const SGPath& spec)
+{
+  FGXMLFileRead XMLFileRead;
+  Element* document = XMLFileRead.LoadXMLDocument(spec);
+
+  if (!document) {
+    cerr << "File: " << spec << " could not be loaded." << endl;
+    return false;
+  }
+
+  if (document->GetName() != RootName) {
+    cerr << document->ReadFrom() << fgred << "File: " << spec << " is not a <"
+         << RootName << "> specification file." << reset << endl;
+    return false;
+  }
+
+  Axes.clear();
+  Settings.clear();
+
+  try {
+    if (document->HasAttribute("threads"))
+      NumThreads = static_cast<unsigned int>(document->GetAttributeValueAsNumber("threads"));
+
+    Element* element = document->FindElement("script");
+    if (!element || element->GetAttributeValue("file").empty()) {
+      cerr << document->ReadFrom() << fgred << "The " << Kind
+           << " specification must name a script file." << reset << endl;
+      return false;
+    }
+    ScriptName = SGPath::fromUtf8(element->GetAttributeValue("file"));
+
+    return LoadSpecification(document);
+  } catch (const exception& e) {
+    cerr << fgred << "The " << Kind << " specification " << spec
+         << " is invalid: " << e.what() << reset << endl;
+    return false;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGBatchPool::LoadGrid(Element* document)
+{
+  Element* element = document->FindElement("axis");
+  while (element) {
+    Axis axis;
+    axis.property = element->GetAttributeValue("property");
+
+    for (unsigned int i=0; i<element->GetNumDataLines(); ++i) {
+      istringstream line(element->GetDataLine(i));
+      string value;
+      while (line >> value)
+        axis.values.push_back(atof_locale_c(value));
+    }
+
+    if (axis.property.empty() || axis.values.empty()) {
+      cerr << element->ReadFrom() << fgred
+           << "The axis must name a property and give its values." << reset
+           << endl;
+      return false;
+    }
+
+    Axes.push_back(axis);
+    element = document->FindNextElement("axis");
+  }
+
+  if (Axes.empty()) {
+    cerr << document->ReadFrom() << fgred << "The " << Kind
+         << " specification must have at least one axis." << reset << endl;
+    return false;
+  }
+
+  element = document->FindElement("set");
+  while (element) {
+    Setting setting;
+    setting.property = element->GetAttributeValue("name");
+    setting.value = element->GetAttributeValueAsNumber("value");
+
+    if (setting.property.empty()) {
+      cerr << element->ReadFrom() << fgred
+           << "The setting must name a property." << reset << endl;
+      return false;
+    }
+
+    Settings.push_back(setting);
+    element = document->FindNextElement("set");
+  }
+
+  element = document->FindElement("output");
+  if (element) OutputName = element->GetAttributeValue("file");
+  if (OutputName.empty()) {
+    cerr << document->ReadFrom() << fgred << "The " << Kind
+         << " specification must name an output file." << reset << endl;
+    return false;
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+size_t FGBatchPool::GetGridSize(void) const
+{
+  size_t npoints = 1;
+  for (const auto& axis: Axes) npoints *= axis.values.size();
+  return npoints;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+vector<double> FGBatchPool::GetGridCoordinates(size_t point) const
+{
+  vector<double> coordinates(Axes.size());
+
+  for (size_t i=Axes.size(); i>0; --i) {
+    size_t n = Axes[i-1].values.size();
+    coordinates[i-1] = Axes[i-1].values[point % n];
+    point /= n;
+  }
+
+  return coordinates;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGBatchPool::SetGridPoint(FGFDMExec* fdmex, size_t point) const
+{
+  auto pm = fdmex->GetPropertyManager();
+  vector<double> coordinates = GetGridCoordinates(point);
+
+  for (size_t i=0; i<Axes.size(); ++i)
+    pm->GetNode(Axes[i].property)->setDoubleValue(coordinates[i]);
+
+  if (!fdmex->RunIC()) throw BaseException("The initialization failed.");
+
+  for (const auto& setting: Settings)
+    pm->GetNode(setting.property)->setDoubleValue(setting.value);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGBatchPool::LoadTemplate(const vector<string>& properties)
+{
+  DocumentCache = make_shared<FGXMLDocumentCache>();
+
+  Template = make_unique<FGFDMExec>();
+  Template->SetDocumentCache(DocumentCache);
+  Template->SetRootDir(RootDir);
+  Template->SetAircraftPath(SGPath("aircraft"));
+  Template->SetEnginePath(SGPath("engine"));
+  Template->SetSystemsPath(SGPath("systems"));
+
+  if (!Template->LoadScript(ScriptName)) {
+    cerr << fgred << "Script file " << ScriptName
+         << " was not successfully loaded" << reset << endl;
+    ReleaseTemplate();
+    return false;
+  }
+  Template->GetOutput()->Inhibit();
+
+  auto pm = Template->GetPropertyManager();
+  vector<string> names;
+  bool result = true;
+
+  for (const auto& axis: Axes)
+    names.push_back(axis.property);
+  for (const auto& setting: Settings)
+    names.push_back(setting.property);
+  names.insert(names.end(), properties.begin(), properties.end());
+
+  for (const auto& name: names) {
+    if (!pm->GetNode(name)) {
+      cerr << fgred << "The property " << name << " does not exist." << reset
+           << endl;
+      result = false;
+    }
+  }
+
+  if (!result) {
+    ReleaseTemplate();
+    return false;
+  }
+
+  InitialState = Template->SaveSnapshot();
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+unsigned int FGBatchPool::RunTasks(size_t ntasks)
+{
+  unsigned int nthreads = NumThreads;
+  if (nthreads == 0) nthreads = max(thread::hardware_concurrency(), 1u);
+  nthreads = static_cast<unsigned int>(min<size_t>(nthreads, max<size_t>(ntasks, 1)));
+
+  // The instances of the workers are reloaded on this thread since
+  // CachedReload() reads the state of the template.
+  vector<unique_ptr<FGFDMExec>> instances;
+  int saved_debug_lvl = debug_lvl;
+  debug_lvl = 0;
+  for (unsigned int i=0; i<nthreads; ++i) {
+    auto fdmex = Template->CachedReload();
+    if (!fdmex) break;
+    instances.push_back(move(fdmex));
+  }
+  debug_lvl = saved_debug_lvl;
+
+  if (instances.size() < nthreads) {
+    cerr << fgred << "The script " << ScriptName << " could not be reloaded."
+         << reset << endl;
+    return 0;
+  }
+
+  NextTask = 0;
+  NumTasks = ntasks;
+
+  vector<thread> workers;
+  for (auto& fdmex: instances)
+    workers.emplace_back(&FGBatchPool::Worker, this, fdmex.get());
+  for (auto& worker: workers)
+    worker.join();
+
+  return nthreads;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGBatchPool::Worker(FGFDMExec* fdmex)
+{
+  // The debug level is local to the thread.
+  debug_lvl = 0;
+
+  while (true) {
+    size_t task = NextTask++;
+    if (task >= NumTasks) break;
+    RunTask(fdmex, task);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGBatchPool::RestoreInitialState(FGFDMExec* fdmex) const
+{
+  if (!fdmex->RestoreSnapshot(InitialState))
+    throw BaseException("The initial state could not be restored.");
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGBatchPool::ReleaseTemplate(void)
+{
+  Template.reset();
+  DocumentCache.reset();
+  InitialState.clear();
+}
+}
@@ -0,0 +1,197 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+  Header:       FGBatchPool.h
+  Author:       Dawn Aerospace
+  Date started: October 2026
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU Lesser General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option) any
+  later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+
+  You should have received a copy of the GNU Lesser General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc., 59
+  Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+  Further information about the GNU Lesser General Public License can also be
+  found on the world wide web at http://www.gnu.org.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGBATCHPOOL_H
+#define FGBATCHPOOL_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "FGJSBBase.h"
+#include "simgear/misc/sg_path.hxx"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+class Element;
+class FGFDMExec;
+class FGXMLDocumentCache;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Base class of the analyses that run a script many times on a pool of worker
+    threads (see FGBatchRunner, FGEnvelopeLinearization and FGTrimMap).
+
+    The root element of the specification file of an analysis has an optional
+    attribute threads, which defaults to the number of CPUs, and names the
+    script:
+
+    @code
+<trim_map threads="8">
+  <script file="scripts/c1722.xml"/>
+  <axis property="ic/h-sl-ft"> 2000 5000 8000 </axis>
+  <axis property="ic/vt-kts"> 90 105 120 </axis>
+  <set name="propulsion/set-running" value="-1"/>
+  <output file="c172_trim_map.csv"/>
+</trim_map>
+    @endcode
+
+    The analyses over a grid of flight conditions also read its axes, its
+    settings and the name of their output file with LoadGrid(). Each point of
+    the grid sets the properties of the axes to its coordinates (the last axis
+    varies the fastest), runs the initial conditions and applies the settings
+    (see SetGridPoint()).
+
+    The script file name is relative to the root directory. The script and the
+    files it refers to are read once by a template instance of FGFDMExec.
+    Before the worker threads are started, one instance per worker is reloaded
+    from the template on the calling thread (see FGFDMExec::CachedReload()).
+    Each task starts from the initial state of the template (see
+    RestoreInitialState()) so that the results do not depend on the number of
+    threads. The outputs defined by the aircraft and the script are inhibited
+    and the debug level of the worker threads is 0.
+  */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class JSBSIM_API FGBatchPool : public FGJSBBase
+{
+public:
+  /** Constructor.
+      @param rootName the name of the root element of the specification files.
+      @param kind the kind of analysis, used in the error messages. */
+  FGBatchPool(const std::string& rootName, const std::string& kind);
+  virtual ~FGBatchPool();
+
+  /** Sets the root directory where the aircraft, engine, systems and scripts
+      directories reside. */
+  void SetRootDir(const SGPath& rootDir) { RootDir = rootDir; }
+
+  /** Reads the specification of the analysis.
+      @param spec the name of the specification file.
+      @return false if the specification is invalid. */
+  bool Load(const SGPath& spec);
+
+  /** Overrides the number of worker threads of the specification file.
+      @param threads number of threads, or 0 for the number of CPUs. */
+  void SetNumThreads(unsigned int threads) { NumThreads = threads; }
+
+protected:
+  struct Axis {
+    std::string property;
+    std::vector<double> values;
+  };
+
+  struct Setting {
+    std::string property;
+    double value;
+  };
+
+  std::string Kind;
+  SGPath RootDir;
+  SGPath ScriptName;
+  unsigned int NumThreads;
+  std::vector<Axis> Axes;
+  std::vector<Setting> Settings;
+  std::string OutputName;
+  std::unique_ptr<FGFDMExec> Template;
+
+  /** Reads the elements that are specific to the analysis. It is called by
+      Load() once the attribute threads and the script have been read.
+      @param document the root element of the specification.
+      @return false if the specification is invalid.
+      @throw BaseException if an attribute is invalid. */
+  virtual bool LoadSpecification(Element* document) = 0;
+
+  /** Reads the axes, the settings and the output file of a grid.
+      @param document the root element of the specification.
+      @return false if the specification is invalid. */
+  bool LoadGrid(Element* document);
+
+  /// Returns the number of points of the grid.
+  size_t GetGridSize(void) const;
+
+  /// Returns the values of the axes at a point of the grid.
+  std::vector<double> GetGridCoordinates(size_t point) const;
+
+  /** Sets the properties of the axes to the coordinates of a point of the
+      grid, runs the initial conditions and applies the settings.
+      @throw BaseException if the initialization fails. */
+  void SetGridPoint(FGFDMExec* fdmex, size_t point) const;
+
+  /** Loads the script in the template and saves its initial state.
+      @param properties the properties used by the analysis in addition to the
+                        axes and the settings.
+      @return false if the script cannot be loaded or if a property does not
+              exist. */
+  bool LoadTemplate(const std::vector<std::string>& properties);
+
+  /** Runs the tasks on the worker threads (see RunTask()) and returns once
+      they are all completed. LoadTemplate() must have been called.
+      @param ntasks the number of tasks.
+      @return the number of worker threads, or 0 if their instances could not
+              be reloaded from the template. */
+  unsigned int RunTasks(size_t ntasks);
+
+  /** Executes a task. The tasks are started in the order of their index and
+      are shared between the worker threads.
+      @param fdmex the instance of the worker thread.
+      @param task the index of the task. */
+  virtual void RunTask(FGFDMExec* fdmex, size_t task) = 0;
+
+  /** Restores the initial state of the template in the instance of a worker.
+      @throw BaseException if the state cannot be restored. */
+  void RestoreInitialState(FGFDMExec* fdmex) const;
+
+  /// Deletes the template and the cache of its XML documents.
+  void ReleaseTemplate(void);
+
+private:
+  std::string RootName;
+  std::shared_ptr<FGXMLDocumentCache> DocumentCache;
+  std::vector<char> InitialState;
+  std::atomic<size_t> NextTask;
+  size_t NumTasks;
+
+  void Worker(FGFDMExec* fdmex);
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
@@ -0,0 +1,354 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+  Module:       FGBatchRunner.cpp
+  Author:       Dawn Aerospace
+  Date started: October 2026
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU Lesser General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option) any
+  later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+
+  You should have received a copy of the GNU Lesser General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc., 59
+  Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+  Further information about the GNU Lesser General Public License can also be
+  found on the world wide web at http://www.gnu.org.
+
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  INCLUDES
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <chrono>
+#include <limits>
+#include <sstream>
+
+#include "FGBatchRunner.h"
+#include "FGFDMExec.h"
+#include "input_output/FGXMLElement.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  CLASS IMPLEMENTATION
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+FGBatchRunner::FGBatchRunner(void)
+  : FGBatchPool("batch", "batch"), TraceRate(0.0), NumRuns(0), Seed(0),
+    NextResult(0), NumFailedRuns(0)
+{
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGBatchRunner::~FGBatchRunner()
+{
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGBatchRunner::LoadSpecification(Element* document)
+{
+  Dispersions.clear();
+  Summary.clear();
+  Trace.clear();
+
+  NumRuns = static_cast<unsigned int>(document->GetAttributeValueAsNumber("runs"));
+  if (document->HasAttribute("seed"))
+    Seed = static_cast<unsigned int>(document->GetAttributeValueAsNumber("seed"));
+
+  Element* element = document->FindElement("dispersion");
+  while (element) {
+    Dispersion dispersion;
+    string type = element->GetAttributeValue("type");
+    dispersion.property = element->GetAttributeValue("property");
+    dispersion.amplitude = element->GetDataAsNumber();
+
+    if (type == "gaussian")
+      dispersion.type = eGaussian;
+    else if (type == "gaussiansigned")
+      dispersion.type = eGaussianSigned;
+    else if (type == "uniform")
+      dispersion.type = eUniform;
+    else if (type == "uniformsigned")
+      dispersion.type = eUniformSigned;
+    else {
+      cerr << element->ReadFrom() << fgred << "Unknown dispersion type "
+           << type << reset << endl;
+      return false;
+    }
+
+    if (dispersion.property.empty()) {
+      cerr << element->ReadFrom() << fgred
+           << "The dispersion must name a property." << reset << endl;
+      return false;
+    }
+
+    Dispersions.push_back(dispersion);
+    element = document->FindNextElement("dispersion");
+  }
+
+  element = document->FindElement("summary");
+  if (!element || element->GetAttributeValue("file").empty()) {
+    cerr << document->ReadFrom() << fgred
+         << "The batch specification must name a summary file." << reset
+         << endl;
+    return false;
+  }
+  SummaryName = element->GetAttributeValue("file");
+
+  Element* property_element = element->FindElement("property");
+  while (property_element) {
+    SummaryItem item;
+    string function = property_element->GetAttributeValue("function");
+    item.property = property_element->GetDataLine();
+
+    if (function.empty() || function == "final")
+      item.function = eFinal;
+    else if (function == "min")
+      item.function = eMin;
+    else if (function == "max")
+      item.function = eMax;
+    else {
+      cerr << property_element->ReadFrom() << fgred
+           << "Unknown summary function " << function << reset << endl;
+      return false;
+    }
+
+    Summary.push_back(item);
+    property_element = element->FindNextElement("property");
+  }
+
+  TraceName.clear();
+  element = document->FindElement("trace");
+  if (element) {
+    TraceName = element->GetAttributeValue("file");
+    TraceRate = element->GetAttributeValueAsNumber("rate");
+    if (TraceName.empty() || TraceRate <= 0.0) {
+      cerr << element->ReadFrom() << fgred
+           << "The trace must have a file name and a positive rate."
+           << reset << endl;
+      return false;
+    }
+
+    property_element = element->FindElement("property");
+    while (property_element) {
+      Trace.push_back(property_element->GetDataLine());
+      property_element = element->FindNextElement("property");
+    }
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGBatchRunner::Run(void)
+{
+  auto start = chrono::steady_clock::now();
+
+  NumFailedRuns = 0;
+
+  vector<string> properties;
+  for (const auto& dispersion: Dispersions)
+    properties.push_back(dispersion.property);
+  for (const auto& item: Summary)
+    properties.push_back(item.property);
+  properties.insert(properties.end(), Trace.begin(), Trace.end());
+
+  if (!LoadTemplate(properties)) return false;
+
+  SummaryFile.open(SummaryName);
+  if (!SummaryFile.is_open()) {
+    cerr << fgred << "Could not open the summary file " << SummaryName
+         << reset << endl;
+    ReleaseTemplate();
+    return false;
+  }
+
+  SummaryFile << "run,seed";
+  for (const auto& dispersion: Dispersions)
+    SummaryFile << "," << dispersion.property;
+  for (const auto& item: Summary) {
+    const char* function[] = {"final", "min", "max"};
+    SummaryFile << "," << function[item.function] << "(" << item.property
+                << ")";
+  }
+  SummaryFile << ",time,success" << endl;
+
+  NextResult = 0;
+  PendingResults.clear();
+
+  unsigned int nthreads = RunTasks(NumRuns);
+
+  SummaryFile.close();
+  ReleaseTemplate();
+  if (nthreads == 0) return false;
+
+  if (debug_lvl > 0) {
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+    cout << endl << highint << NumRuns << " runs completed ("
+         << NumFailedRuns << " failed) in " << elapsed.count() << " s with "
+         << nthreads << " threads" << reset << endl;
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGBatchRunner::RunTask(FGFDMExec* fdmex, size_t task)
+{
+  unsigned int run = static_cast<unsigned int>(task);
+  string line;
+  bool success = ExecuteRun(fdmex, run, line);
+  WriteResult(run, line, success);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGBatchRunner::ExecuteRun(FGFDMExec* fdmex, unsigned int run,
+                               string& line)
+{
+  const double NaN = numeric_limits<double>::quiet_NaN();
+  unsigned int seed = Seed + run;
+  vector<double> dispersed(Dispersions.size(), NaN);
+  vector<double> summary(Summary.size(), NaN);
+  double time = NaN;
+  bool success = false;
+
+  try {
+    RestoreInitialState(fdmex);
+
+    auto pm = fdmex->GetPropertyManager();
+    RandomNumberGenerator generator(seed);
+    fdmex->SetPropertyValue("simulation/randomseed", seed);
+
+    for (unsigned int i=0; i<Dispersions.size(); ++i) {
+      const Dispersion& dispersion = Dispersions[i];
+      FGPropertyNode* node = pm->GetNode(dispersion.property);
+      double value = node->getDoubleValue();
+      double rn;
+
+      switch(dispersion.type) {
+      case eGaussian:
+        value += dispersion.amplitude*generator.GetNormalRandomNumber();
+        break;
+      case eGaussianSigned:
+        rn = generator.GetNormalRandomNumber();
+        value = (value + dispersion.amplitude*rn)*sign(rn);
+        break;
+      case eUniform:
+        value += dispersion.amplitude*generator.GetUniformRandomNumber();
+        break;
+      case eUniformSigned:
+        rn = generator.GetUniformRandomNumber();
+        value = (value + dispersion.amplitude*rn)*sign(rn);
+        break;
+      }
+
+      node->setDoubleValue(value);
+      dispersed[i] = value;
+    }
+
+    if (!fdmex->RunIC()) throw BaseException("The initialization failed.");
+
+    vector<FGPropertyNode*> summaryNodes, traceNodes;
+    for (const auto& item: Summary)
+      summaryNodes.push_back(pm->GetNode(item.property));
+    for (const auto& name: Trace)
+      traceNodes.push_back(pm->GetNode(name));
+
+    ofstream trace;
+    unsigned int traceFrames = 1;
+    if (!TraceName.empty()) {
+      ostringstream filename;
+      filename << TraceName << "_" << run << ".csv";
+      trace.open(filename.str());
+      if (!trace.is_open())
+        throw BaseException("Could not open the trace file " + filename.str());
+
+      trace.precision(numeric_limits<double>::max_digits10);
+      trace << "Time";
+      for (const auto& name: Trace) trace << "," << name;
+      trace << endl;
+      traceFrames = max(static_cast<unsigned int>(0.5 + 1.0/(fdmex->GetDeltaT()*TraceRate)), 1u);
+    }
+
+    unsigned int frame = 0;
+    do {
+      for (unsigned int i=0; i<Summary.size(); ++i) {
+        double value = summaryNodes[i]->getDoubleValue();
+        switch(Summary[i].function) {
+        case eFinal:
+          summary[i] = value;
+          break;
+        case eMin:
+          if (frame == 0 || value < summary[i]) summary[i] = value;
+          break;
+        case eMax:
+          if (frame == 0 || value > summary[i]) summary[i] = value;
+          break;
+        }
+      }
+
+      if (trace.is_open() && frame % traceFrames == 0) {
+        trace << fdmex->GetSimTime();
+        for (auto node: traceNodes) trace << "," << node->getDoubleValue();
+        trace << "\n";
+      }
+
+      ++frame;
+    } while (fdmex->Run());
+
+    time = fdmex->GetSimTime();
+    success = true;
+  } catch (const exception& e) {
+    cerr << fgred << "Run " << run << " failed: " << e.what() << reset << endl;
+  }
+
+  // The values are written with enough digits to be read back bit for bit.
+  ostringstream buf;
+  buf.precision(numeric_limits<double>::max_digits10);
+  buf << run << "," << seed;
+  auto write = [&buf](double value) {
+    buf << ",";
+    if (!std::isnan(value)) buf << value;
+  };
+  for (double value: dispersed) write(value);
+  for (double value: summary) write(value);
+  write(time);
+  buf << "," << success;
+  line = buf.str();
+
+  return success;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGBatchRunner::WriteResult(unsigned int run, const string& line,
+                                bool success)
+{
+  lock_guard<mutex> lock(ResultsMutex);
+
+  if (!success) NumFailedRuns++;
+  PendingResults[run] = line;
+
+  // The results are written in the order of the runs.
+  auto it = PendingResults.find(NextResult);
+  while (it != PendingResults.end()) {
+    SummaryFile << it->second << "\n";
+    PendingResults.erase(it);
+    it = PendingResults.find(++NextResult);
+  }
+  SummaryFile.flush();
+}
+}
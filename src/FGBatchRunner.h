@@ -0,0 +1,168 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+  Header:       FGBatchRunner.h
+  Author:       Dawn Aerospace
+  Date started: October 2026
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU Lesser General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option) any
+  later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+
+  You should have received a copy of the GNU Lesser General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc., 59
+  Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+  Further information about the GNU Lesser General Public License can also be
+  found on the world wide web at http://www.gnu.org.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGBATCHRUNNER_H
+#define FGBATCHRUNNER_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "FGBatchPool.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+class Element;
+class FGFDMExec;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Runs a script many times with dispersed parameters on a pool of threads.
+
+    The batch is described by a specification file:
+
+    @code
+<batch runs="1000" seed="1" threads="8">
+  <script file="scripts/c1722.xml"/>
+  <dispersion property="ic/vc-kts" type="gaussian"> 5.0 </dispersion>
+  <dispersion property="ic/psi-true-deg" type="uniform"> 10.0 </dispersion>
+  <summary file="takeoff.csv">
+    <property> position/h-agl-ft </property>
+    <property function="max"> velocities/vc-kts </property>
+  </summary>
+  <trace file="takeoff" rate="10">
+    <property> position/h-agl-ft </property>
+    <property> velocities/vc-kts </property>
+  </trace>
+</batch>
+    @endcode
+
+    The script file name is relative to the root directory while the output
+    files are relative to the current directory. The attribute threads is
+    optional and defaults to the number of CPUs.
+
+    The script and the files it refers to (aircraft, engines, systems,
+    initial conditions, ...) are read once by a template instance of FGFDMExec
+    and each run starts from its initial state (see FGBatchPool).
+
+    Each dispersion modifies the value that the property has once the script
+    and the initial conditions are loaded, before RunIC() is called. For a
+    dispersion @e d the value @e x becomes:
+    - gaussian: x + d*N(0,1)
+    - gaussiansigned: (x + d*N(0,1))*sign(N(0,1))
+    - uniform: x + d*U(-1,1)
+    - uniformsigned: (x + d*U(-1,1))*sign(U(-1,1))
+
+    where the random numbers of a given run are drawn from a generator seeded
+    with seed + the index of the run. The same seed is given to the random
+    generator of the FDM (used by the turbulence models for instance) so the
+    results do not depend on the number of threads.
+
+    The summary file has one line per run with the index of the run, its seed,
+    the dispersed values, the final, minimum or maximum value of the summary
+    properties (the attribute function defaults to final), the final
+    simulation time and whether the run succeeded. The lines are written in the
+    order of the runs as soon as the runs complete.
+
+    When a trace is requested, each run writes the properties of the trace at
+    the given rate (in Hz) to the CSV file <file>_<run>.csv.
+  */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class JSBSIM_API FGBatchRunner : public FGBatchPool
+{
+public:
+  FGBatchRunner(void);
+  ~FGBatchRunner();
+
+  /** Overrides the number of runs of the specification file.
+      @param runs number of runs. */
+  void SetNumRuns(unsigned int runs) { NumRuns = runs; }
+  unsigned int GetNumRuns(void) const { return NumRuns; }
+
+  /** Executes the runs.
+      @return false if the script cannot be loaded or if the summary file
+              cannot be written. The failure of individual runs is reported in
+              the summary file and by GetNumFailedRuns(). */
+  bool Run(void);
+
+  /// Returns the number of runs that failed during the last call to Run().
+  unsigned int GetNumFailedRuns(void) const { return NumFailedRuns; }
+
+private:
+  enum eDispersionType {eGaussian, eGaussianSigned, eUniform, eUniformSigned};
+  enum eSummaryFunction {eFinal, eMin, eMax};
+
+  struct Dispersion {
+    std::string property;
+    eDispersionType type;
+    double amplitude;
+  };
+
+  struct SummaryItem {
+    std::string property;
+    eSummaryFunction function;
+  };
+
+  std::string SummaryName;
+  std::string TraceName;
+  double TraceRate;
+  unsigned int NumRuns;
+  unsigned int Seed;
+  std::vector<Dispersion> Dispersions;
+  std::vector<SummaryItem> Summary;
+  std::vector<std::string> Trace;
+
+  std::mutex ResultsMutex;
+  std::ofstream SummaryFile;
+  std::map<unsigned int, std::string> PendingResults;
+  unsigned int NextResult;
+  unsigned int NumFailedRuns;
+
+  bool LoadSpecification(Element* document) override;
+  void RunTask(FGFDMExec* fdmex, size_t task) override;
+  bool ExecuteRun(FGFDMExec* fdmex, unsigned int run, std::string& line);
+  void WriteResult(unsigned int run, const std::string& line, bool success);
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
@@ -45,6 +45,7 @@ INCLUDES
 #include <iomanip>
 
 #include "FGFDMExec.h"
+#include "FGAllocationCounter.h"
 #include "models/atmosphere/FGStandardAtmosphere.h"
 #include "models/atmosphere/FGWinds.h"
 #include "models/FGFCS.h"
@@ -59,8 +60,11 @@ INCLUDES
 #include "models/FGAuxiliary.h"
 #include "models/FGInput.h"
 #include "initialization/FGTrim.h"
+#include "initialization/FGSimplexTrim.h"
+#include "initialization/FGLinearization.h"
 #include "input_output/FGScript.h"
 #include "input_output/FGXMLFileRead.h"
+#include "input_output/FGSnapshot.h"
 #include "initialization/FGInitialCondition.h"
 
 using namespace std;
@@ -76,7 +80,7 @@ CLASS IMPLEMENTATION
 
 FGFDMExec::FGFDMExec(FGPropertyManager* root, std::shared_ptr<unsigned int> fdmctr)
   : RandomSeed(0), RandomGenerator(make_shared<RandomNumberGenerator>(RandomSeed)),
-    FDMctr(fdmctr)
+    FDMctr(fdmctr), SharedExpressions(make_shared<FGSharedExpressions>())
 {
   Frame           = 0;
   disperse        = 0;
@@ -93,6 +97,8 @@ FGFDMExec::FGFDMExec(FGPropertyManager* root, std::shared_ptr<unsigned int> fdmc
   TimeStepsUntilHold = -1;
 
   sim_time = 0.0;
+  ScriptDeltaT = 0.0;
+  AddModelToPath = true;
   dT = 1.0/120.0; // a default timestep size. This is needed for when JSBSim is
                   // run in standalone mode with no initialization file.
 
@@ -153,10 +159,13 @@ FGFDMExec::FGFDMExec(FGPropertyManager* root, std::shared_ptr<unsigned int> fdmc
   trim_status = false;
   ta_mode     = 99;
   trim_completed = 0;
+  trim_solver = JSBSim::tAxisByAxis;
 
   Constructing = true;
   typedef int (FGFDMExec::*iPMF)(void) const;
   instance->Tie("simulation/do_simple_trim", this, (iPMF)0, &FGFDMExec::DoTrim);
+  instance->Tie("simulation/do_simplex_trim", this, (iPMF)0, &FGFDMExec::DoSimplexTrim);
+  instance->Tie("simulation/do_linearization", this, (iPMF)0, &FGFDMExec::DoLinearization);
   instance->Tie("simulation/reset", this, (iPMF)0, &FGFDMExec::ResetToInitialConditions);
   instance->Tie("simulation/disperse", this, &FGFDMExec::GetDisperse);
   instance->Tie("simulation/randomseed", this, (iPMF)&FGFDMExec::SRand, &FGFDMExec::SRand);
@@ -167,6 +176,7 @@ FGFDMExec::FGFDMExec(FGPropertyManager* root, std::shared_ptr<unsigned int> fdmc
   instance->Tie("simulation/jsbsim-debug", this, &FGFDMExec::GetDebugLevel, &FGFDMExec::SetDebugLevel);
   instance->Tie("simulation/frame", (int *)&Frame);
   instance->Tie("simulation/trim-completed", (int *)&trim_completed);
+  instance->Tie("simulation/trim-solver", (int *)&trim_solver);
   instance->Tie("forces/hold-down", this, &FGFDMExec::GetHoldDown, &FGFDMExec::SetHoldDown);
 
   Constructing = false;
@@ -412,6 +422,9 @@ bool FGFDMExec::DeAllocate(void)
 bool FGFDMExec::Run(void)
 {
   bool success=true;
+  unsigned long count = 0;
+
+  if (CountAllocations) count = FGAllocationCounter::GetCount();
 
   Debug(2);
 
@@ -427,9 +440,17 @@ bool FGFDMExec::Run(void)
 
   for (unsigned int i = 0; i < Models.size(); i++) {
     LoadInputs(i);
-    Models[i]->Run(holding);
+    if (CountAllocations) {
+      unsigned long model_count = FGAllocationCounter::GetCount();
+      Models[i]->Run(holding);
+      ModelAllocations[i] = FGAllocationCounter::GetCount() - model_count;
+    }
+    else
+      Models[i]->Run(holding);
   }
 
+  if (CountAllocations) Allocations = FGAllocationCounter::GetCount() - count;
+
   if (Terminate) success = false;
 
   return success;
@@ -706,6 +727,160 @@ void FGFDMExec::ResetToInitialConditions(int mode)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+// The snapshots start with a signature and a format version. The version must
+// be incremented whenever the layout of the state saved by a class changes.
+static const unsigned int SnapshotSignature = 0x4A534253; // "JSBS"
+static const unsigned int SnapshotVersion = 3;
+
+vector<char> FGFDMExec::SaveSnapshot(void)
+{
+  FGSnapshot snapshot;
+  unsigned int signature = SnapshotSignature;
+  unsigned int version = SnapshotVersion;
+
+  snapshot.Sync(signature);
+  snapshot.Sync(version);
+  SyncState(snapshot);
+
+  return snapshot.GetData();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGFDMExec::RestoreSnapshot(const vector<char>& blob)
+{
+  FGSnapshot snapshot(blob.data(), blob.size());
+
+  try {
+    unsigned int signature = 0, version = 0;
+    snapshot.Sync(signature);
+    snapshot.Sync(version);
+    if (signature != SnapshotSignature || version != SnapshotVersion)
+      throw BaseException("The data is not a snapshot of this version of JSBSim.");
+
+    SyncState(snapshot);
+
+    if (!snapshot.AtEnd())
+      throw BaseException("The snapshot was not saved from the same model.");
+  }
+  catch (const BaseException& e) {
+    cerr << fgred << "Failed to restore the snapshot: " << e.what() << reset
+         << endl;
+    return false;
+  }
+
+  // The values of the shared sub-expressions may have been computed before
+  // the state was restored.
+  SharedExpressions->Invalidate();
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+// Creates in the property tree of a reloaded instance the nodes that were added to the tree
+// of the original instance after its model was loaded, so that both trees have
+// the same structure when the snapshot is restored.
+static void AddMissingNodes(SGPropertyNode* from, SGPropertyNode* to)
+{
+  for (int i=0; i<from->nChildren(); ++i) {
+    SGPropertyNode* child = from->getChild(i);
+    AddMissingNodes(child, to->getChild(child->getNameString(),
+                                        child->getIndex(), true));
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+unique_ptr<FGFDMExec> FGFDMExec::CachedReload(void)
+{
+  if (IsChild) {
+    cerr << fgred << "A child FDM cannot be reloaded." << reset << endl;
+    return nullptr;
+  }
+
+  if (!DocumentCache) DocumentCache = make_shared<FGXMLDocumentCache>();
+
+  auto copy = make_unique<FGFDMExec>();
+  copy->SetDocumentCache(DocumentCache);
+  copy->RootDir = RootDir;
+  copy->AircraftPath = AircraftPath;
+  copy->EnginePath = EnginePath;
+  copy->SystemsPath = SystemsPath;
+  copy->OutputPath = OutputPath;
+
+  bool result = true;
+  if (Script)
+    result = copy->LoadScript(ScriptFile, ScriptDeltaT, ScriptInitFile);
+  else if (modelLoaded)
+    result = copy->LoadModel(modelName, AddModelToPath);
+
+  if (!result) {
+    cerr << fgred << "The copy of the model " << modelName
+         << " could not be loaded." << reset << endl;
+    return nullptr;
+  }
+
+  copy->Output->Inhibit();
+  AddMissingNodes(Root, copy->Root);
+
+  if (!copy->RestoreSnapshot(SaveSnapshot())) return nullptr;
+
+  return copy;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFDMExec::SyncState(FGSnapshot& snapshot)
+{
+  string name = modelName;
+  snapshot.Sync(name);
+  if (name != modelName)
+    throw BaseException("The snapshot was saved from the model " + name + ".");
+
+  snapshot.Sync(Frame);
+  snapshot.Sync(Terminate);
+  snapshot.Sync(dT);
+  snapshot.Sync(saved_dT);
+  snapshot.Sync(sim_time);
+  snapshot.Sync(holding);
+  snapshot.Sync(IncrementThenHolding);
+  snapshot.Sync(TimeStepsUntilHold);
+  snapshot.Sync(trim_status);
+  snapshot.Sync(trim_completed);
+  snapshot.Sync(ta_mode);
+  snapshot.Sync(trim_solver);
+  snapshot.Sync(HoldDown);
+  snapshot.Sync(RandomSeed);
+  RandomGenerator->SyncState(snapshot);
+
+  snapshot.Check(RandomGenerators.size());
+  for (auto& generator: RandomGenerators)
+    generator->SyncState(snapshot);
+
+  snapshot.Check(Models.size());
+  for (auto& model: Models)
+    model->SyncState(snapshot);
+
+  IC->SyncState(snapshot);
+
+  snapshot.Check(Script != nullptr);
+  if (Script) Script->SyncState(snapshot);
+
+  snapshot.Check(ChildFDMList.size());
+  for (auto& child: ChildFDMList) {
+    snapshot.Sync(child->mated);
+    snapshot.Sync(child->Loc);
+    snapshot.Sync(child->Orient);
+    child->exec->SyncState(snapshot);
+  }
+
+  // The child FDMs share the property tree of their parent.
+  if (!IsChild) snapshot.SyncProperties(Root);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGFDMExec::SetHoldDown(bool hd)
 {
   HoldDown = hd;
@@ -735,6 +910,10 @@ vector <string> FGFDMExec::EnumerateFDMs(void)
 bool FGFDMExec::LoadScript(const SGPath& script, double deltaT,
                            const SGPath& initfile)
 {
+  ScriptFile = script;
+  ScriptDeltaT = deltaT;
+  ScriptInitFile = initfile;
+
   Script = std::make_shared<FGScript>(this);
   return Script->LoadScript(GetFullPath(script), deltaT, initfile);
 }
@@ -760,6 +939,7 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
   bool result = false; // initialize result to false, indicating input file not yet read
 
   modelName = model; // Set the class modelName attribute
+  AddModelToPath = addModelToPath;
 
   if( AircraftPath.isNull() || EnginePath.isNull() || SystemsPath.isNull()) {
     cerr << "Error: attempted to load aircraft with undefined "
@@ -777,7 +957,7 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
   }
 
   int saved_debug_lvl = debug_lvl;
-  FGXMLFileRead XMLFileRead;
+  FGXMLFileRead XMLFileRead(DocumentCache);
   Element *document = XMLFileRead.LoadXMLDocument(aircraftCfgFileName); // "document" is a class member
 
   if (document) {
@@ -965,6 +1145,10 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
       }
     }
 
+    // Now that all the functions have been loaded, evaluate the sub-expressions
+    // that they have in common only once.
+    SharedExpressions->Share();
+
     // Since all vehicle characteristics have been loaded, place the values in the Inputs
     // structure for the FGModel-derived classes.
     LoadModelConstants();
@@ -1160,6 +1344,7 @@ bool FGFDMExec::ReadChild(Element* el)
   auto pm = std::make_unique<FGPropertyManager>(Root);
   child->exec = std::make_unique<FGFDMExec>(pm.get(), FDMctr);
   child->exec->SetChild(true);
+  child->exec->SetDocumentCache(DocumentCache);
 
   string childAircraft = el->GetAttributeValue("name");
   string sMated = el->GetAttributeValue("mated");
@@ -1235,7 +1420,11 @@ void FGFDMExec::DoTrim(int mode)
   if (mode < 0 || mode > JSBSim::tNone)
     throw("Illegal trimming mode!");
 
+  if (trim_solver < 0 || trim_solver > JSBSim::tNewton)
+    throw("Illegal trim solver!");
+
   FGTrim trim(this, (JSBSim::TrimMode)mode);
+  trim.SetSolver((JSBSim::TrimSolver)trim_solver);
   bool success = trim.DoTrim();
 
   if (debug_lvl > 0)
@@ -1249,6 +1438,33 @@ void FGFDMExec::DoTrim(int mode)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGFDMExec::DoSimplexTrim(int mode)
+{
+  if (Constructing) return;
+
+  if (mode < 0 || mode > JSBSim::tNone)
+    throw("Illegal trimming mode!");
+
+  FGSimplexTrim trim(this, (JSBSim::TrimMode)mode);
+
+  if (!trim.GetSuccess())
+    throw TrimFailureException("Trim Failed");
+
+  trim_completed = 1;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFDMExec::DoLinearization(int)
+{
+  if (Constructing) return;
+
+  FGLinearization lin(this);
+  lin.WriteScicoslab();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGFDMExec::SRand(int sr)
 {
   RandomSeed = sr;
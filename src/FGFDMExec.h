@@ -46,6 +46,7 @@ INCLUDES
 #include "models/FGPropagate.h"
 #include "models/FGOutput.h"
 #include "math/FGTemplateFunc.h"
+#include "math/FGSharedExpressions.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
@@ -69,6 +70,7 @@ class FGInertial;
 class FGInput;
 class FGPropulsion;
 class FGMassBalance;
+class FGXMLDocumentCache;
 
 class TrimFailureException : public BaseException {
   public:
@@ -171,6 +173,13 @@ CLASS DOCUMENTATION
                                 tCustom (4), tTurn (5). Setting this to a legal value
                                 (such as by a script) causes a trim to be performed. This
                                 property actually maps toa function call of DoTrim().
+    @property simulation/do_simplex_trim (write only) Same as simulation/do_simple_trim
+                                but maps to DoSimplexTrim().
+    @property simulation/do_linearization (write only) Setting this to any value maps to
+                                a function call of DoLinearization().
+    @property simulation/trim-solver Selects the algorithm used by the trims: the
+                                integer equivalent to tAxisByAxis (0, the default) or
+                                tNewton (1).
 
     @author Jon S. Berndt
     @version $Revision: 1.106 $
@@ -406,6 +415,48 @@ public:
   void SetPropertyValue(const std::string& property, double value)
   { instance->GetNode()->SetDouble(property, value); }
 
+  /** Retrieves a handle to a property. Properties that are accessed
+      repeatedly should be read and written through their handle which avoids
+      parsing the property name and walking the property tree at each access.
+      @param property the name of the property
+      @result the handle of the property or FGPropertyManager::InvalidHandle
+              if the property does not exist
+      @see FGPropertyManager::GetHandle */
+  FGPropertyManager::PropertyHandle GetPropertyHandle(const std::string& property)
+  { return instance->GetHandle(property); }
+
+  /** Retrieves the value of a property from its handle.
+      @param handle the handle of the property (see GetPropertyHandle())
+      @result the value of the property
+      @throw BaseException if the handle is invalid */
+  double GetPropertyValue(FGPropertyManager::PropertyHandle handle) const
+  { return instance->GetDouble(handle); }
+
+  /** Sets a property value from its handle.
+      @param handle the handle of the property (see GetPropertyHandle())
+      @param value the value to set the property to
+      @throw BaseException if the handle is invalid */
+  void SetPropertyValue(FGPropertyManager::PropertyHandle handle, double value)
+  { instance->SetDouble(handle, value); }
+
+  /** Retrieves the values of several properties from their handles.
+      @param handles the handles of the properties
+      @param values an array that receives the values of the properties, in
+                    the same order as handles
+      @throw BaseException if one of the handles is invalid */
+  void GetPropertyValues(const std::vector<FGPropertyManager::PropertyHandle>& handles,
+                         double* values) const
+  { instance->GetDoubles(handles.data(), values, handles.size()); }
+
+  /** Sets the values of several properties from their handles.
+      @param handles the handles of the properties
+      @param values the values to set the properties to, in the same order as
+                    handles
+      @throw BaseException if one of the handles is invalid */
+  void SetPropertyValues(const std::vector<FGPropertyManager::PropertyHandle>& handles,
+                         const double* values)
+  { instance->SetDoubles(handles.data(), values, handles.size()); }
+
   /// Returns the model name.
   const std::string& GetModelName(void) const { return modelName; }
 
@@ -467,6 +518,16 @@ public:
   * - tNone  */
   void DoTrim(int mode);
 
+  /** Executes a trim with the simplex method of FGSimplexTrim. All the
+  *   controls are adjusted at once whatever the mode, see FGSimplexTrim.
+  *   @param mode the same values as DoTrim() */
+  void DoSimplexTrim(int mode);
+
+  /** Linearizes the model about its current state and writes the state space
+  *   model to the Scicoslab file <aircraft>_lin.sce in the current directory.
+  *   The argument is ignored. */
+  void DoLinearization(int);
+
   /// Disables data logging to all outputs.
   void DisableOutput(void) { Output->Disable(); }
   /// Enables data logging to all outputs.
@@ -492,7 +553,41 @@ public:
       surface deflections which would've been reset.
       @param mode Sets the reset mode.*/
   void ResetToInitialConditions(int mode);
-  /// Sets the debug level.
+  /** Saves the state of the simulation in a binary blob. The blob holds the
+      state of the integrators, of the models and of their components (flight
+      control, engines, tanks, gears, turbulence, ...), of the random
+      generators, of the script events and of the initial conditions, as well
+      as the value of the properties that are not tied. The blob can be restored by the same build
+      of JSBSim in any instance that has loaded the same model and script.
+      The output files are not part of the snapshot.
+      @return the blob */
+  std::vector<char> SaveSnapshot(void);
+  /** Restores the state of the simulation from a blob that was returned by
+      SaveSnapshot(). The models are not reloaded: the state variables are
+      overwritten in place and the simulation can be resumed by calling Run().
+      @param blob the snapshot to restore
+      @return false if the blob was not saved from the same model in which
+              case the state of the simulation is undefined. */
+  bool RestoreSnapshot(const std::vector<char>& blob);
+  /** Creates an independent instance, with its own property tree, that
+      reloads the model and the script of this instance and is then brought to
+      its state (see SaveSnapshot()). The XML files are not read nor parsed
+      again: the new instance loads the documents kept by the document cache
+      (see SetDocumentCache()). If this instance has no cache, one is created
+      and it is filled by the first reload. The models are still built and
+      bound to their properties, so a reload costs almost as much as a load
+      from a warm cache: this is not a copy of the models of this instance.
+      The outputs of the new instance are inhibited since they would write to
+      the same files and sockets as this instance.
+      CachedReload() reads the whole state of this instance (see
+      SaveSnapshot()): it must not be called while this instance is run or
+      reloaded by another thread. The instances used by concurrent threads are
+      therefore reloaded one after the other (see FGBatchPool).
+      @return the new instance, or nullptr if it could not be built. */
+  std::unique_ptr<FGFDMExec> CachedReload(void);
+  /** Sets the debug level.
+      The debug level is shared by the instances that run in the calling
+      thread. */
   void SetDebugLevel(int level) {debug_lvl = level;}
 
   struct PropertyCatalogStructure {
@@ -529,6 +624,10 @@ public:
   bool GetTrimStatus(void) const { return trim_status; }
   void SetTrimMode(int mode){ ta_mode = mode; }
   int GetTrimMode(void) const { return ta_mode; }
+  /** Selects the algorithm used by DoTrim().
+      @param solver the integer equivalent to tAxisByAxis or tNewton */
+  void SetTrimSolver(int solver){ trim_solver = solver; }
+  int GetTrimSolver(void) const { return trim_solver; }
 
   std::string GetPropulsionTankReport() const;
 
@@ -612,6 +711,38 @@ public:
 
   auto GetRandomGenerator(void) const { return RandomGenerator; }
 
+  /** Registers a random generator that is owned by a component so that its
+      state is saved in the snapshots (see SaveSnapshot()). */
+  void AddRandomGenerator(std::shared_ptr<RandomNumberGenerator> generator) {
+    RandomGenerators.push_back(generator);
+  }
+
+  /// Returns the registry of the sub-expressions shared between functions.
+  auto GetSharedExpressions(void) const { return SharedExpressions; }
+
+  /** Sets the cache of the XML documents read by this instance and its child
+      FDMs. The instances that share a cache parse each file only once.
+      @param cache the cache, or nullptr to always read the files. */
+  void SetDocumentCache(std::shared_ptr<FGXMLDocumentCache> cache) {
+    DocumentCache = cache;
+  }
+  /// Returns the cache of the XML documents read by this instance.
+  auto GetDocumentCache(void) const { return DocumentCache; }
+
+  /** Enables or disables the counting of the heap allocations made during
+      Run(). The allocations are only counted if the program hooks the global
+      operator new (see FGAllocationCounter).
+      @param count true to enable the counting. */
+  void SetCountAllocations(bool count) { CountAllocations = count; }
+  /** Returns the number of heap allocations made by the last call to Run(),
+      including the ones made by the script and by the child FDMs. */
+  unsigned long GetAllocations(void) const { return Allocations; }
+  /** Returns the number of heap allocations made by a model during the last
+      call to Run().
+      @param idx the index of the model (see eModels) */
+  unsigned long GetModelAllocations(unsigned int idx) const
+  { return idx < eNumStandardModels ? ModelAllocations[idx] : 0; }
+
 protected:
   unsigned int Frame;
   unsigned int IdFDM;
@@ -636,6 +767,12 @@ protected:
   std::string Release;
   SGPath RootDir;
 
+  // Arguments of the last call to LoadScript() and LoadModel() (see CachedReload())
+  SGPath ScriptFile;
+  double ScriptDeltaT;
+  SGPath ScriptInitFile;
+  bool AddModelToPath;
+
   // Standard Model pointers - shortcuts for internal executive use only.
   // DO NOT TRY TO DELETE THEM !!!
   FGPropagate* Propagate;
@@ -658,6 +795,7 @@ protected:
   bool trim_status;
   int ta_mode;
   int trim_completed;
+  int trim_solver;
 
   std::shared_ptr<FGInitialCondition> IC;
   std::shared_ptr<FGScript>           Script;
@@ -670,6 +808,7 @@ protected:
 
   unsigned int RandomSeed;
   std::shared_ptr<RandomNumberGenerator> RandomGenerator;
+  std::vector<std::shared_ptr<RandomNumberGenerator>> RandomGenerators;
 
   // The FDM counter is used to give each child FDM an unique ID. The root FDM
   // has the ID 0
@@ -679,6 +818,11 @@ protected:
   std::vector <std::shared_ptr<childData>> ChildFDMList;
   std::vector <std::shared_ptr<FGModel>> Models;
   std::map<std::string, FGTemplateFunc_ptr> TemplateFunctions;
+  std::shared_ptr<FGSharedExpressions> SharedExpressions;
+  std::shared_ptr<FGXMLDocumentCache> DocumentCache;
+  bool CountAllocations = false;
+  unsigned long Allocations = 0;
+  unsigned long ModelAllocations[eNumStandardModels] = {};
 
   bool ReadFileHeader(Element*);
   bool ReadChild(Element*);
@@ -691,6 +835,7 @@ protected:
   bool Allocate(void);
   bool DeAllocate(void);
   void InitializeModels(void);
+  void SyncState(FGSnapshot& snapshot);
   int GetDisperse(void) const {return disperse;}
   SGPath GetFullPath(const SGPath& name) {
     if (name.isRelative())
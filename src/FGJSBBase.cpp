@@ -37,8 +37,11 @@ INCLUDES
 
 #define BASE
 
+#include <sstream>
+
 #include "FGJSBBase.h"
 #include "models/FGAtmosphere.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -77,7 +80,50 @@ CLASS IMPLEMENTATION
 const string FGJSBBase::needed_cfg_version = "2.0";
 const string FGJSBBase::JSBSim_version = JSBSIM_VERSION " " __DATE__ " " __TIME__ ;
 
-short FGJSBBase::debug_lvl  = 1;
+FGDebugLevel FGJSBBase::debug_lvl;
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+short& FGDebugLevel::Get(void)
+{
+  static thread_local short level = 1;
+  return level;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+// The state of the standard library generator and distributions is only
+// accessible through their stream operators.
+
+void RandomNumberGenerator::SyncState(FGSnapshot& snapshot)
+{
+  string state;
+
+  if (snapshot.IsSaving()) {
+    ostringstream out;
+    out << generator << ' ' << uniform_random << ' ' << normal_random;
+    state = out.str();
+  }
+
+  snapshot.Sync(state);
+
+  if (!snapshot.IsSaving()) {
+    istringstream in(state);
+    in >> generator >> uniform_random >> normal_random;
+    if (in.fail())
+      throw BaseException("The state of a random generator is corrupted.");
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGJSBBase::Filter::SyncState(FGSnapshot& snapshot)
+{
+  snapshot.Sync(prev_in);
+  snapshot.Sync(prev_out);
+  snapshot.Sync(ca);
+  snapshot.Sync(cb);
+}
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
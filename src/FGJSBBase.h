@@ -59,6 +59,8 @@ FORWARD DECLARATIONS
 
 namespace JSBSim {
 
+class FGSnapshot;
+
 class JSBSIM_API BaseException : public std::runtime_error {
   public:
     BaseException(const std::string& msg) : std::runtime_error(msg) {}
@@ -95,12 +97,30 @@ class JSBSIM_API RandomNumberGenerator {
     /** Get a random number which probability of occurrence is following Gauss
      * normal distribution with a mean of 0.0 and a standard deviation of 1.0 */
     double GetNormalRandomNumber(void) { return normal_random(generator); }
+    /** Saves or restores the state of the generator and of its
+     * distributions (see FGFDMExec::SaveSnapshot). */
+    void SyncState(FGSnapshot& snapshot);
   private:
     std::default_random_engine generator;
     std::uniform_real_distribution<double> uniform_random;
     std::normal_distribution<double> normal_random;
 };
 
+/** Debug level of the console messages.
+ * The level is stored per thread so that the FGFDMExec instances that run
+ * concurrently in different threads do not interfere when one of them changes
+ * it (JSBSim silences the messages temporarily while loading a script or a
+ * child FDM). Each thread starts with the level 1.
+ */
+class JSBSIM_API FGDebugLevel {
+public:
+  operator short() const { return Get(); }
+  FGDebugLevel& operator=(short level) { Get() = level; return *this; }
+
+private:
+  static short& Get(void);
+};
+
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
@@ -143,6 +163,8 @@ public:
       prev_out = out;
       return out;
     }
+    /// Saves or restores the state of the filter.
+    void SyncState(FGSnapshot& snapshot);
   };
 
   ///@name JSBSim console output highlighting terms.
@@ -175,10 +197,12 @@ public:
   *   @return The version number of JSBSim. */
   static const std::string& GetVersion(void) {return JSBSim_version;}
 
-  /// Disables highlighting in the console output.
+  /** Disables highlighting in the console output.
+      The highlighting terms are shared by the whole process so this method
+      should be called before instances of FGFDMExec are run concurrently. */
   void disableHighLighting(void);
 
-  static short debug_lvl;
+  static FGDebugLevel debug_lvl;
 
   /** Converts from degrees Kelvin to degrees Fahrenheit.
   *   @param kelvin The temperature in degrees Kelvin.
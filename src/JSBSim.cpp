@@ -42,6 +42,9 @@ INCLUDES
 #include "initialization/FGTrim.h"
 #include "initialization/FGInitialCondition.h"
 #include "FGFDMExec.h"
+#include "FGBatchRunner.h"
+#include "initialization/FGEnvelopeLinearization.h"
+#include "initialization/FGTrimMap.h"
 #include "input_output/FGXMLFileRead.h"
 
 #if !defined(__GNUC__) && !defined(sgi) && !defined(_MSC_VER)
@@ -68,8 +71,18 @@ INCLUDES
 #  include <sys/time.h>
 #endif
 
+#ifdef __linux__
+#  include <sched.h>
+#  include <errno.h>
+#else
+#  include <chrono>
+#  include <thread>
+#endif
+
 #include <iostream>
 #include <cstdlib>
+#include <cstring>
+#include <cmath>
 
 using namespace std;
 using JSBSim::FGXMLFileRead;
@@ -81,6 +94,9 @@ GLOBAL DATA
 
 SGPath RootDir;
 SGPath ScriptName;
+SGPath BatchName;
+SGPath EnvelopeName;
+SGPath TrimMapName;
 string AircraftName;
 SGPath ResetName;
 vector <string> LogOutputName;
@@ -91,6 +107,7 @@ JSBSim::FGFDMExec* FDMExec;
 JSBSim::FGTrim* trimmer;
 
 bool realtime;
+bool deadline_scheduling;
 bool play_nice;
 bool suspend;
 bool catalog;
@@ -100,6 +117,9 @@ double end_time = 1e99;
 double simulation_rate = 1./120.;
 bool override_sim_rate = false;
 double sleep_period=0.01;
+int cpu_affinity = -1;
+int realtime_priority = 0;
+int batch_threads = -1;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
@@ -177,6 +197,156 @@ public:
   }
 };
 
+/** Paces the frames of the simulation on absolute deadlines.
+    Frame n is started at t0 + n*dt of a monotonic clock so that the sleep
+    errors do not accumulate. On Linux the thread sleeps with
+    clock_nanosleep(TIMER_ABSTIME). A frame that completes after the start of
+    the next one is an overrun and the next frame is started immediately so
+    that the simulation catches up with the real time.
+
+    The latency of each frame (the time from its scheduled start to its
+    completion) is stored in a histogram allocated once for all, from which the
+    99th percentile is computed on request. */
+class RealTimeScheduler {
+public:
+  void Init(double dt) {
+    period = static_cast<int64_t>(dt*1e9 + 0.5);
+    binWidth = max<int64_t>(period/binsPerFrame, 1);
+    histogram.assign(binsPerFrame*maxFrames+1, 0);
+    start = next = GetTime();
+  }
+
+  /// Ties the statistics to the properties simulation/realtime/*
+  void Bind(std::shared_ptr<JSBSim::FGPropertyManager> pm) {
+    pm->Tie("simulation/realtime/frames", this, &RealTimeScheduler::GetFrames);
+    pm->Tie("simulation/realtime/overruns", this,
+            &RealTimeScheduler::GetOverruns);
+    pm->Tie("simulation/realtime/latency-max-sec", this,
+            &RealTimeScheduler::GetMaxLatency);
+    pm->Tie("simulation/realtime/latency-p99-sec", this,
+            &RealTimeScheduler::GetLatencyPercentile99);
+    pm->Tie("simulation/realtime/jitter-max-sec", this,
+            &RealTimeScheduler::GetMaxJitter);
+  }
+
+  /** Sleeps until the scheduled start of the next frame.
+      @return the real time elapsed since the scheduler was initialized */
+  double WaitForNextFrame(void) {
+    frameStart = GetTime();
+    // The wake-up jitter is not measured when catching up after an overrun.
+    if (frameStart < next) {
+      SleepUntil(next);
+      frameStart = GetTime();
+      maxJitter = max(maxJitter, frameStart - next);
+    }
+    return (frameStart - start)*1e-9;
+  }
+
+  /** Records the statistics of the frame that has just been executed.
+      @return the duration of the frame execution in seconds */
+  double EndFrame(void) {
+    int64_t now = GetTime();
+    int64_t latency = now - next;
+
+    ++frames;
+    maxLatency = max(maxLatency, latency);
+    ++histogram[min<int64_t>(max<int64_t>(latency, 0)/binWidth,
+                             histogram.size()-1)];
+    next += period;
+    if (now > next) ++overruns;
+
+    return (now - frameStart)*1e-9;
+  }
+
+  long GetFrames(void) const { return frames; }
+  long GetOverruns(void) const { return overruns; }
+  double GetMaxLatency(void) const { return maxLatency*1e-9; }
+  double GetMaxJitter(void) const { return maxJitter*1e-9; }
+
+  double GetLatencyPercentile99(void) const {
+    long count = 0, threshold = static_cast<long>(ceil(0.99*frames));
+    if (frames == 0) return 0.0;
+
+    // The last bin gathers the latencies that exceed the histogram range.
+    for (size_t i=0; i<histogram.size()-1; ++i) {
+      count += histogram[i];
+      if (count >= threshold)
+        return min<int64_t>((i+1)*binWidth, maxLatency)*1e-9;
+    }
+    return GetMaxLatency();
+  }
+
+  /** Pins the calling thread to a CPU and/or switches it to the SCHED_FIFO
+      policy. Only supported on Linux. */
+  static bool SetThreadAttributes(int cpu, int priority) {
+#ifdef __linux__
+    bool result = true;
+    if (cpu >= 0) {
+      cpu_set_t cpus;
+      CPU_ZERO(&cpus);
+      CPU_SET(cpu, &cpus);
+      if (sched_setaffinity(0, sizeof(cpus), &cpus) != 0) {
+        cerr << "Could not pin the simulation to CPU " << cpu << ": "
+             << strerror(errno) << endl;
+        result = false;
+      }
+    }
+    if (priority > 0) {
+      struct sched_param param;
+      param.sched_priority = priority;
+      if (sched_setscheduler(0, SCHED_FIFO, &param) != 0) {
+        cerr << "Could not set the SCHED_FIFO priority " << priority << ": "
+             << strerror(errno) << endl;
+        result = false;
+      }
+    }
+    return result;
+#else
+    if (cpu >= 0 || priority > 0) {
+      cerr << "CPU pinning and real-time priority are only supported on Linux."
+           << endl;
+      return false;
+    }
+    return true;
+#endif
+  }
+
+private:
+  static const int64_t binsPerFrame = 200;
+  static const int64_t maxFrames = 4;
+
+  int64_t period = 0, binWidth = 1;
+  int64_t start = 0, next = 0, frameStart = 0;
+  int64_t maxLatency = 0, maxJitter = 0;
+  long frames = 0, overruns = 0;
+  vector<long> histogram;
+
+  // Monotonic time in nanoseconds
+  static int64_t GetTime(void) {
+#ifdef __linux__
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<int64_t>(ts.tv_sec)*1000000000 + ts.tv_nsec;
+#else
+    return chrono::duration_cast<chrono::nanoseconds>(
+      chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+  }
+
+  static void SleepUntil(int64_t time) {
+#ifdef __linux__
+    struct timespec ts;
+    ts.tv_sec = time / 1000000000;
+    ts.tv_nsec = time % 1000000000;
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR);
+#else
+    this_thread::sleep_until(chrono::steady_clock::time_point(
+      chrono::duration_cast<chrono::steady_clock::duration>(
+        chrono::nanoseconds(time))));
+#endif
+  }
+};
+
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
@@ -330,8 +500,10 @@ int real_main(int argc, char* argv[])
   double cycle_duration = 0.0;
   double override_sim_rate_value = 0.0;
   long sleep_nseconds = 0;
+  RealTimeScheduler scheduler;
 
   realtime = false;
+  deadline_scheduling = false;
   play_nice = false;
   suspend = false;
   catalog = false;
@@ -344,6 +516,57 @@ int real_main(int argc, char* argv[])
     exit(-1);
   }
 
+  // *** RUN A BATCH OF DISPERSED SCRIPTS *** //
+  if (!BatchName.isNull()) {
+    JSBSim::FGBatchRunner batch;
+
+    if (nohighlight) batch.disableHighLighting();
+
+    batch.SetRootDir(RootDir);
+    if (!batch.Load(BatchName)) {
+      cerr << "Batch file " << BatchName << " was not successfully loaded" << endl;
+      exit(-1);
+    }
+    if (batch_threads >= 0) batch.SetNumThreads(batch_threads);
+
+    if (!batch.Run()) exit(-1);
+    return batch.GetNumFailedRuns() == 0 ? 0 : 1;
+  }
+
+  // *** LINEARIZE THE AIRCRAFT OVER A GRID OF FLIGHT CONDITIONS *** //
+  if (!EnvelopeName.isNull()) {
+    JSBSim::FGEnvelopeLinearization envelope;
+
+    if (nohighlight) envelope.disableHighLighting();
+
+    envelope.SetRootDir(RootDir);
+    if (!envelope.Load(EnvelopeName)) {
+      cerr << "Envelope file " << EnvelopeName << " was not successfully loaded" << endl;
+      exit(-1);
+    }
+    if (batch_threads >= 0) envelope.SetNumThreads(batch_threads);
+
+    if (!envelope.Run()) exit(-1);
+    return envelope.GetNumFailedPoints() == 0 ? 0 : 1;
+  }
+
+  // *** TRIM THE AIRCRAFT OVER A GRID OF FLIGHT CONDITIONS *** //
+  if (!TrimMapName.isNull()) {
+    JSBSim::FGTrimMap trimMap;
+
+    if (nohighlight) trimMap.disableHighLighting();
+
+    trimMap.SetRootDir(RootDir);
+    if (!trimMap.Load(TrimMapName)) {
+      cerr << "Trim map file " << TrimMapName << " was not successfully loaded" << endl;
+      exit(-1);
+    }
+    if (batch_threads >= 0) trimMap.SetNumThreads(batch_threads);
+
+    if (!trimMap.Run()) exit(-1);
+    return trimMap.GetNumFailedPoints() == 0 ? 0 : 1;
+  }
+
   // *** SET UP JSBSIM *** //
   FDMExec = new JSBSim::FGFDMExec();
   FDMExec->SetRootDir(RootDir);
@@ -353,6 +576,7 @@ int real_main(int argc, char* argv[])
   FDMExec->SetOutputPath(SGPath("."));
   FDMExec->GetPropertyManager()->Tie("simulation/frame_start_time", &actual_elapsed_time);
   FDMExec->GetPropertyManager()->Tie("simulation/cycle_duration", &cycle_duration);
+  if (deadline_scheduling) scheduler.Bind(FDMExec->GetPropertyManager());
 
   if (nohighlight) FDMExec->disableHighLighting();
 
@@ -469,6 +693,7 @@ int real_main(int argc, char* argv[])
   JSBSim::TrimMode icTrimRequested = (JSBSim::TrimMode)FDMExec->GetIC()->TrimRequested();
   if (icTrimRequested != JSBSim::TrimMode::tNone) {
     trimmer = new JSBSim::FGTrim( FDMExec, icTrimRequested );
+    trimmer->SetSolver((JSBSim::TrimSolver)FDMExec->GetTrimSolver());
     try {
       trimmer->DoTrim();
 
@@ -510,12 +735,31 @@ int real_main(int argc, char* argv[])
   tzset();
   current_seconds = initial_seconds = getcurrentseconds();
 
+  if (deadline_scheduling) {
+    RealTimeScheduler::SetThreadAttributes(cpu_affinity, realtime_priority);
+    scheduler.Init(frame_duration);
+  }
+
   // *** CYCLIC EXECUTION LOOP, AND MESSAGE READING *** //
   while (result && FDMExec->GetSimTime() <= end_time) {
     // Check if increment then hold is on and take appropriate actions if it is
     // Iterate is not supported in realtime - only in batch and playnice modes
     FDMExec->CheckIncrementalHold();
 
+    if (deadline_scheduling) {  // ------------ RUNNING ON DEADLINES
+      // The frames are also paced while the simulation is on hold so that the
+      // inputs are still processed.
+      actual_elapsed_time = scheduler.WaitForNextFrame();
+      result = FDMExec->Run();
+      cycle_duration = scheduler.EndFrame();
+
+      if (FDMExec->GetSimTime() >= new_five_second_value) { // Print out elapsed time every five seconds.
+        cout << "Simulation elapsed time: " << FDMExec->GetSimTime() << endl;
+        new_five_second_value += 5.0;
+      }
+      continue;
+    }
+
     // if running realtime, throttle the execution, else just run flat-out fast
     // unless "playing nice", in which case sleep for a while (0.01 seconds) each frame.
     // If suspended, then don't increment cumulative realtime "stopwatch".
@@ -571,6 +815,15 @@ int real_main(int argc, char* argv[])
   strftime(s, 99, "%A %B %d %Y %X", &local);
   cout << "End: " << s << " (HH:MM:SS)" << endl;
 
+  if (deadline_scheduling) {
+    cout << "Real-time frames: " << scheduler.GetFrames()
+         << ", overruns: " << scheduler.GetOverruns()
+         << ", max latency: " << scheduler.GetMaxLatency()*1e3 << " ms"
+         << ", p99 latency: " << scheduler.GetLatencyPercentile99()*1e3
+         << " ms, max jitter: " << scheduler.GetMaxJitter()*1e3 << " ms"
+         << endl;
+  }
+
   // CLEAN UP
   delete FDMExec;
 
@@ -614,6 +867,31 @@ bool options(int count, char **arg)
       exit (0);
     } else if (keyword == "--realtime") {
       realtime = true;
+      if (value == "deadline")
+        deadline_scheduling = true;
+      else if (!value.empty()) {
+        cerr << endl << "  Unknown real-time mode " << value << endl << endl;
+        result = false;
+      }
+    } else if (keyword == "--cpu") {
+      if (n != string::npos) {
+        cpu_affinity = atoi(value.c_str());
+      } else {
+        gripe;
+        exit(1);
+      }
+    } else if (keyword == "--realtime-priority") {
+      if (n != string::npos) {
+        realtime_priority = atoi(value.c_str());
+        if (realtime_priority < 1 || realtime_priority > 99) {
+          cerr << endl << "  The real-time priority must be between 1 and 99"
+               << endl << endl;
+          result = false;
+        }
+      } else {
+        gripe;
+        exit(1);
+      }
     } else if (keyword == "--nice") {
       play_nice = true;
       if (n != string::npos) {
@@ -662,6 +940,39 @@ bool options(int count, char **arg)
         gripe;
         exit(1);
       }
+    } else if (keyword == "--batch") {
+      if (n != string::npos) {
+        BatchName = SGPath::fromLocal8Bit(value.c_str());
+      } else {
+        gripe;
+        exit(1);
+      }
+    } else if (keyword == "--envelope") {
+      if (n != string::npos) {
+        EnvelopeName = SGPath::fromLocal8Bit(value.c_str());
+      } else {
+        gripe;
+        exit(1);
+      }
+    } else if (keyword == "--trim-map") {
+      if (n != string::npos) {
+        TrimMapName = SGPath::fromLocal8Bit(value.c_str());
+      } else {
+        gripe;
+        exit(1);
+      }
+    } else if (keyword == "--threads") {
+      if (n != string::npos) {
+        batch_threads = atoi(value.c_str());
+        if (batch_threads < 0) {
+          cerr << endl << "  The number of threads cannot be negative"
+               << endl << endl;
+          result = false;
+        }
+      } else {
+        gripe;
+        exit(1);
+      }
     } else if (keyword == "--initfile") {
       if (n != string::npos) {
         ResetName = SGPath::fromLocal8Bit(value.c_str());
@@ -740,6 +1051,10 @@ bool options(int count, char **arg)
 
   // Post-processing for script options. check for incompatible options.
 
+  if ((cpu_affinity >= 0 || realtime_priority > 0) && !deadline_scheduling) {
+    cerr << "The options --cpu and --realtime-priority require --realtime=deadline" << endl << endl;
+    result = false;
+  }
   if (catalog && !ScriptName.isNull()) {
     cerr << "Cannot specify catalog with script option" << endl << endl;
     result = false;
@@ -752,6 +1067,34 @@ bool options(int count, char **arg)
     cerr << "You cannot specify an aircraft file with a script." << endl;
     result = false;
   }
+  if (!BatchName.isNull() && (!ScriptName.isNull() || !AircraftName.empty()
+                              || !ResetName.isNull() || realtime || catalog)) {
+    cerr << "The batch option cannot be combined with a script, an aircraft, an"
+         << " initialization file, --catalog or --realtime." << endl << endl;
+    result = false;
+  }
+  if (!EnvelopeName.isNull() && (!BatchName.isNull() || !ScriptName.isNull()
+                                 || !AircraftName.empty() || !ResetName.isNull()
+                                 || realtime || catalog)) {
+    cerr << "The envelope option cannot be combined with a batch, a script, an"
+         << " aircraft, an initialization file, --catalog or --realtime."
+         << endl << endl;
+    result = false;
+  }
+  if (!TrimMapName.isNull() && (!BatchName.isNull() || !EnvelopeName.isNull()
+                                || !ScriptName.isNull() || !AircraftName.empty()
+                                || !ResetName.isNull() || realtime || catalog)) {
+    cerr << "The trim map option cannot be combined with a batch, an envelope,"
+         << " a script, an aircraft, an initialization file, --catalog or"
+         << " --realtime." << endl << endl;
+    result = false;
+  }
+  if (batch_threads >= 0 && BatchName.isNull() && EnvelopeName.isNull()
+      && TrimMapName.isNull()) {
+    cerr << "The option --threads requires --batch, --envelope or --trim-map"
+         << endl << endl;
+    result = false;
+  }
 
   return result;
 
@@ -772,7 +1115,17 @@ void PrintHelp(void)
     cout << "    --root=<path>  specifies the JSBSim root directory (where aircraft/, engine/, etc. reside)" << endl;
     cout << "    --aircraft=<filename>  specifies the name of the aircraft to be modeled" << endl;
     cout << "    --script=<filename>  specifies a script to run" << endl;
+    cout << "    --batch=<filename>  runs the batch of dispersed scripts described by the file" << endl;
+    cout << "    --envelope=<filename>  trims and linearizes the aircraft over the grid of flight conditions described by the file" << endl;
+    cout << "    --trim-map=<filename>  trims the aircraft over the grid of flight conditions described by the file" << endl;
+    cout << "    --threads=<n>  sets the number of threads of the batch, of the envelope or of the trim map (0 for the number of CPUs)" << endl;
     cout << "    --realtime  specifies to run in actual real world time" << endl;
+    cout << "    --realtime=deadline  specifies to run in real world time with each frame started" << endl;
+    cout << "                         on an absolute deadline. The frame overruns and latencies" << endl;
+    cout << "                         are reported in the properties simulation/realtime/*" << endl;
+    cout << "    --cpu=<n>  pins the simulation to the CPU n (Linux, --realtime=deadline only)" << endl;
+    cout << "    --realtime-priority=<1-99>  runs the simulation with the SCHED_FIFO policy" << endl;
+    cout << "                                (Linux, --realtime=deadline only)" << endl;
     cout << "    --nice  specifies to run at lower CPU usage" << endl;
     cout << "    --nohighlight  specifies that console output should be pure text only (no color)" << endl;
     cout << "    --suspend  specifies to suspend the simulation after initialization" << endl;
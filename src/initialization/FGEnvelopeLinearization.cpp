@@ -0,0 +1,352 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+  Module:       FGEnvelopeLinearization.cpp
+  Author:       Dawn Aerospace
+  Date started: October 2026
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU Lesser General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option) any
+  later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+
+  You should have received a copy of the GNU Lesser General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc., 59
+  Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+  Further information about the GNU Lesser General Public License can also be
+  found on the world wide web at http://www.gnu.org.
+
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  INCLUDES
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+
+#include "FGEnvelopeLinearization.h"
+#include "FGFDMExec.h"
+#include "FGInitialCondition.h"
+#include "FGLinearization.h"
+#include "FGTrim.h"
+#include "input_output/FGColumnarCodec.h"
+#include "input_output/FGGainScheduleReader.h"
+#include "input_output/FGXMLElement.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  CLASS IMPLEMENTATION
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace {
+
+// Helpers to write the little endian numbers and the strings of the gain
+// schedule files (see FGGainScheduleReader for the layout).
+template<typename T>
+void Append(vector<char>& buffer, T value)
+{
+  char bytes[sizeof(T)];
+  FGColumnarCodec::Store(bytes, value);
+  buffer.insert(buffer.end(), bytes, bytes+sizeof(T));
+}
+
+void Append(vector<char>& buffer, const string& value)
+{
+  Append(buffer, static_cast<uint16_t>(value.size()));
+  buffer.insert(buffer.end(), value.begin(), value.end());
+}
+
+void Append(vector<char>& buffer, const vector<double>& values)
+{
+  for (double value: values) Append(buffer, value);
+}
+
+void Append(vector<char>& buffer, const Vector2D<double>& matrix)
+{
+  for (const auto& row: matrix) Append(buffer, row);
+}
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGEnvelopeLinearization::FGEnvelopeLinearization(void)
+  : FGBatchPool("envelope", "envelope"), Mode(tLongitudinal), NextRecord(0),
+    NumFailedPoints(0)
+{
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGEnvelopeLinearization::~FGEnvelopeLinearization()
+{
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGEnvelopeLinearization::LoadSpecification(Element* document)
+{
+  string trim = document->GetAttributeValue("trim");
+  if (trim.empty() || trim == "longitudinal")
+    Mode = tLongitudinal;
+  else if (trim == "full")
+    Mode = tFull;
+  else {
+    cerr << document->ReadFrom() << fgred << "Unknown trim mode " << trim
+         << reset << endl;
+    return false;
+  }
+
+  return LoadGrid(document);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGEnvelopeLinearization::Run(void)
+{
+  auto start = chrono::steady_clock::now();
+
+  NumFailedPoints = 0;
+  if (!LoadTemplate({})) return false;
+
+  OutputFile.open(OutputName, ios::binary);
+  if (!OutputFile.is_open()) {
+    cerr << fgred << "Could not open the output file " << OutputName << reset
+         << endl;
+    ReleaseTemplate();
+    return false;
+  }
+
+  // The points are computed by order of their distance to the first point (the
+  // sum of their indices) so that the neighbor from which the trim of a point
+  // starts is computed before it.
+  size_t npoints = GetNumPoints();
+  vector<size_t> distance(npoints, 0);
+  for (size_t point=0; point<npoints; ++point) {
+    size_t index = point;
+    for (size_t i=Axes.size(); i>0; --i) {
+      size_t n = Axes[i-1].values.size();
+      distance[point] += index % n;
+      index /= n;
+    }
+  }
+
+  Order.resize(npoints);
+  iota(Order.begin(), Order.end(), 0);
+  stable_sort(Order.begin(), Order.end(),
+              [&distance](size_t a, size_t b) { return distance[a] < distance[b]; });
+
+  Results.assign(npoints, Result());
+  Offsets.assign(npoints, 0);
+  for (unsigned int i=0; i<3; ++i) {
+    Names[i].clear();
+    Units[i].clear();
+  }
+  PendingRecords.clear();
+  NextRecord = 0;
+
+  WriteHeader();
+  unsigned int nthreads = RunTasks(npoints);
+  if (nthreads > 0) WriteIndex();
+  OutputFile.close();
+  ReleaseTemplate();
+  if (nthreads == 0) return false;
+
+  if (debug_lvl > 0) {
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+    cout << endl << highint << npoints << " points linearized ("
+         << NumFailedPoints << " failed) in " << elapsed.count() << " s with "
+         << nthreads << " threads" << reset << endl;
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGEnvelopeLinearization::GetNeighbor(size_t point, size_t& neighbor) const
+{
+  size_t stride = 1;
+
+  for (size_t i=Axes.size(); i>0; --i) {
+    size_t n = Axes[i-1].values.size();
+    if ((point/stride) % n != 0) {
+      neighbor = point - stride;
+      return true;
+    }
+    stride *= n;
+  }
+
+  return false;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGEnvelopeLinearization::RunTask(FGFDMExec* fdmex, size_t rank)
+{
+  size_t point = Order[rank];
+
+  // The trim starts from the controls of the nearest neighbor that has been
+  // trimmed.
+  vector<double> controls;
+  {
+    unique_lock<mutex> lock(ResultsMutex);
+    size_t neighbor = point;
+    while (GetNeighbor(neighbor, neighbor)) {
+      const Result& result = Results[neighbor];
+      ResultAvailable.wait(lock, [&result] { return result.done; });
+      if (result.solved) {
+        controls = result.controls;
+        break;
+      }
+    }
+  }
+
+  vector<char> record;
+  try {
+    RestoreInitialState(fdmex);
+    if (!SolvePoint(fdmex, point, controls, record)) {
+      cerr << fgred << "Point " << point << " could not be trimmed." << reset
+           << endl;
+      record.clear();
+    }
+  } catch (const exception& e) {
+    cerr << fgred << "Point " << point << " failed: " << e.what() << reset
+         << endl;
+    record.clear();
+  }
+
+  if (record.empty()) controls.clear();
+  WriteResult(rank, point, controls, record);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGEnvelopeLinearization::SolvePoint(FGFDMExec* fdmex, size_t point,
+                                         vector<double>& controls,
+                                         vector<char>& record)
+{
+  SetGridPoint(fdmex, point);
+
+  FGTrim trim(fdmex, static_cast<TrimMode>(Mode));
+  trim.SetSolver(static_cast<TrimSolver>(fdmex->GetTrimSolver()));
+  trim.SetInitialControls(controls);
+  if (!trim.DoTrim()) return false;
+  controls = trim.GetControls();
+
+  FGLinearization lin(fdmex);
+  const auto& x0 = lin.GetInitialState();
+  const auto& u0 = lin.GetInitialInput();
+  const auto& y0 = lin.GetInitialOutput();
+
+  record.clear();
+  Append(record, static_cast<uint64_t>(point));
+  Append(record, static_cast<uint32_t>(controls.size()));
+  Append(record, static_cast<uint32_t>(x0.size()));
+  Append(record, static_cast<uint32_t>(u0.size()));
+  Append(record, static_cast<uint32_t>(y0.size()));
+  Append(record, controls);
+  Append(record, x0);
+  Append(record, u0);
+  Append(record, y0);
+  Append(record, lin.GetSystemMatrix());
+  Append(record, lin.GetInputMatrix());
+  Append(record, lin.GetOutputMatrix());
+  Append(record, lin.GetFeedforwardMatrix());
+
+  lock_guard<mutex> lock(ResultsMutex);
+  if (Names[0].empty()) {
+    Names[0] = lin.GetStateNames();
+    Names[1] = lin.GetInputNames();
+    Names[2] = lin.GetOutputNames();
+    Units[0] = lin.GetStateUnits();
+    Units[1] = lin.GetInputUnits();
+    Units[2] = lin.GetOutputUnits();
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGEnvelopeLinearization::WriteResult(size_t rank, size_t point,
+                                          vector<double>& controls,
+                                          vector<char>& record)
+{
+  {
+    lock_guard<mutex> lock(ResultsMutex);
+
+    Result& result = Results[point];
+    result.done = true;
+    result.solved = !record.empty();
+    result.controls.swap(controls);
+    if (!result.solved) NumFailedPoints++;
+
+    // The records are written in the order in which the points are started.
+    PendingRecords[rank].swap(record);
+    auto it = PendingRecords.find(NextRecord);
+    while (it != PendingRecords.end()) {
+      if (!it->second.empty()) {
+        Offsets[Order[NextRecord]] = OutputFile.tellp();
+        OutputFile.write(it->second.data(), it->second.size());
+      }
+      PendingRecords.erase(it);
+      it = PendingRecords.find(++NextRecord);
+    }
+    OutputFile.flush();
+  }
+
+  ResultAvailable.notify_all();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGEnvelopeLinearization::WriteHeader(void)
+{
+  vector<char> header(FGGainScheduleReader::FileMagic,
+                      FGGainScheduleReader::FileMagic+8);
+
+  Append(header, FGGainScheduleReader::Version);
+  Append(header, Template->GetModelName());
+  Append(header, static_cast<uint32_t>(Axes.size()));
+  for (const auto& axis: Axes) {
+    Append(header, axis.property);
+    Append(header, static_cast<uint32_t>(axis.values.size()));
+    Append(header, axis.values);
+  }
+
+  OutputFile.write(header.data(), header.size());
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGEnvelopeLinearization::WriteIndex(void)
+{
+  uint64_t offset = OutputFile.tellp();
+  vector<char> index(FGGainScheduleReader::IndexMagic,
+                     FGGainScheduleReader::IndexMagic+8);
+
+  Append(index, static_cast<uint64_t>(Offsets.size()));
+  for (uint64_t record: Offsets) Append(index, record);
+  for (unsigned int i=0; i<3; ++i) {
+    Append(index, static_cast<uint32_t>(Names[i].size()));
+    for (size_t j=0; j<Names[i].size(); ++j) {
+      Append(index, Names[i][j]);
+      Append(index, Units[i][j]);
+    }
+  }
+  Append(index, offset);
+  index.insert(index.end(), FGGainScheduleReader::EndMagic,
+               FGGainScheduleReader::EndMagic+8);
+
+  OutputFile.write(index.data(), index.size());
+}
+}
@@ -0,0 +1,156 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+  Header:       FGEnvelopeLinearization.h
+  Author:       Dawn Aerospace
+  Date started: October 2026
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU Lesser General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option) any
+  later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+
+  You should have received a copy of the GNU Lesser General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc., 59
+  Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+  Further information about the GNU Lesser General Public License can also be
+  found on the world wide web at http://www.gnu.org.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGENVELOPELINEARIZATION_H
+#define FGENVELOPELINEARIZATION_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <condition_variable>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "FGBatchPool.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+class FGFDMExec;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Trims and linearizes an aircraft over a grid of flight conditions.
+
+    The grid is described by a specification file:
+
+    @code
+<envelope threads="8" trim="longitudinal">
+  <script file="scripts/c1722.xml"/>
+  <axis property="ic/h-sl-ft"> 2000 5000 8000 </axis>
+  <axis property="ic/vt-kts"> 90 105 120 </axis>
+  <axis property="inertia/pointmass-weight-lbs[1]"> 0 180 </axis>
+  <axis property="inertia/pointmass-location-X-inches[4]"> 95 125 </axis>
+  <set name="propulsion/set-running" value="-1"/>
+  <output file="c172_envelope.lin"/>
+</envelope>
+    @endcode
+
+    The script file name is relative to the root directory while the output
+    file is relative to the current directory. The attribute threads is
+    optional and defaults to the number of CPUs. The attribute trim is either
+    longitudinal (the default) or full (see FGTrim).
+
+    Each axis gives the values of a property, typically an initial condition
+    such as the altitude or the speed, or the weight and the location of a
+    point mass to vary the mass and the CG of the aircraft. Each point of the
+    grid sets the properties of the axes, runs the initial conditions, applies
+    the settings (which can start the engines for example), trims the aircraft
+    and linearizes it (see FGLinearization). The results are written to a gain
+    schedule file (see FGGainScheduleReader).
+
+    The trim of a point starts from the controls of a neighbor on the grid:
+    the point whose index on the last axis that is not at its first value is
+    lower by one. If the trim of this neighbor failed, its own neighbor is
+    used and so on. The points are computed by order of their distance to
+    the first point of the grid so that their neighbors are usually already
+    trimmed when they are started, and the workers only wait when it is not
+    the case. The results therefore do not depend on the number of threads.
+
+    The script is read once by a template instance of FGFDMExec and each
+    point starts from its initial state (see FGBatchPool).
+  */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class JSBSIM_API FGEnvelopeLinearization : public FGBatchPool
+{
+public:
+  FGEnvelopeLinearization(void);
+  ~FGEnvelopeLinearization();
+
+  /** Overrides the name of the output file of the specification file.
+      @param filename the name of the gain schedule file. */
+  void SetOutputFileName(const std::string& filename) { OutputName = filename; }
+
+  /// Returns the number of points of the grid.
+  size_t GetNumPoints(void) const { return GetGridSize(); }
+
+  /** Trims and linearizes the points of the grid.
+      @return false if the script cannot be loaded or if the output file
+              cannot be written. The points that cannot be trimmed are
+              reported by GetNumFailedPoints(). */
+  bool Run(void);
+
+  /// Returns the number of points that failed during the last call to Run().
+  unsigned int GetNumFailedPoints(void) const { return NumFailedPoints; }
+
+private:
+  struct Result {
+    bool done = false;
+    bool solved = false;
+    std::vector<double> controls;
+  };
+
+  int Mode;
+
+  std::vector<size_t> Order;
+  std::mutex ResultsMutex;
+  std::condition_variable ResultAvailable;
+  std::vector<Result> Results;
+  std::ofstream OutputFile;
+  std::map<size_t, std::vector<char> > PendingRecords;
+  size_t NextRecord;
+  std::vector<uint64_t> Offsets;
+  std::vector<std::string> Names[3];
+  std::vector<std::string> Units[3];
+  unsigned int NumFailedPoints;
+
+  bool LoadSpecification(Element* document) override;
+  void RunTask(FGFDMExec* fdmex, size_t rank) override;
+  bool GetNeighbor(size_t point, size_t& neighbor) const;
+  bool SolvePoint(FGFDMExec* fdmex, size_t point, std::vector<double>& controls,
+                  std::vector<char>& record);
+  void WriteResult(size_t rank, size_t point, std::vector<double>& controls,
+                   std::vector<char>& record);
+  void WriteHeader(void);
+  void WriteIndex(void);
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
@@ -49,6 +49,7 @@ INCLUDES
 #include "models/FGAtmosphere.h"
 #include "models/FGAccelerations.h"
 #include "input_output/FGXMLFileRead.h"
+#include "input_output/FGSnapshot.h"
 #include "FGTrim.h"
 #include "FGFDMExec.h"
 
@@ -1000,6 +1001,28 @@ double FGInitialCondition::GetBodyVelFpsIC(int idx) const
 
 //******************************************************************************
 
+void FGInitialCondition::SyncState(FGSnapshot& snapshot)
+{
+  snapshot.Sync(vUVW_NED);
+  snapshot.Sync(vPQR_body);
+  snapshot.Sync(position);
+  snapshot.Sync(orientation);
+  snapshot.Sync(vt);
+  snapshot.Sync(targetNlfIC);
+  snapshot.Sync(Tw2b);
+  snapshot.Sync(Tb2w);
+  snapshot.Sync(alpha);
+  snapshot.Sync(beta);
+  snapshot.Sync(epa);
+  snapshot.Sync(lastSpeedSet);
+  snapshot.Sync(lastAltitudeSet);
+  snapshot.Sync(lastLatitudeSet);
+  snapshot.Sync(enginesRunning);
+  snapshot.Sync(trimRequested);
+}
+
+//******************************************************************************
+
 bool FGInitialCondition::Load(const SGPath& rstfile, bool useStoredPath)
 {
   SGPath init_file_name;
@@ -1009,7 +1032,7 @@ bool FGInitialCondition::Load(const SGPath& rstfile, bool useStoredPath)
     init_file_name = rstfile;
   }
 
-  FGXMLFileRead XMLFileRead;
+  FGXMLFileRead XMLFileRead(fdmex->GetDocumentCache());
   Element* document = XMLFileRead.LoadXMLDocument(init_file_name);
 
   // Make sure that the document is valid
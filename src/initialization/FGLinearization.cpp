@@ -22,10 +22,11 @@
 
 namespace JSBSim {
 
-FGLinearization::FGLinearization(FGFDMExec * fdm)
+FGLinearization::FGLinearization(FGFDMExec * fdm, unsigned int numThreads)
     : aircraft_name(fdm->GetAircraft()->GetAircraftName())
 {
     FGStateSpace ss(fdm);
+    ss.setNumThreads(numThreads);
     ss.x.add(new FGStateSpace::Vt);
     ss.x.add(new FGStateSpace::Alpha);
     ss.x.add(new FGStateSpace::Theta);
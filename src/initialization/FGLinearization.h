@@ -45,8 +45,10 @@ class JSBSIM_API FGLinearization
 public:
     /**
      * @param fdmPtr Already configured FGFDMExec instance used to create the new linear model.
+     * @param numThreads Number of threads over which the perturbations are spread. Each
+     * additional thread runs its own reload of fdmPtr (see FGFDMExec::CachedReload()).
      */
-    FGLinearization(FGFDMExec * fdmPtr);
+    FGLinearization(FGFDMExec * fdmPtr, unsigned int numThreads = 1);
 
     /**
      * Write Scicoslab source file with the state space model to a
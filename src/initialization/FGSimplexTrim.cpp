@@ -22,7 +22,8 @@
 
 namespace JSBSim {
 
-FGSimplexTrim::FGSimplexTrim(FGFDMExec * fdm, TrimMode mode)
+FGSimplexTrim::FGSimplexTrim(FGFDMExec * fdm, TrimMode mode) :
+    m_success(false), m_cost(0), m_iterations(0), m_modelRuns(0)
 {
     std::clock_t time_start=clock(), time_trimDone;
 
@@ -34,21 +35,21 @@ FGSimplexTrim::FGSimplexTrim(FGFDMExec * fdm, TrimMode mode)
     }
 
     // defaults
-    std::string aircraftName = fdm->GetAircraft()->GetAircraftName();
     FGPropertyNode* node = fdm->GetPropertyManager()->GetNode();
-    double rtol = node->GetDouble("trim/solver/rtol");
-    double abstol = node->GetDouble("trim/solver/abstol");
-    double speed = node->GetDouble("trim/solver/speed"); // must be > 1, 2 typical
-    double random = node->GetDouble("trim/solver/random");
-    int iterMax = node->GetInt("trim/solver/iterMax");
+    double rtol = node->GetDouble("trim/solver/rtol", 1e-4);
+    double abstol = node->GetDouble("trim/solver/abstol", 1e-6);
+    double speed = node->GetDouble("trim/solver/speed", 2.0); // must be > 1, 2 typical
+    double random = node->GetDouble("trim/solver/random", 0.1);
+    int iterMax = node->GetInt("trim/solver/iterMax", 2000);
     bool showConvergence = node->GetBool("trim/solver/showConvergence");
     bool pause = node->GetBool("trim/solver/pause");
     bool showSimplex = node->GetBool("trim/solver/showSimplex");
+    unsigned int seed = node->GetInt("simulation/randomseed");
 
     // flight conditions
     double phi = fdm->GetIC()->GetPhiRadIC();
     double theta = fdm->GetIC()->GetThetaRadIC();
-    double gd = fdm->GetInertial()->gravity();
+    double gd = fdm->GetInertial()->GetGravity().Magnitude();
 
     constraints.velocity = fdm->GetIC()->GetVtrueFpsIC();
     constraints.altitude = fdm->GetIC()->GetAltitudeASLFtIC();
@@ -63,54 +64,59 @@ FGSimplexTrim::FGSimplexTrim(FGFDMExec * fdm, TrimMode mode)
     int n = 6;
     std::vector<double> initialGuess(n), lowerBound(n), upperBound(n), initialStepSize(n);
 
-    lowerBound[0] = node->GetDouble("trim/solver/throttleMin");
-    lowerBound[1] = node->GetDouble("trim/solver/elevatorMin");
-    lowerBound[2] = node->GetDouble("trim/solver/alphaMin");
-    lowerBound[3] = node->GetDouble("trim/solver/aileronMin");
-    lowerBound[4] = node->GetDouble("trim/solver/rudderMin");
-    lowerBound[5] = node->GetDouble("trim/solver/betaMin");
-
-    upperBound[0] = node->GetDouble("trim/solver/throttleMax");
-    upperBound[1] = node->GetDouble("trim/solver/elevatorMax");
-    upperBound[2] = node->GetDouble("trim/solver/alphaMax");
-    upperBound[3] = node->GetDouble("trim/solver/aileronMax");
-    upperBound[4] = node->GetDouble("trim/solver/rudderMax");
-    upperBound[5] = node->GetDouble("trim/solver/betaMax");
-
-    initialStepSize[0] = node->GetDouble("trim/solver/throttleStep");
-    initialStepSize[1] = node->GetDouble("trim/solver/elevatorStep");
-    initialStepSize[2] = node->GetDouble("trim/solver/alphaStep");
-    initialStepSize[3] = node->GetDouble("trim/solver/aileronStep");
-    initialStepSize[4] = node->GetDouble("trim/solver/rudderStep");
-    initialStepSize[5] = node->GetDouble("trim/solver/betaStep");
-
-    initialGuess[0] = node->GetDouble("trim/solver/throttleGuess");
-    initialGuess[1] = node->GetDouble("trim/solver/elevatorGuess");
-    initialGuess[2] = node->GetDouble("trim/solver/alphaGuess");
-    initialGuess[3] = node->GetDouble("trim/solver/aileronGuess");
-    initialGuess[4] = node->GetDouble("trim/solver/rudderGuess");
-    initialGuess[5] = node->GetDouble("trim/solver/betaGuess");
+    lowerBound[0] = node->GetDouble("trim/solver/throttleMin", 0.0);
+    lowerBound[1] = node->GetDouble("trim/solver/elevatorMin", -1.0);
+    lowerBound[2] = node->GetDouble("trim/solver/alphaMin", -10.0*M_PI/180);
+    lowerBound[3] = node->GetDouble("trim/solver/aileronMin", -1.0);
+    lowerBound[4] = node->GetDouble("trim/solver/rudderMin", -1.0);
+    lowerBound[5] = node->GetDouble("trim/solver/betaMin", -10.0*M_PI/180);
+
+    upperBound[0] = node->GetDouble("trim/solver/throttleMax", 1.0);
+    upperBound[1] = node->GetDouble("trim/solver/elevatorMax", 1.0);
+    upperBound[2] = node->GetDouble("trim/solver/alphaMax", 20.0*M_PI/180);
+    upperBound[3] = node->GetDouble("trim/solver/aileronMax", 1.0);
+    upperBound[4] = node->GetDouble("trim/solver/rudderMax", 1.0);
+    upperBound[5] = node->GetDouble("trim/solver/betaMax", 10.0*M_PI/180);
+
+    initialStepSize[0] = node->GetDouble("trim/solver/throttleStep", 0.1);
+    initialStepSize[1] = node->GetDouble("trim/solver/elevatorStep", 0.1);
+    initialStepSize[2] = node->GetDouble("trim/solver/alphaStep", 0.1);
+    initialStepSize[3] = node->GetDouble("trim/solver/aileronStep", 0.1);
+    initialStepSize[4] = node->GetDouble("trim/solver/rudderStep", 0.1);
+    initialStepSize[5] = node->GetDouble("trim/solver/betaStep", 0.1);
+
+    initialGuess[0] = node->GetDouble("trim/solver/throttleGuess", 0.5);
+    initialGuess[1] = node->GetDouble("trim/solver/elevatorGuess", 0.0);
+    initialGuess[2] = node->GetDouble("trim/solver/alphaGuess", 0.05);
+    initialGuess[3] = node->GetDouble("trim/solver/aileronGuess", 0.0);
+    initialGuess[4] = node->GetDouble("trim/solver/rudderGuess", 0.0);
+    initialGuess[5] = node->GetDouble("trim/solver/betaGuess", 0.0);
 
     // solve
-    FGTrimmer * trimmer = new FGTrimmer(fdm, &constraints);
-    Callback callback(aircraftName, trimmer);
-    FGNelderMead * solver = NULL;
-
-    solver = new FGNelderMead(trimmer,initialGuess,
+    FGTrimmer trimmer(fdm, &constraints);
+    FGNelderMead solver(&trimmer,initialGuess,
         lowerBound, upperBound, initialStepSize,iterMax,rtol,
-        abstol,speed,random,showConvergence,showSimplex,pause,&callback);
-    while(solver->status()==1) solver->update();
+        abstol,speed,random,showConvergence,showSimplex,pause,NULL,seed);
+    try {
+        while(solver.status()==1) solver.update();
+        m_success = true;
+    } catch (const std::runtime_error& e) {
+        if (fdm->GetDebugLevel() > 0)
+            std::cout << "\nsimplex trim failed: " << e.what() << std::endl;
+    }
     time_trimDone = std::clock();
 
+    // leave the aircraft at the best solution found
+    m_cost = trimmer.eval(solver.getSolution());
+    m_iterations = solver.getIterations();
+    m_modelRuns = trimmer.getRunCount();
+
     // output
     if (fdm->GetDebugLevel() > 0) {
-        trimmer->printSolution(std::cout,solver->getSolution());
-        std::cout << "\nfinal cost: " << std::scientific << std::setw(10) << trimmer->eval(solver->getSolution()) << std::endl;
+        trimmer.printSolution(std::cout,solver.getSolution());
+        std::cout << "\nfinal cost: " << std::scientific << std::setw(10) << m_cost << std::endl;
         std::cout << "\ntrim computation time: " << (time_trimDone - time_start)/double(CLOCKS_PER_SEC) << "s \n" << std::endl;
     }
-
-    delete solver;
-    delete trimmer;
 }
 
 } // JSBSim
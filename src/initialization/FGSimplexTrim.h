@@ -19,59 +19,54 @@
 #ifndef FGSimplexTrim_H_
 #define FGSimplexTrim_H_
 
+#include "initialization/FGTrim.h"
 #include "initialization/FGTrimmer.h"
 #include "math/FGStateSpace.h"
 #include <iomanip>
-#include <fstream>
 #include "models/FGAircraft.h"
 #include "models/propulsion/FGEngine.h"
 #include "models/propulsion/FGTurbine.h"
 #include "models/propulsion/FGTurboProp.h"
 #include "math/FGNelderMead.h"
 #include <stdexcept>
-#include <fstream>
 #include <cstdlib>
 
 namespace JSBSim {
 
+/** Trims the aircraft with a Nelder-Mead simplex search over the throttle,
+    elevator, angle of attack, aileron, rudder and sideslip. The search
+    minimizes a weighted sum of the squares of the accelerations computed by
+    FGTrimmer; the yaw rate is set from the bank angle of the initial
+    conditions so a banked aircraft is trimmed in a coordinated turn.
+
+    The settings of the solver are read from the properties trim/solver/
+    (rtol, abstol, speed, random, iterMax, showConvergence, showSimplex,
+    pause, and the Min, Max, Step and Guess of each control such as
+    throttleMin or alphaGuess). The properties that do not exist take
+    default values suitable for most aircraft. The random perturbations of the
+    search are seeded with simulation/randomseed so a trim is repeatable.
+
+    The trim is run by the constructor. A failure is reported by GetSuccess()
+    rather than by an exception.
+*/
 class FGSimplexTrim
 {
 public:
     FGSimplexTrim(FGFDMExec * fdmPtr, TrimMode mode);
-private:
-    template <class varType>
-    void prompt(const std::string & str, varType & var)
-    {
-        std::cout << str + " [" << std::setw(10) << var << "]\t: ";
-        if (std::cin.peek() != '\n')
-        {
-            std::cin >> var;
-            std::cin.ignore(1000, '\n');
-        }
-        else std::cin.get();
-    }
 
-    class Callback : public JSBSim::FGNelderMead::Callback
-    {   
-    private:
-        std::ofstream _outputFile;
-        JSBSim::FGTrimmer * _trimmer;
-    public:
-        Callback(std::string fileName, JSBSim::FGTrimmer * trimmer) : 
-            _outputFile((fileName + std::string("_simplexTrim.log")).c_str()),
-            _trimmer(trimmer) {
-        }
-        virtual ~Callback() {
-            _outputFile.close();
-        }
-        void eval(const std::vector<double> &v)
-        {
-            _outputFile << _trimmer->eval(v) << std::endl;;
-            //std::cout << "v: ";
-            //for (int i=0;i<v.size();i++) std::cout << v[i] << " ";
-            //std::cout << std::endl;
-        }
-    };
+    /// @return true if the cost was brought below trim/solver/abstol.
+    bool GetSuccess() const { return m_success; }
+    /// @return the cost of the solution.
+    double GetCost() const { return m_cost; }
+    /// @return the number of iterations of the simplex.
+    int GetIterations() const { return m_iterations; }
+    /// @return the number of times the model was run.
+    unsigned int GetModelRuns() const { return m_modelRuns; }
+private:
+    bool m_success;
+    double m_cost;
+    int m_iterations;
+    unsigned int m_modelRuns;
 };
 
 } // JSBSim
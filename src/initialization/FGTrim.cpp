@@ -77,6 +77,8 @@ FGTrim::FGTrim(FGFDMExec *FDMExec,TrimMode tt)
   xlo=xhi=alo=ahi=0.0;
   targetNlf=fgic.GetTargetNlfIC();
   debug_axis=tAll;
+  solver=tAxisByAxis;
+  model_runs=0;
   SetMode(tt);
   if (debug_lvl & 2) cout << "Instantiated: FGTrim" << endl;
 }
@@ -90,26 +92,35 @@ FGTrim::~FGTrim(void) {
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 void FGTrim::TrimStats() {
-  int run_sum=0;
   cout << endl << "  Trim Statistics: " << endl;
   cout << "    Total Iterations: " << total_its << endl;
   if( total_its > 0) {
-    cout << "    Sub-iterations:" << endl;
-    for (unsigned int current_axis=0; current_axis<TrimAxes.size(); current_axis++) {
-      run_sum += TrimAxes[current_axis].GetRunCount();
-      cout << "   " << setw(5) << TrimAxes[current_axis].GetStateName().c_str()
-           << ": " << setprecision(3) << sub_iterations[current_axis]
-           << " average: " << setprecision(5) << sub_iterations[current_axis]/double(total_its)
-           << "  successful:  " << setprecision(3) << successful[current_axis]
-           << "  stability: " << setprecision(5) << TrimAxes[current_axis].GetAvgStability()
-           << endl;
+    if (solver == tAxisByAxis) {
+      cout << "    Sub-iterations:" << endl;
+      for (unsigned int current_axis=0; current_axis<TrimAxes.size(); current_axis++) {
+        cout << "   " << setw(5) << TrimAxes[current_axis].GetStateName().c_str()
+             << ": " << setprecision(3) << sub_iterations[current_axis]
+             << " average: " << setprecision(5) << sub_iterations[current_axis]/double(total_its)
+             << "  successful:  " << setprecision(3) << successful[current_axis]
+             << "  stability: " << setprecision(5) << TrimAxes[current_axis].GetAvgStability()
+             << endl;
+      }
     }
-    cout << "    Run Count: " << run_sum << endl;
+    cout << "    Run Count: " << GetModelRuns() << endl;
   }
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+unsigned int FGTrim::GetModelRuns(void) {
+  unsigned int run_sum = model_runs;
+  for (unsigned int current_axis=0; current_axis<TrimAxes.size(); current_axis++)
+    run_sum += TrimAxes[current_axis].GetRunCount();
+  return run_sum;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGTrim::Report(void) {
   cout << "  Trim Results: " << endl;
   for(unsigned int current_axis=0; current_axis<TrimAxes.size(); current_axis++)
@@ -119,6 +130,15 @@ void FGTrim::Report(void) {
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+vector<double> FGTrim::GetControls(void) {
+  vector<double> controls;
+  for(unsigned int current_axis=0; current_axis<TrimAxes.size(); current_axis++)
+    controls.push_back(TrimAxes[current_axis].GetControl());
+  return controls;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGTrim::ClearStates(void) {
     mode=tCustom;
     TrimAxes.clear();
@@ -218,18 +238,27 @@ bool FGTrim::DoTrim(void) {
     TrimAxes[2].SetControlLimits(phi - 30.0 * degtorad, phi + 30.0 * degtorad);
   }
 
+  // When initial controls are supplied, the first iteration searches for an
+  // interval around them (findInterval) rather than over the whole range of
+  // the controls (checkLimits).
+  bool warm_start = !initial_controls.empty()
+                    && initial_controls.size() == TrimAxes.size();
+
   //clear the sub iterations counts & zero out the controls
   for(unsigned int current_axis=0;current_axis<TrimAxes.size();current_axis++) {
     //cout << current_axis << "  " << TrimAxes[current_axis]->GetStateName()
     //<< "  " << TrimAxes[current_axis]->GetControlName()<< endl;
     xlo=TrimAxes[current_axis].GetControlMin();
     xhi=TrimAxes[current_axis].GetControlMax();
-    TrimAxes[current_axis].SetControl((xlo+xhi)/2);
+    if (warm_start)
+      TrimAxes[current_axis].SetControl(Constrain(xlo, initial_controls[current_axis], xhi));
+    else
+      TrimAxes[current_axis].SetControl((xlo+xhi)/2);
     TrimAxes[current_axis].Run();
     //TrimAxes[current_axis].AxisReport();
     sub_iterations[current_axis]=0;
     successful[current_axis]=0;
-    solution[current_axis]=false;
+    solution[current_axis]=warm_start;
   }
 
   if(mode == tPullup ) {
@@ -243,71 +272,76 @@ bool FGTrim::DoTrim(void) {
     //TrimAxes[0].SetStateTarget(targetNlf);
   }
 
-  do {
-    axis_count=0;
-    for(unsigned int current_axis=0;current_axis<TrimAxes.size();current_axis++) {
-      setDebug(TrimAxes[current_axis]);
-      updateRates();
-      Nsub=0;
-      if(!solution[current_axis]) {
-        if(checkLimits(TrimAxes[current_axis])) {
-          solution[current_axis]=true;
+  if (solver == tNewton) {
+    trim_failed = !solveNewton(N);
+    if (!trim_failed) axis_count = TrimAxes.size();
+  } else {
+    do {
+      axis_count=0;
+      for(unsigned int current_axis=0;current_axis<TrimAxes.size();current_axis++) {
+        setDebug(TrimAxes[current_axis]);
+        updateRates();
+        Nsub=0;
+        if(!solution[current_axis]) {
+          if(checkLimits(TrimAxes[current_axis])) {
+            solution[current_axis]=true;
+            solve(TrimAxes[current_axis]);
+          }
+        } else if(findInterval(TrimAxes[current_axis])) {
           solve(TrimAxes[current_axis]);
+        } else {
+          solution[current_axis]=false;
         }
-      } else if(findInterval(TrimAxes[current_axis])) {
-        solve(TrimAxes[current_axis]);
-      } else {
-        solution[current_axis]=false;
-      }
-      sub_iterations[current_axis]+=Nsub;
-    }
-    for(unsigned int current_axis=0;current_axis<TrimAxes.size();current_axis++) {
-      //these checks need to be done after all the axes have run
-      if(Debug > 0) TrimAxes[current_axis].AxisReport();
-      if(TrimAxes[current_axis].InTolerance()) {
-        axis_count++;
-        successful[current_axis]++;
+        sub_iterations[current_axis]+=Nsub;
       }
-    }
-
-    if((axis_count == TrimAxes.size()-1) && (TrimAxes.size() > 1)) {
-      //cout << TrimAxes.size()-1 << " out of " << TrimAxes.size() << "!" << endl;
-      //At this point we can check the input limits of the failed axis
-      //and declare the trim failed if there is no sign change. If there
-      //is, keep going until success or max iteration count
-
-      //Oh, well: two out of three ain't bad
       for(unsigned int current_axis=0;current_axis<TrimAxes.size();current_axis++) {
         //these checks need to be done after all the axes have run
-        if(!TrimAxes[current_axis].InTolerance()) {
-          if(!checkLimits(TrimAxes[current_axis])) {
-            // special case this for now -- if other cases arise proper
-            // support can be added to FGTrimAxis
-            if( (gamma_fallback) &&
-                (TrimAxes[current_axis].GetStateType() == tUdot) &&
-                (TrimAxes[current_axis].GetControlType() == tThrottle)) {
-              cout << "  Can't trim udot with throttle, trying flight"
-              << " path angle. (" << N << ")" << endl;
-              if(TrimAxes[current_axis].GetState() > 0)
-                TrimAxes[current_axis].SetControlToMin();
-              else
-                TrimAxes[current_axis].SetControlToMax();
-              TrimAxes[current_axis].Run();
-              TrimAxes[current_axis]=FGTrimAxis(fdmex,&fgic,tUdot,tGamma);
-            } else {
-              cout << "  Sorry, " << TrimAxes[current_axis].GetStateName()
-              << " doesn't appear to be trimmable" << endl;
-              //total_its=k;
-              trim_failed=true; //force the trim to fail
-            } //gamma_fallback
-          }
-        } //solution check
-      } //for loop
-    } //all-but-one check
-    N++;
-    if(N > max_iterations)
-      trim_failed=true;
-  } while((axis_count < TrimAxes.size()) && (!trim_failed));
+        if(Debug > 0) TrimAxes[current_axis].AxisReport();
+        if(TrimAxes[current_axis].InTolerance()) {
+          axis_count++;
+          successful[current_axis]++;
+        }
+      }
+
+      if((axis_count == TrimAxes.size()-1) && (TrimAxes.size() > 1)) {
+        //cout << TrimAxes.size()-1 << " out of " << TrimAxes.size() << "!" << endl;
+        //At this point we can check the input limits of the failed axis
+        //and declare the trim failed if there is no sign change. If there
+        //is, keep going until success or max iteration count
+
+        //Oh, well: two out of three ain't bad
+        for(unsigned int current_axis=0;current_axis<TrimAxes.size();current_axis++) {
+          //these checks need to be done after all the axes have run
+          if(!TrimAxes[current_axis].InTolerance()) {
+            if(!checkLimits(TrimAxes[current_axis])) {
+              // special case this for now -- if other cases arise proper
+              // support can be added to FGTrimAxis
+              if( (gamma_fallback) &&
+                  (TrimAxes[current_axis].GetStateType() == tUdot) &&
+                  (TrimAxes[current_axis].GetControlType() == tThrottle)) {
+                cout << "  Can't trim udot with throttle, trying flight"
+                << " path angle. (" << N << ")" << endl;
+                if(TrimAxes[current_axis].GetState() > 0)
+                  TrimAxes[current_axis].SetControlToMin();
+                else
+                  TrimAxes[current_axis].SetControlToMax();
+                TrimAxes[current_axis].Run();
+                TrimAxes[current_axis]=FGTrimAxis(fdmex,&fgic,tUdot,tGamma);
+              } else {
+                cout << "  Sorry, " << TrimAxes[current_axis].GetStateName()
+                << " doesn't appear to be trimmable" << endl;
+                //total_its=k;
+                trim_failed=true; //force the trim to fail
+              } //gamma_fallback
+            }
+          } //solution check
+        } //for loop
+      } //all-but-one check
+      N++;
+      if(N > max_iterations)
+        trim_failed=true;
+    } while((axis_count < TrimAxes.size()) && (!trim_failed));
+  }
 
   if((!trim_failed) && (axis_count >= TrimAxes.size())) {
     total_its=N;
@@ -725,6 +759,182 @@ bool FGTrim::checkLimits(FGTrimAxis& axis)
   return solutionExists;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Solves the n x n system A x = b by Gaussian elimination with partial
+// pivoting. The solution is returned in b.
+
+static bool solveLinearSystem(vector<double>& A, vector<double>& b)
+{
+  const size_t n = b.size();
+
+  for (size_t k=0; k<n; k++) {
+    size_t pivot = k;
+    for (size_t i=k+1; i<n; i++)
+      if (fabs(A[i*n+k]) > fabs(A[pivot*n+k])) pivot = i;
+    if (A[pivot*n+k] == 0.0) return false;
+    if (pivot != k) {
+      for (size_t j=0; j<n; j++) swap(A[k*n+j], A[pivot*n+j]);
+      swap(b[k], b[pivot]);
+    }
+    for (size_t i=k+1; i<n; i++) {
+      double f = A[i*n+k] / A[k*n+k];
+      for (size_t j=k; j<n; j++) A[i*n+j] -= f*A[k*n+j];
+      b[i] -= f*b[k];
+    }
+  }
+
+  for (size_t k=n; k-- > 0;) {
+    for (size_t j=k+1; j<n; j++) b[k] -= A[k*n+j]*b[j];
+    b[k] /= A[k*n+k];
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTrim::evaluate(const vector<double>& controls, vector<double>& residuals)
+{
+  const size_t n = TrimAxes.size();
+  vector<double> last(n);
+
+  for (unsigned int i=0; i<n; i++) {
+    TrimAxes[i].SetControl(controls[i]);
+    TrimAxes[i].ApplyControl();
+  }
+  updateRates();
+
+  // The jacobian is computed from the difference of the residuals so the
+  // model is run until they are steady to a fraction of the tolerance.
+  for (int its=1; its <= 100; its++) {
+    fdmex->Initialize(&fgic);
+    fdmex->Run();
+    model_runs++;
+
+    bool stable = its > 1;
+    for (unsigned int i=0; i<n; i++) {
+      last[i] = residuals[i];
+      residuals[i] = TrimAxes[i].GetState() / TrimAxes[i].GetTolerance();
+      if (fabs(residuals[i] - last[i]) > 0.01) stable = false;
+    }
+    if (stable) break;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The residuals are the states scaled by their tolerance so the trim is
+// achieved when they are all within [-1, 1]. Each step solves
+//   (J^T J + lambda diag(J^T J)) dx = -J^T r
+// with the controls constrained to their limits. The jacobian J is computed by
+// finite differences (one model evaluation per axis) then updated from each
+// successful step with Broyden's rank one formula. It is only computed again
+// when a step taken with an updated jacobian fails to decrease the residuals.
+
+bool FGTrim::solveNewton(unsigned int& N)
+{
+  const size_t n = TrimAxes.size();
+  vector<double> x(n), r(n), x1(n), r1(n), J(n*n), A(n*n), dx(n);
+  double lambda = 1E-3;
+  bool need_jacobian = true;
+  bool fresh_jacobian = false;
+  bool at_solution = true; // The model was last run with the controls x
+
+  auto cost = [](const vector<double>& res) {
+    double sum = 0.0;
+    for (double ri: res) sum += ri*ri;
+    return sum;
+  };
+  auto converged = [](const vector<double>& res) {
+    for (double ri: res)
+      if (fabs(ri) > 1.0) return false;
+    return true;
+  };
+
+  for (unsigned int i=0; i<n; i++)
+    x[i] = TrimAxes[i].GetControl();
+  evaluate(x, r);
+
+  for (N=0; N < max_iterations && !converged(r); N++) {
+    if (need_jacobian) {
+      for (unsigned int j=0; j<n; j++) {
+        double h = 1E-4*(TrimAxes[j].GetControlMax() - TrimAxes[j].GetControlMin());
+        if (x[j] + h > TrimAxes[j].GetControlMax()) h = -h;
+        x1 = x;
+        x1[j] += h;
+        evaluate(x1, r1);
+        for (unsigned int i=0; i<n; i++)
+          J[i*n+j] = (r1[i] - r[i]) / h;
+      }
+      at_solution = false;
+      need_jacobian = false;
+      fresh_jacobian = true;
+    }
+
+    for (unsigned int i=0; i<n; i++) {
+      dx[i] = 0.0;
+      for (unsigned int k=0; k<n; k++) dx[i] -= J[k*n+i]*r[k];
+      for (unsigned int j=0; j<n; j++) {
+        A[i*n+j] = 0.0;
+        for (unsigned int k=0; k<n; k++) A[i*n+j] += J[k*n+i]*J[k*n+j];
+      }
+    }
+    for (unsigned int i=0; i<n; i++)
+      A[i*n+i] += lambda*max(A[i*n+i], 1E-12);
+
+    if (!solveLinearSystem(A, dx)) {
+      if (fresh_jacobian) break;
+      need_jacobian = true;
+      continue;
+    }
+
+    // The step is measured relatively to the range of the controls.
+    double dx2 = 0.0, step = 0.0;
+    for (unsigned int i=0; i<n; i++) {
+      double range = TrimAxes[i].GetControlMax() - TrimAxes[i].GetControlMin();
+      x1[i] = Constrain(TrimAxes[i].GetControlMin(), x[i]+dx[i],
+                        TrimAxes[i].GetControlMax());
+      dx[i] = x1[i] - x[i];
+      dx2 += dx[i]*dx[i];
+      step += dx[i]*dx[i]/(range*range);
+    }
+
+    // The controls are saturated: the step is cut down to nothing by their
+    // limits and the residuals can only be decreased by a new jacobian.
+    if (step <= 1E-20) {
+      if (fresh_jacobian) break;
+      need_jacobian = true;
+      continue;
+    }
+
+    evaluate(x1, r1);
+    at_solution = false;
+
+    if (cost(r1) < cost(r)) {
+      // Broyden's update: J += (dr - J dx) dx^T / (dx^T dx)
+      for (unsigned int i=0; i<n; i++) {
+        double y = r1[i] - r[i];
+        for (unsigned int j=0; j<n; j++) y -= J[i*n+j]*dx[j];
+        for (unsigned int j=0; j<n; j++) J[i*n+j] += y*dx[j]/dx2;
+      }
+      x = x1;
+      r = r1;
+      at_solution = true;
+      fresh_jacobian = false;
+      lambda = max(0.1*lambda, 1E-9);
+    } else if (fresh_jacobian) {
+      // Take a shorter step, closer to the direction of the gradient.
+      if (lambda > 1E8) break;
+      lambda *= 10.0;
+    } else
+      need_jacobian = true;
+  }
+
+  // Leave the model and the axes at the best controls found.
+  if (!at_solution) evaluate(x, r);
+
+  return converged(r);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 void FGTrim::setupPullup() {
@@ -67,6 +67,8 @@ class FGFDMExec;
 typedef enum { tLongitudinal=0, tFull, tGround, tPullup,
                tCustom, tTurn, tNone } TrimMode;
 
+typedef enum { tAxisByAxis=0, tNewton } TrimSolver;
+
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
@@ -139,6 +141,9 @@ class JSBSIM_API FGTrim : public FGJSBBase
   double xlo,xhi,alo,ahi;
   double targetNlf;
   int debug_axis;
+  std::vector<double> initial_controls;
+  TrimSolver solver;
+  unsigned int model_runs;
 
   double psidot;
 
@@ -158,6 +163,19 @@ class JSBSIM_API FGTrim : public FGJSBBase
 
   bool checkLimits(FGTrimAxis& axis);
 
+  /** Solves all the axes at once with a Levenberg-Marquardt method.
+      @param N returns the number of iterations
+      @return true if all the axes are in tolerance */
+  bool solveNewton(unsigned int& N);
+
+  /** Sets the controls of all the axes then runs the model until the states
+      are steady.
+      @param controls one value per axis
+      @param residuals returns the states of the axes divided by their
+             tolerance */
+  void evaluate(const std::vector<double>& controls,
+                std::vector<double>& residuals);
+
   void setupPullup(void);
   void setupTurn(void);
 
@@ -203,6 +221,13 @@ public:
   */
   void TrimStats();
 
+  /** Get the number of iterations of the last trim: the sweeps through the
+      axes for tAxisByAxis or the steps of the solver for tNewton. */
+  unsigned int GetIterations(void) const { return total_its; }
+
+  /** Get the number of times the model was run by the last trim. */
+  unsigned int GetModelRuns(void);
+
   /** Clear all state-control pairs and set a predefined trim mode
       @param tm the set of axes to trim. Can be:
              tLongitudinal, tFull, tGround, tCustom, or tNone
@@ -238,7 +263,8 @@ public:
 
   /** automatically switch to trimming longitudinal acceleration with
       flight path angle (gamma) once it becomes apparent that there
-      is not enough/too much thrust.
+      is not enough/too much thrust. The fallback is only used by the
+      tAxisByAxis solver: the tNewton solver ignores it (see SetSolver()).
       @param bb true to enable fallback
   */
   inline void SetGammaFallback(bool bb) { gamma_fallback=bb; }
@@ -285,6 +311,36 @@ public:
   */
   inline void DebugState(State state) { debug_axis=state; }
 
+  /** Set the values from which the search of the controls starts, typically
+      the controls of a trim solved in nearby conditions (see GetControls()).
+      The search then begins in the neighborhood of these values instead of
+      spanning the whole range of each control.
+      @param controls one value per axis, in the order in which the axes are
+             configured. An empty vector restores the default start at the
+             middle of the ranges.
+  */
+  void SetInitialControls(const std::vector<double>& controls) {
+    initial_controls = controls;
+  }
+
+  /** Get the value of the control of each axis, in the order in which the
+      axes are configured.
+  */
+  std::vector<double> GetControls(void);
+
+  /** Select the algorithm that solves the axes.
+      @param ts can be:
+      - tAxisByAxis (the default) zeroes each state in turn with its control
+        and sweeps through the axes until they are all in tolerance.
+      - tNewton adjusts all the controls at once with a Levenberg-Marquardt
+        method. The jacobian is computed by finite differences then updated
+        from the steps taken (Broyden's method) so the model is run much less
+        often when the axes are coupled. The gamma fallback is not available
+        with this solver.
+  */
+  inline void SetSolver(TrimSolver ts) { solver = ts; }
+  inline TrimSolver GetSolver(void) const { return solver; }
+
   inline void SetTargetNlf(double nlf) { targetNlf=nlf; }
   inline double GetTargetNlf(void) { return targetNlf; }
 
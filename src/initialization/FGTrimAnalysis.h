@@ -27,6 +27,7 @@
  HISTORY
 --------------------------------------------------------------------------------
 12/14/06   ADM   Created
+10/18/26   DA    Ported to FGNelderMead, added FGTrimMap
 
 
 FUNCTIONAL DESCRIPTION
@@ -49,36 +50,15 @@ SENTRY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
-#include "FGFDMExec.h"
-#include "FGJSBBase.h"
-#include "FGTrimAnalysisControl.h"
-
-#include "models/FGAtmosphere.h"
-#include "initialization/FGInitialCondition.h"
-#include "models/FGAircraft.h"
-#include "models/FGMassBalance.h"
-#include "models/FGGroundReactions.h"
-#include "models/FGInertial.h"
-#include "models/FGAerodynamics.h"
-#include "math/FGColumnVector3.h"
-#include "models/FGAuxiliary.h"
-#include "models/FGPropulsion.h"
-
-#include <vector>
-#include <map>
+#include <fstream>
+#include <memory>
 #include <string>
+#include <vector>
 
-#include "math/direct_search/vec.h"
-
-/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
-DEFINITIONS
-%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
-
-#define ID_FGTRIMANALYSIS "$Id: FGTrimAnalysis.h,v 1.8 2009/10/02 10:30:09 jberndt Exp $"
-
-#if defined(_WIN32) && !defined(__CYGWIN__)
-  #define snprintf _snprintf
-#endif
+#include "FGJSBBase.h"
+#include "FGInitialCondition.h"
+#include "FGTrimAnalysisControl.h"
+#include "simgear/misc/sg_path.hxx"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
@@ -86,6 +66,8 @@ FORWARD DECLARATIONS
 
 namespace JSBSim {
 
+class FGFDMExec;
+
 typedef enum { taLongitudinal=0, taFull, taFullWingsLevel, taTurn, taPullup, taTurnFull,
                 taGround, taCustom, taNone } TrimAnalysisMode;
 
@@ -93,7 +75,31 @@ typedef enum { taLongitudinal=0, taFull, taFullWingsLevel, taTurn, taPullup, taT
 CLASS DOCUMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
-/** The trimming routine for JSBSim.
+/** The trim analysis routine for JSBSim.
+
+    The trim is the minimum of the cost function
+
+      f = udot^2 + vdot^2 + wdot^2 + 0.01 (pdot^2 + qdot^2 + rdot^2)
+
+    (udot^2 + wdot^2 + 0.01 qdot^2 for the longitudinal trim) over the controls of the trim mode, searched by the simplex method of
+    FGNelderMead within the limits of each control. The velocity relative to
+    the air is given by the true airspeed, the flight path angle and the
+    heading of the initial conditions and is held while the Euler angles are
+    adjusted. The cost of each candidate is computed by running the models
+    from these initial conditions until the accelerations are steady. The
+    variables of the modes are:
+
+    - taLongitudinal: throttle, elevator, theta.
+    - taFull: throttle, elevator, aileron, rudder, phi, theta, psi.
+    - taFullWingsLevel: throttle, elevator, aileron, rudder, theta, psi.
+    - taTurn: throttle, elevator, aileron, rudder, theta. The heading is
+      aligned with the velocity and phi is computed from the target load
+      factor, so the turn has no sideslip: aircraft that need some (such as
+      single engine propeller aircraft) should be trimmed with taTurnFull.
+    - taTurnFull: throttle, elevator, aileron, rudder, theta, psi. Phi is
+      computed from the target load factor.
+    - taPullup: throttle, elevator, aileron, rudder, theta. The pitch rate is
+      computed from the target load factor.
 
     Note that trims can (and do) fail for reasons that are completely outside
     the control of the trimming routine itself. The most common problem is the
@@ -101,15 +107,36 @@ CLASS DOCUMENTATION
     at those conditions?  Check the speed, altitude, configuration (flaps,
     gear, etc.), weight, cg, and anything else that may be relevant.
 
+    The settings of the search can be read from a trim configuration file:
+
+    @code
+<trim_config name="c172-cruise">
+  <search type="Nelder-Mead">
+    <gamma_nm> 2.0 </gamma_nm>
+    <tolerance value="1e-8"/>
+    <max_iterations value="2000"/>
+  </search>
+  <theta unit="DEG"> 2 </theta>
+  <nlf> 1.5 </nlf>
+  <throttle_cmd step_size="0.1"> 0.6 </throttle_cmd>
+  <elevator_cmd step_size="0.05"/>
+  <output_file name="trim_history.csv"/>
+</trim_config>
+    @endcode
+
+    The elements phi, theta, psi, throttle_cmd, elevator_cmd, aileron_cmd and
+    rudder_cmd set the initial value and the initial step of the variables,
+    gamma the flight path angle and nlf the target load factor. The output
+    file receives a line each time the search improves the cost.
+
     Example usage:
     @code
     FGFDMExec* FDMExec = new FGFDMExec();
-
-    FGInitialCondition* fgic = new FGInitialCondition(FDMExec);
-    FGTrimAnalysis fgta(FDMExec, fgic, taFull);
-    fgic->SetVcaibratedKtsIC(100);
-    fgic->SetAltitudeFtIC(1000);
-    fgic->SetClimbRate(500);
+    ...
+    FDMExec->GetIC()->SetVcalibratedKtsIC(100);
+    FDMExec->GetIC()->SetAltitudeASLFtIC(1000);
+    FDMExec->RunIC();
+    FGTrimAnalysis fgta(FDMExec, taFull);
     if( !fgta.DoTrim() ) {
       cout << "Trim Failed" << endl;
     }
@@ -117,316 +144,15 @@ CLASS DOCUMENTATION
     @endcode
 
     @author Agostino De Marco
-    @version "$Id: FGTrimAnalysis.h,v 1.8 2009/10/02 10:30:09 jberndt Exp $"
+    @see FGTrimMap
 */
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DECLARATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
-class FGTrimAnalysis;
-
-class Objective {
-public:
-    /** Constructor
-    */
-    Objective(FGFDMExec* fdmex, FGTrimAnalysis* ta, double x);
-    /** Destructor
-    */
-    ~Objective() {}
-
-    /** Full Trim cost function
-        @param vars number ofcontrol varables
-        @param v reference to a vector containing controls variables
-        @param f function value
-
-        Note: the effective cost function evaluation is performed in a private function
-    */
-    void CostFunctionFull                (long vars, Vector<double> &v, double & f);
-    /** Wings Level Trim cost function
-        @param vars number ofcontrol varables
-        @param v reference to a vector containing controls variables
-        @param f function value
-
-        Note: the effective cost function evaluation is performed in a private function
-    */
-    void CostFunctionFullWingsLevel      (long vars, Vector<double> &v, double & f);
-    /** Longitudinal Trim cost function
-        @param vars number ofcontrol varables
-        @param v reference to a vector containing controls variables
-        @param f function value
-
-        Note: the effective cost function evaluation is performed in a private function
-    */
-    void CostFunctionLongitudinal        (long vars, Vector<double> &v, double & f);
-    /** Steady Turn Trim cost function
-        @param vars number ofcontrol varables
-        @param v reference to a vector containing controls variables
-        @param f function value
-
-        Note: the effective cost function evaluation is performed in a private function
-    */
-    void CostFunctionFullTurn (long vars, Vector<double> &v, double & f);
-    /** Steady Turn Trim cost function, NON-coordinated
-        @param vars number ofcontrol varables
-        @param v reference to a vector containing controls variables
-        @param f function value
-
-        Note: the effective cost function evaluation is performed in a private function
-    */
-    void CostFunctionFullCoordinatedTurn (long vars, Vector<double> &v, double & f);
-
-    /** Pullup Trim cost function
-        @param vars number ofcontrol varables
-        @param v reference to a vector containing controls variables
-        @param f function value
-
-        Note: the effective cost function evaluation is performed in a private function
-    */
-    void CostFunctionPullUp              (long vars, Vector<double> &v, double & f);
-
-    /** Wrapping function for the effective Full Trim cost function, to be called by optimization method
-        @param vars number ofcontrol varables
-        @param v reference to a vector containing controls variables
-        @param f function value
-        @param success
-        @param t_ptr
-     * the following method is friend rather then member of FGTrimAnalysis because
-     * we want our FGTrimAnalysis::DoTrim() to be able to pass pointers to it.
-     *
-     * Note that in the call masked by this methods, the void pointer
-     * should be cast to a pointer of the class type.
-     */
-    friend void find_CostFunctionFull(long vars, Vector<double> &v, double & f,
-                    bool & success, void* t_ptr);
-    /* function definiation moved outside of class declaration */
-
-    /** Wrapping function for the effective Wings Level Trim cost function, to be called by optimization method
-        @param vars number ofcontrol varables
-        @param v reference to a vector containing controls variables
-        @param f function value
-        @param success
-        @param t_ptr
-     * the following method is friend rather then member of FGTrimAnalysis because
-     * we want our FGTrimAnalysis::DoTrim() to be able to pass pointers to it.
-     *
-     * Note that in the call masked by this methods, the void pointer
-     * should be cast to a pointer of the class type.
-     */
-    friend void find_CostFunctionFullWingsLevel(long vars, Vector<double> &v, double & f,
-                    bool & success, void* t_ptr);
-    /* function definiation moved outside of class declaration */
-
-    /** Wrapping function for the effective Longitudinal Trim cost function, to be called by optimization method
-        @param vars number ofcontrol varables
-        @param v reference to a vector containing controls variables
-        @param f function value
-        @param success
-        @param t_ptr
-     * the following method is friend rather then member of FGTrimAnalysis because
-     * we want our FGTrimAnalysis::DoTrim() to be able to pass pointers to it.
-     *
-     * Note that in the call masked by this methods, the void pointer
-     * should be cast to a pointer of the class type.
-     */
-    friend void find_CostFunctionLongitudinal(long vars, Vector<double> &v, double & f,
-                    bool & success, void* t_ptr);
-    /* function definiation moved outside of class declaration */
-
-    /** Wrapping function for the effective Steady Turn Trim cost function, to be called by optimization method
-        @param vars number ofcontrol varables
-        @param v reference to a vector containing controls variables
-        @param f function value
-        @param success
-        @param t_ptr
-     * the following method is friend rather then member of FGTrimAnalysis because
-     * we want our FGTrimAnalysis::DoTrim() to be able to pass pointers to it.
-     *
-     * Note that in the call masked by this methods, the void pointer
-     * should be cast to a pointer of the class type.
-     */
-    friend void find_CostFunctionFullCoordinatedTurn(long vars, Vector<double> &v, double & f,
-                    bool & success, void* t_ptr);
-    /* function definiation moved outside of class declaration */
-
-    /** Wrapping function for the effective Steady Turn Trim cost function, to be called by optimization method
-        @param vars number ofcontrol varables
-        @param v reference to a vector containing controls variables
-        @param f function value
-        @param success
-        @param t_ptr
-     * the following method is friend rather then member of FGTrimAnalysis because
-     * we want our FGTrimAnalysis::DoTrim() to be able to pass pointers to it.
-     *
-     * Note that in the call masked by this methods, the void pointer
-     * should be cast to a pointer of the class type.
-     */
-    friend void find_CostFunctionFullTurn(long vars, Vector<double> &v, double & f,
-                    bool & success, void* t_ptr);
-    /* function definiation moved outside of class declaration */
-
-    /** Wrapping function for the effective Pullup Trim cost function, to be called by optimization method
-        @param vars number ofcontrol varables
-        @param v reference to a vector containing controls variables
-        @param f function value
-        @param success
-        @param t_ptr
-     * the following method is friend rather then member of FGTrimAnalysis because
-     * we want our FGTrimAnalysis::DoTrim() to be able to pass pointers to it.
-     *
-     * Note that in the call masked by this methods, the void pointer
-     * should be cast to a pointer of the class type.
-     */
-    friend void find_CostFunctionPullUp(long vars, Vector<double> &v, double & f,
-                    bool & success, void* t_ptr);
-    /* function definiation moved outside of class declaration */
-
-    void Set_x_val(double new_x);
-    double Get_x_val() const {return _x;}
-
-    /** Pointer to cost function implementation
-    */
-    typedef void (*PF)(long vars, Vector<double> &v, double & f, bool & success, void* t_ptr);
-
-    map<TrimAnalysisMode,PF> mpCostFunctions; // primordial...
-
-private:
-    /**
-        Calculate state variables derivatives (udot, vdot, ...) as a function of control variables
-    */
-    void calculateDottedStates(double delta_cmd_T, double delta_cmd_E, double delta_cmd_A, double delta_cmd_R,
-                               double phi, double theta, double psi,
-                               TrimAnalysisMode trimMode,
-                               double& alpha, double& beta, double& gamma,
-                               //FGColumnVector3& vUVW, FGColumnVector3& vPQR,
-                               FGPropagate::VehicleState& VState,
-                               FGColumnVector3& vUVWdot, FGColumnVector3& vPQRdot );
-
-    /** Calculate cost function for Full Trim
-    */
-    double myCostFunctionFull                  (Vector<double> & vec1);
-    /** Calculate cost function for Wings Level Trim
-    */
-    double myCostFunctionFullWingsLevel        (Vector<double> & vec1);
-    /** Calculate cost function for Longitudinal Trim
-    */
-    double myCostFunctionLongitudinal          (Vector<double> & vec1);
-    /** Calculate cost function for Steady Turn Trim
-    */
-    double myCostFunctionFullCoordinatedTurn   (Vector<double> & vec1);
-    /** Calculate cost function for Steady Turn Trim, NON-Coordinated
-    */
-    double myCostFunctionFullTurn              (Vector<double> & vec1);
-    /** Calculate cost function for Pullup Trim
-    */
-    double myCostFunctionPullUp                (Vector<double> & vec1);
-
-    double _x;
-    FGFDMExec* FDMExec;
-    FGTrimAnalysis* TrimAnalysis;
-};
-
-
-class FGTrimAnalysis : public FGJSBBase, public FGXMLFileRead
+class JSBSIM_API FGTrimAnalysis : public FGJSBBase
 {
-private:
-  vector<FGTrimAnalysisControl*> vTrimAnalysisControls;
-  double cost_function_value;
-  unsigned int current_ctrl;
-  int N, Nsub;
-  TrimAnalysisMode mode;
-  int DebugLevel, Debug;
-
-  double dth;
-  bool trimudot;
-  bool gamma_fallback;
-
-  bool trim_failed;
-  unsigned int ctrl_count;
-
-  FGFDMExec* fdmex;
-  FGInitialCondition * fgic; // IC;
-
-  FGAuxiliary *        Auxiliary;
-  FGAerodynamics *     Aerodynamics;
-  FGPropulsion *       Propulsion;
-  FGFCS *              FCS;
-
-  vector<double> vAlphaDeg, vAlphaTrimDeg; // DEG !!!
-  vector<double> vCL, vCD, vCm;
-  vector<double> vCLE, vCDE, vCmE;
-  vector<vector <double> > mCL, mCD, mCm, mTa;
-  vector<double> vThrottleCmd, vElevatorCmd;
-  vector<double> vVn, vTn, vTa, vVnE, vTE;
-  vector<double> vCt, vCq, vRPM;
-  vector<vector <double> > mCt, mCq, mRPM;
-  vector<bool> hasThrustTrim, hasCmTrim;
-
-  string trim_id;
-
-  // direct search stuff
-  string search_type;
-  double sigma_nm, alpha_nm, beta_nm, gamma_nm;
-  double initial_step;
-  double tolerance;
-  string stop_criterion;
-  int max_iterations;
-  int total_its;
-
-  // results file
-  mutable ofstream rf; // see Stroustrup 10.2.7.2; alternative: use a cache struct
-  string rf_name;
-
-  double _u,_v,_w;
-  double _p,_q,_r;
-  //double uw,vw,ww;
-  //double vnorth,veast,vdown;
-  //double wnorth,weast,wdown;
-  double _alpha, _beta, _theta, _phi, _psi, _psiW, _gamma, _phiW;
-
-  double _stheta, _sphi, _spsi;
-  double _ctheta, _cphi, _cpsi;
-
-  double _vtIC, _hIC, _gammaIC, _rocIC, _vdownIC, _psiIC, _psigtIC, _vgIC,
-         _vnorthIC, _veastIC, wnorthIC, _weastIC, _wdownIC;
-
-  double _udot, _vdot, _wdot, _pdot, _qdot, _rdot;
-  double _targetNlf;
-  double _psiWdot, _phiWdot, _gammadot, _psidot, _thetadot;
-
-  double C1, C2, C3, _calpha, _salpha, _cbeta, _sbeta;
-
-  void setupPullup(void);
-  void setupTurn(void);
-  void setupTurn(double phiW); // recalculate target Nlf
-  void setupTurnPhi(double psi, double theta); // recalculate only phi
-
-  void updateRates(void);
-
-  void setDebug(void);
-
-  bool ensureRunning(void);
-  bool ensureRunning(unsigned int i);
-  bool runForAWhile(int nruns);
-
-  bool populateVecAlphaDeg(double vmin, double vmax, int n);
-  bool populateVecThrottleCmd(double vmin, double vmax, int n);
-  bool populateVecElevatorCmd(double vmin, double vmax, int n);
-
-  bool calculateAerodynamics(
-                           double dE_cmd,
-                           double Vt,
-                           double alpha_deg,
-                           double altitude,
-                           double rho,
-                           double S, double mac, double bw,
-                           double& CL, double& CD, double& Cm);
-
-
-  bool getSteadyState(int nrepeat);
-  bool InitializeTrimControl(double default_value, Element* el,
-                                           string unit, TaControl type);
-
 public:
   /** Initializes the trimming class
       @param FDMExec pointer to a JSBSim executive object.
@@ -437,22 +163,20 @@ public:
   /// Destructor
   ~FGTrimAnalysis(void);
 
-  friend class Objective;
-
   /** Loads the trim configuration from file.
       @param fname The name of a trim configuration file
-      @param useStoredPath true if the stored path to the trim config file should be used
+      @param useStoredPath true if the file name is relative to the aircraft
+             directory and has no extension
       @return true if successful */
-  bool Load(string fname, bool useStoredPath = true );
+  bool Load(const SGPath& fname, bool useStoredPath = true );
 
   /** Execute the trim
+      @return true if the cost function is below the tolerance
   */
   bool DoTrim(void);
 
- /** Print the results of the trim. For each axis trimmed, this
-      includes the final state value, control value, and tolerance
-      used.
-      @return true if trim succeeds
+  /** Print the results of the trim: the state of the aircraft, the value of
+      the variables and the initial and final flight conditions.
   */
   void Report(void);
 
@@ -460,22 +184,12 @@ public:
   */
   void TrimStats();
 
-   /** Set the file where trim analysis results are written,
+  /** Set the file where trim analysis results are written,
       open and get ready
       @param name the file name
       @return true if file open is successful
   */
-  bool SetResultsFile(string name);
-
-  /** Get the pointer to the file where trim analysis results are written,
-      @return non null pointer if file is open
-  */
-  ofstream* GetResultsFile() const { if (rf.is_open()) return &rf; else return 0; } // const_cast<ofstream*>(&rf) (if rf is not mutable)
-
-  /** Set the value of the cost function
-      @param value the cost function value
-  */
-  inline void SetCostFunctionValue(double value){cost_function_value = value;}
+  bool SetResultsFile(const std::string& name);
 
   /** @return The current cost function value
   */
@@ -485,16 +199,18 @@ public:
       (Note: controls are intended here as those variables to be
              adjusted for attaining convergence of the trimming algorithm)
       @param tam the set of axes to trim. Can be:
-             taLongitudinal, taFull, taGround, taCustom, or taNone
+             taLongitudinal, taFull, taFullWingsLevel, taTurn, taTurnFull,
+             taPullup, taCustom, or taNone
   */
   void SetMode(TrimAnalysisMode tam);
 
   /** @return The Trim Analysis mode
-             taLongitudinal, taFull, taGround, taCustom, or taNone
   */
   inline TrimAnalysisMode GetMode() const { return mode;};
 
-  inline vector<FGTrimAnalysisControl*>* GetControls(){return &vTrimAnalysisControls;}
+  /** @return The variables of the trim, in the order of the search
+  */
+  inline std::vector<FGTrimAnalysisControl*>* GetControls(){return &vTrimAnalysisControls;}
 
   /** Clear all controls from the current configuration.
       The trimming routine must have at least one control
@@ -529,27 +245,8 @@ public:
   */
   bool EditState( TaControl new_control, double new_initvalue, double new_step, double new_min, double new_max );
 
-
-  /** Return the current flight path angle in TrimAnalysis object
-      @return value of gamma
-  */
-  inline double GetGamma() { return _gamma; }
-
-  /** automatically switch to trimming longitudinal acceleration with
-      flight path angle (gamma) once it becomes apparent that there
-      is not enough/too much thrust.
-      @param bb true to enable fallback
-  */
-  inline void SetGammaFallback(bool bb) { gamma_fallback=bb; }
-
-  /** query the fallback state
-      @return true if fallback is enabled.
-  */
-  inline bool GetGammaFallback(void) { return gamma_fallback; }
-
-  /** Set the iteration limit. DoTrim() will return false if limit
-      iterations are reached before trim is achieved.  The default
-      is 60.  This does not ordinarily need to be changed.
+  /** Set the iteration limit of the search. DoTrim() will return false if
+      the limit is reached before trim is achieved. The default is 2000.
       @param ii integer iteration limit
   */
   inline void SetMaxCycles(int ii) { max_iterations = ii; }
@@ -568,103 +265,74 @@ public:
   */
   inline double GetTolerance(void) {return tolerance; }
 
-  /** Sets trim result status
-      @param tf (boolean)
-  */
-  inline void SetTrimFailed(bool tf) { trim_failed = tf; }
   /** Gets trim result status
       @return trim_failed (boolean)
   */
   inline bool GetTrimFailed(void) { return trim_failed; }
-  inline void SetTrimSuccessfull() { trim_failed = false; }
-
-
-  /** Sets state variables
-      @param u0
-      @param v0
-      @param w0
-      @param p0
-      @param q0
-      @param r0
-      @param alpha0
-      @param beta0
-      @param phi0
-      @param psi0
-      @param theta0
-      @param gamma0
-  **/
-  void SetState(double u0, double v0, double w0, double p0, double q0, double r0,
-                double alpha0, double beta0, double phi0, double theta0, double psi0, double gamma0);
-
-  /** Sets Euler angles
-      @param phi0, theta0, psi0 **/
-  void SetEulerAngles(double phi0, double theta0, double psi0);
-
-  /** Gets Euler angle phi
-      @return phi [rad]
-  */
-  double GetPhiRad  (){ return _phi;}
-  /** Gets Euler angle theta
-      @return phi [rad]
-  */
-  double GetThetaRad(){ return _theta;}
-  /** Gets Euler angle psi
-      @return phi [rad]
-  */
-  double GetPsiRad  (){ return _psi;}
 
-  /** Gets Euler angle phiW (wind axes)
-      @return phiW [rad]
+  /** @return the number of iterations of the last search
   */
-  double GetPhiWRad  (){ return _phiW;}
-  /** Gets flight path angle
-      @return gamma [rad]
-  */
-  double GetGammaRad (){ return _gamma;}
-  /** Gets true speed [fps] from IC
-      @return Vt [fps]
-  */
-  double GetVtFps    (){ return _vtIC;}
-
-  /** Calculate the wind axis bank angle from a given Nlf (sets also the target Nlf)
-      @param nlf
-  */
-  void CalculatePhiWFromTargetNlfTurn(double nlf);
+  inline int GetIterations(void) const { return total_its; }
 
-  /** Updates angular rates for turn trim according to turning trim constraints
-      @param psi, theta, phi
-      @return p, q, r
+  /** @return the number of evaluations of the cost function of the last
+      search
   */
-  FGColumnVector3 UpdateRatesTurn(double psi, double theta, double phi, double phiW);
-
-  /** Updates angular rates for pull-up trim
-      @return p, q, r
-  */
-  FGColumnVector3 UpdateRatesPullup(void);
-
-  /** Sets Dotted values
-      @param udot, vdot, wdot, pdot, qdot, rdot **/
-  void SetDottedValues(double udot, double vdot, double wdot, double pdot, double qdot, double rdot);
+  inline int GetEvaluations(void) const { return total_evals; }
 
   /**
-    Debug level 1 shows results of each top-level iteration
-    Debug level 2 shows level 1 & results of each per-axis iteration
+    Debug level 1 shows the result of the search
+    Debug level 2 shows level 1 & the convergence of the simplex
   */
   inline void SetDebug(int level) { DebugLevel = level; }
   inline void ClearDebug(void) { DebugLevel = 0; }
 
-  /** Sets target normal load factor in steady turn
+  /** Sets target normal load factor in steady turn or pullup
       @param nlf target normal load factor **/
   inline void SetTargetNlf(double nlf) { _targetNlf=nlf; }
 
-  /** Gets target normal load factor in steady turn
+  /** Gets target normal load factor in steady turn or pullup
       @return _targetNlf
   */
   inline double GetTargetNlf(void) { return _targetNlf; }
 
-  //void eom_costf (long vars, Vector<double> &x, double & f, bool& flag, void* an_obj);
-  //inline FGFDMExec* GetFDMExec() const { return fdmex; }
+private:
+  class Objective;
+
+  std::vector<FGTrimAnalysisControl*> vTrimAnalysisControls;
+  double cost_function_value;
+  TrimAnalysisMode mode;
+  int DebugLevel;
+
+  bool trim_failed;
+
+  FGFDMExec* fdmex;
+  FGInitialCondition fgic;
+
+  std::string trim_id;
+
+  // direct search stuff
+  std::string search_type;
+  double gamma_nm;
+  double tolerance;
+  int max_iterations;
+  int total_its;
+  int total_evals;
 
+  // results file
+  std::ofstream rf;
+
+  double _vtIC, _gamma, _psigtIC;
+  double _targetNlf;
+  double _phiW, _psiWdot;
+
+  void setupFlightPath(void);
+  void setupTurnPhi(double psi, double theta);
+  void updateRates(void);
+
+  FGTrimAnalysisControl* createControl(TaControl control);
+  double costFunction(const std::vector<double>& x);
+  bool InitializeTrimControl(double default_value, Element* el,
+                             const std::string& unit, TaControl type);
 };
 }
 
@@ -42,20 +42,24 @@ SENTRY
 #endif
 
 #include <string>
-#include <stdlib.h>
+#include <cstdlib>
+#include <iostream>
 
 #include "FGFDMExec.h"
-#include "models/FGAtmosphere.h"
-#include "initialization/FGInitialCondition.h"
+#include "FGInitialCondition.h"
 #include "FGTrimAnalysisControl.h"
-#include "models/FGAircraft.h"
-#include "models/FGPropulsion.h"
+#include "models/FGAccelerations.h"
 #include "models/FGAerodynamics.h"
+#include "models/FGAuxiliary.h"
+#include "models/FGFCS.h"
+#include "models/FGGroundReactions.h"
+#include "models/FGPropagate.h"
+#include "models/FGPropulsion.h"
+#include "models/propulsion/FGEngine.h"
 
-namespace JSBSim {
+using namespace std;
 
-IDENT(IdSrc,"$Id: FGTrimAnalysisControl.cpp,v 1.7 2014/01/13 10:46:00 ehofman Exp $");
-IDENT(IdHdr,ID_TRIMANALYSISCONTROL);
+namespace JSBSim {
 
 /*****************************************************************************/
 
@@ -72,7 +76,7 @@ FGTrimAnalysisControl::FGTrimAnalysisControl(FGFDMExec* fdex, FGInitialCondition
   control_convert=1.0;
   state_value=0;
   state_target=0;
-  control_tolerance = DEFAULT_TOLERANCE;
+  control_tolerance = DEFAULT_TRIM_ANALYSIS_TOLERANCE;
 
   switch(control) {
   case taThrottle:
@@ -153,24 +157,30 @@ FGTrimAnalysisControl::FGTrimAnalysisControl(FGFDMExec* fdex, FGInitialCondition
     break;
   case taPhi:
     control_name = "Phi (rad)";
-    control_min=fdmex->GetPropagate()->GetEuler(ePhi) - 30*degtorad;
-    control_max=fdmex->GetPropagate()->GetEuler(ePhi) + 30*degtorad;
+    control_min=fgic->GetPhiRadIC() - 30*degtorad;
+    control_max=fgic->GetPhiRadIC() + 30*degtorad;
     control_step=1*degtorad;
+    control_initial_value = fgic->GetPhiRadIC();
+    control_value = control_initial_value;
     state_convert=radtodeg;
     control_convert=radtodeg;
     break;
   case taTheta:
     control_name = "Theta (rad)";
-    control_min=fdmex->GetPropagate()->GetEuler(eTht) - 5*degtorad;
-    control_max=fdmex->GetPropagate()->GetEuler(eTht) + 5*degtorad;
+    control_min=fgic->GetThetaRadIC() - 5*degtorad;
+    control_max=fgic->GetThetaRadIC() + 5*degtorad;
     control_step=1*degtorad;
+    control_initial_value = fgic->GetThetaRadIC();
+    control_value = control_initial_value;
     state_convert=radtodeg;
     break;
   case taHeading:
     control_name = "Heading (rad)";
-    control_min=fdmex->GetPropagate()->GetEuler(ePsi) - 30*degtorad;
-    control_max=fdmex->GetPropagate()->GetEuler(ePsi) + 30*degtorad;
+    control_min=fgic->GetPsiRadIC() - 30*degtorad;
+    control_max=fgic->GetPsiRadIC() + 30*degtorad;
     control_step=1*degtorad;
+    control_initial_value = fgic->GetPsiRadIC();
+    control_value = control_initial_value;
     state_convert=radtodeg;
     break;
   case taGamma:
@@ -199,14 +209,14 @@ FGTrimAnalysisControl::~FGTrimAnalysisControl(void)
 
 void FGTrimAnalysisControl::getState(void) {
   switch(state) {
-  case taUdot: state_value=fdmex->GetPropagate()->GetUVWdot(1)-state_target; break;
-  case taVdot: state_value=fdmex->GetPropagate()->GetUVWdot(2)-state_target; break;
-  case taWdot: state_value=fdmex->GetPropagate()->GetUVWdot(3)-state_target; break;
-  case taPdot: state_value=fdmex->GetPropagate()->GetPQRdot(1)-state_target; break;
-  case taQdot: state_value=fdmex->GetPropagate()->GetPQRdot(2)-state_target;break;
-  case taRdot: state_value=fdmex->GetPropagate()->GetPQRdot(3)-state_target; break;
+  case taUdot: state_value=fdmex->GetAccelerations()->GetUVWdot(1)-state_target; break;
+  case taVdot: state_value=fdmex->GetAccelerations()->GetUVWdot(2)-state_target; break;
+  case taWdot: state_value=fdmex->GetAccelerations()->GetUVWdot(3)-state_target; break;
+  case taPdot: state_value=fdmex->GetAccelerations()->GetPQRdot(1)-state_target; break;
+  case taQdot: state_value=fdmex->GetAccelerations()->GetPQRdot(2)-state_target;break;
+  case taRdot: state_value=fdmex->GetAccelerations()->GetPQRdot(3)-state_target; break;
   case taHmgt: state_value=computeHmgt()-state_target; break;
-  case taNlf:  state_value=fdmex->GetAircraft()->GetNlf()-state_target; break;
+  case taNlf:  state_value=fdmex->GetAuxiliary()->GetNlf()-state_target; break;
   case taAll: break;
   }
 }
@@ -222,9 +232,9 @@ void FGTrimAnalysisControl::getControl(void) {
   case taAlpha:     control_value=fdmex->GetAuxiliary()->Getalpha();  break;
   case taPitchTrim: control_value=fdmex->GetFCS()->GetPitchTrimCmd(); break;
   case taElevator:  control_value=fdmex->GetFCS()->GetDeCmd(); break;
-  case taRollTrim:
+  case taRollTrim:  control_value=fdmex->GetFCS()->GetRollTrimCmd(); break;
   case taAileron:   control_value=fdmex->GetFCS()->GetDaCmd(); break;
-  case taYawTrim:
+  case taYawTrim:   control_value=fdmex->GetFCS()->GetYawTrimCmd(); break;
   case taRudder:    control_value=fdmex->GetFCS()->GetDrCmd(); break;
   case taAltAGL:    control_value=fdmex->GetPropagate()->GetDistanceAGL();break;
   case taTheta:     control_value=fdmex->GetPropagate()->GetEuler(eTht); break;
@@ -262,9 +272,9 @@ void FGTrimAnalysisControl::setControl(void) {
   case taAlpha:     fgic->SetAlphaRadIC(control_value);  break;
   case taPitchTrim: fdmex->GetFCS()->SetPitchTrimCmd(control_value); break;
   case taElevator:  fdmex->GetFCS()->SetDeCmd(control_value); break;
-  case taRollTrim:
+  case taRollTrim:  fdmex->GetFCS()->SetRollTrimCmd(control_value); break;
   case taAileron:   fdmex->GetFCS()->SetDaCmd(control_value); break;
-  case taYawTrim:
+  case taYawTrim:   fdmex->GetFCS()->SetYawTrimCmd(control_value); break;
   case taRudder:    fdmex->GetFCS()->SetDrCmd(control_value); break;
   case taAltAGL:    fgic->SetAltitudeAGLFtIC(control_value); break;
   case taTheta:     fgic->SetThetaRadIC(control_value); break;
@@ -305,7 +315,8 @@ void FGTrimAnalysisControl::SetThetaOnGround(double ff) {
   if((ref < 0) && (center >= 0)) {
     ref=center;
   }
-  cout << "SetThetaOnGround ref gear: " << ref << endl;
+  if (debug_lvl > 0)
+    cout << "SetThetaOnGround ref gear: " << ref << endl;
   if(ref >= 0) {
     double sp = fdmex->GetPropagate()->GetSinEuler(ePhi);
     double cp = fdmex->GetPropagate()->GetCosEuler(ePhi);
@@ -317,10 +328,12 @@ void FGTrimAnalysisControl::SetThetaOnGround(double ff) {
                     lz*cp*cos(ff);
 
     fgic->SetAltitudeAGLFtIC(hagl);
-    cout << "SetThetaOnGround new alt: " << hagl << endl;
+    if (debug_lvl > 0)
+      cout << "SetThetaOnGround new alt: " << hagl << endl;
   }
   fgic->SetThetaRadIC(ff);
-  cout << "SetThetaOnGround new theta: " << ff << endl;
+  if (debug_lvl > 0)
+    cout << "SetThetaOnGround new theta: " << ff << endl;
 }
 
 /*****************************************************************************/
@@ -365,13 +378,15 @@ bool FGTrimAnalysisControl::initTheta(void) {
   zDiff = zForward - zAft;
   level=false;
   theta=fgic->GetThetaDegIC();
+  i=0;
   while(!level && (i < 100)) {
     theta+=radtodeg*atan(zDiff/xDiff);
     fgic->SetThetaDegIC(theta);
-    fdmex->SuspendIntegration();
+    bool suspended = fdmex->IntegrationSuspended();
+    if (!suspended) fdmex->SuspendIntegration();
     fdmex->Initialize(fgic);
     fdmex->Run();
-    fdmex->ResumeIntegration();
+    if (!suspended) fdmex->ResumeIntegration();
     zAft=fdmex->GetGroundReactions()->GetGearUnit(iAft)->GetLocalGear(3);
     zForward=fdmex->GetGroundReactions()->GetGearUnit(iForward)->GetLocalGear(3);
     zDiff = zForward - zAft;
@@ -387,8 +402,8 @@ bool FGTrimAnalysisControl::initTheta(void) {
       cout << "    Initial Theta: " << fdmex->GetPropagate()->GetEuler(eTht)*radtodeg << endl;
       cout << "    Used gear unit " << iAft << " as aft and " << iForward << " as forward" << endl;
   }
-  control_min=(theta+5)*degtorad;
-  control_max=(theta-5)*degtorad;
+  control_min=(theta-5)*degtorad;
+  control_max=(theta+5)*degtorad;
   fgic->SetAltitudeAGLFtIC(saveAlt);
   if(i < 100)
     return true;
@@ -439,14 +454,8 @@ void FGTrimAnalysisControl::setThrottlesPct(void) {
   for(unsigned i=0;i<fdmex->GetPropulsion()->GetNumEngines();i++) {
       tMin=fdmex->GetPropulsion()->GetEngine(i)->GetThrottleMin();
       tMax=fdmex->GetPropulsion()->GetEngine(i)->GetThrottleMax();
-      //cout << "setThrottlespct: " << i << ", " << control_min << ", " << control_max << ", " << control_value;
       fdmex->GetFCS()->SetThrottleCmd(i,tMin+control_value*(tMax-tMin));
-      //cout << "setThrottlespct: " << fdmex->GetFCS()->GetThrottleCmd(i) << endl;
-      fdmex->SuspendIntegration();
-      fdmex->Initialize(fgic);
-      fdmex->Run();
-      fdmex->ResumeIntegration();
-      fdmex->GetPropulsion()->GetSteadyState();
+      fdmex->GetPropulsion()->in.ThrottlePos[i] = tMin+control_value*(tMax-tMin);
   }
 }
 
@@ -491,11 +500,5 @@ void FGTrimAnalysisControl::Debug(int from)
   }
   if (debug_lvl & 16) { // Sanity checking
   }
-  if (debug_lvl & 64) {
-    if (from == 0) { // Constructor
-      cout << IdSrc << endl;
-      cout << IdHdr << endl;
-    }
-  }
 }
 }
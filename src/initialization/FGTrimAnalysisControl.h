@@ -46,16 +46,12 @@ INCLUDES
 
 #include <string>
 
-#include "FGFDMExec.h"
 #include "FGJSBBase.h"
-#include "initialization/FGInitialCondition.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 DEFINITIONS
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
-#define ID_TRIMANALYSISCONTROL "$Id: FGTrimAnalysisControl.h,v 1.2 2009/10/02 10:30:09 jberndt Exp $"
-
 #define DEFAULT_TRIM_ANALYSIS_TOLERANCE 0.00000001
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -64,6 +60,7 @@ FORWARD DECLARATIONS
 
 namespace JSBSim {
 
+class FGFDMExec;
 class FGInitialCondition;
 
 /**
@@ -108,6 +105,11 @@ public:
       function until the desired trimming condition falls inside a tolerance.*/
   void Run(void);
 
+  /** Sets the control value to the FCS or to the initial conditions. The
+      model is not run: the caller initializes it from the initial
+      conditions once all the controls are applied. */
+  void ApplyControl(void) { setControl(); }
+
   //double GetState(void) { getState(); return state_value; }
   //Accels are not settable
 
@@ -132,7 +134,7 @@ public:
   /** Gets the control name
       @return control name
   */
-  inline string GetControlName(void) { return control_name; }
+  inline std::string GetControlName(void) { return control_name; }
 
   /** Gets the control minimum value
       @return control min value
@@ -221,7 +223,7 @@ private:
   TaState   state;
   TaControl control;
 
-  string control_name;
+  std::string control_name;
 
   double state_target;
 
@@ -103,6 +103,9 @@ public:
   void Run(void);
  
   double GetState(void) { getState(); return state_value; }
+  /** Applies the control to the initial conditions or to the FCS without
+      running the model. */
+  void ApplyControl(void) { setControl(); }
   //Accels are not settable
   inline void SetControl(double value ) { control_value=value; }
   inline double GetControl(void) { return control_value; }
@@ -0,0 +1,237 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+  Module:       FGTrimMap.cpp
+  Author:       Dawn Aerospace
+  Date started: October 2026
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU Lesser General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option) any
+  later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+
+  You should have received a copy of the GNU Lesser General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc., 59
+  Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+  Further information about the GNU Lesser General Public License can also be
+  found on the world wide web at http://www.gnu.org.
+
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  INCLUDES
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+
+#include "FGTrimMap.h"
+#include "FGFDMExec.h"
+#include "FGTrimAnalysis.h"
+#include "input_output/FGXMLElement.h"
+#include "models/FGAuxiliary.h"
+#include "models/FGFCS.h"
+#include "models/FGPropagate.h"
+#include "models/FGPropulsion.h"
+#include "models/propulsion/FGEngine.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  CLASS IMPLEMENTATION
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace {
+
+const struct {
+  const char* name;
+  TrimAnalysisMode mode;
+} Modes[] = {
+  {"longitudinal", taLongitudinal},
+  {"full", taFull},
+  {"full-wings-level", taFullWingsLevel},
+  {"turn", taTurn},
+  {"turn-full", taTurnFull},
+  {"pullup", taPullup}
+};
+
+// The columns of the map that follow the values of the axes.
+const char* Columns[] = {
+  "success", "cost", "throttle", "elevator", "aileron", "rudder",
+  "alpha (deg)", "beta (deg)", "phi (deg)", "theta (deg)", "psi (deg)",
+  "thrust (lbs)"
+};
+const size_t NumColumns = sizeof(Columns)/sizeof(Columns[0]);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGTrimMap::FGTrimMap(void)
+  : FGBatchPool("trim_map", "trim map"), Mode(taFull), NumFailedPoints(0)
+{
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGTrimMap::~FGTrimMap()
+{
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGTrimMap::LoadSpecification(Element* document)
+{
+  TrimConfigName = SGPath();
+
+  string mode = document->GetAttributeValue("mode");
+  if (mode.empty()) mode = "full";
+  auto it = find_if(begin(Modes), end(Modes),
+                    [&mode](const auto& m) { return mode == m.name; });
+  if (it == end(Modes)) {
+    cerr << document->ReadFrom() << fgred << "Unknown trim mode " << mode
+         << reset << endl;
+    return false;
+  }
+  Mode = it->mode;
+
+  Element* element = document->FindElement("trim_config");
+  if (element) {
+    if (element->GetAttributeValue("file").empty()) {
+      cerr << element->ReadFrom() << fgred
+           << "The trim configuration must name a file." << reset << endl;
+      return false;
+    }
+    TrimConfigName = SGPath::fromUtf8(element->GetAttributeValue("file"));
+  }
+
+  return LoadGrid(document);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGTrimMap::Run(void)
+{
+  auto start = chrono::steady_clock::now();
+
+  NumFailedPoints = 0;
+  if (!LoadTemplate({})) return false;
+
+  size_t npoints = GetNumPoints();
+  Results.assign(npoints, Result());
+
+  unsigned int nthreads = RunTasks(npoints);
+  ReleaseTemplate();
+  if (nthreads == 0) return false;
+
+  for (const auto& result: Results)
+    if (!result.trimmed) NumFailedPoints++;
+
+  if (!WriteMap()) return false;
+
+  if (debug_lvl > 0) {
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+    cout << endl << highint << npoints << " points trimmed ("
+         << NumFailedPoints << " failed) in " << elapsed.count() << " s with "
+         << nthreads << " threads" << reset << endl;
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTrimMap::RunTask(FGFDMExec* fdmex, size_t point)
+{
+  try {
+    RestoreInitialState(fdmex);
+    SolvePoint(fdmex, point, Results[point]);
+    if (!Results[point].trimmed)
+      cerr << fgred << "Point " << point << " could not be trimmed." << reset
+           << endl;
+  } catch (const exception& e) {
+    cerr << fgred << "Point " << point << " failed: " << e.what() << reset
+         << endl;
+    Results[point] = Result();
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTrimMap::SolvePoint(FGFDMExec* fdmex, size_t point, Result& result)
+{
+  SetGridPoint(fdmex, point);
+
+  FGTrimAnalysis trim(fdmex, static_cast<TrimAnalysisMode>(Mode));
+  if (!TrimConfigName.isNull() && !trim.Load(RootDir/TrimConfigName.utf8Str(), false))
+    throw BaseException("The trim configuration could not be loaded.");
+  result.trimmed = trim.DoTrim();
+
+  auto FCS = fdmex->GetFCS();
+  auto Auxiliary = fdmex->GetAuxiliary();
+  auto Propagate = fdmex->GetPropagate();
+  auto Propulsion = fdmex->GetPropulsion();
+
+  double throttle = 0.0, thrust = 0.0;
+  for (unsigned int i=0; i<Propulsion->GetNumEngines(); ++i) {
+    auto engine = Propulsion->GetEngine(i);
+    thrust += engine->GetThrust();
+    if (i == 0) {
+      double tMin = engine->GetThrottleMin();
+      double tMax = engine->GetThrottleMax();
+      throttle = (FCS->GetThrottleCmd(0) - tMin)/(tMax - tMin);
+    }
+  }
+
+  result.values = {
+    trim.GetCostFunctionValue(), throttle, FCS->GetDeCmd(), FCS->GetDaCmd(),
+    FCS->GetDrCmd(), Auxiliary->Getalpha()*radtodeg,
+    Auxiliary->Getbeta()*radtodeg, Propagate->GetEuler(ePhi)*radtodeg,
+    Propagate->GetEuler(eTht)*radtodeg, Propagate->GetEuler(ePsi)*radtodeg,
+    thrust
+  };
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGTrimMap::WriteMap(void) const
+{
+  ofstream output(OutputName);
+  if (!output.is_open()) {
+    cerr << fgred << "Could not open the output file " << OutputName << reset
+         << endl;
+    return false;
+  }
+
+  for (const auto& axis: Axes)
+    output << axis.property << ", ";
+  for (size_t i=0; i<NumColumns; ++i)
+    output << Columns[i] << (i+1 < NumColumns ? ", " : "");
+  output << endl;
+
+  output << setprecision(10);
+  for (size_t point=0; point<Results.size(); ++point) {
+    for (double value: GetGridCoordinates(point))
+      output << value << ", ";
+
+    const Result& result = Results[point];
+    output << (result.trimmed ? 1 : 0);
+    // The columns of the points that could not be run are left empty.
+    for (size_t i=1; i<NumColumns; ++i) {
+      output << ", ";
+      if (i-1 < result.values.size()) output << result.values[i-1];
+    }
+    output << endl;
+  }
+
+  return output.good();
+}
+}
@@ -0,0 +1,134 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+  Header:       FGTrimMap.h
+  Author:       Dawn Aerospace
+  Date started: October 2026
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU Lesser General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option) any
+  later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+
+  You should have received a copy of the GNU Lesser General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc., 59
+  Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+  Further information about the GNU Lesser General Public License can also be
+  found on the world wide web at http://www.gnu.org.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGTRIMMAP_H
+#define FGTRIMMAP_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <string>
+#include <vector>
+
+#include "FGBatchPool.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+class FGFDMExec;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Maps the trim of an aircraft over a grid of flight conditions.
+
+    The grid is described by a specification file:
+
+    @code
+<trim_map threads="8" mode="full">
+  <script file="scripts/c1722.xml"/>
+  <trim_config file="aircraft/c172x/cruise_trim.xml"/>
+  <axis property="ic/h-sl-ft"> 2000 5000 8000 </axis>
+  <axis property="ic/vt-kts"> 90 105 120 </axis>
+  <set name="propulsion/set-running" value="-1"/>
+  <output file="c172_trim_map.csv"/>
+</trim_map>
+    @endcode
+
+    The script and trim configuration file names are relative to the root
+    directory while the output file is relative to the current directory. The
+    attribute threads is optional and defaults to the number of CPUs. The
+    attribute mode is one of longitudinal, full (the default),
+    full-wings-level, turn, turn-full or pullup (see FGTrimAnalysis). The trim
+    configuration is optional; its output_file element must be omitted since
+    the points are trimmed concurrently.
+
+    Each point of the grid sets the properties of the axes, runs the initial
+    conditions, applies the settings and searches the trim with
+    FGTrimAnalysis. The points are independent: they are shared between the
+    worker threads and each of them starts from the initial state of the
+    script (see FGBatchPool). The results therefore do not depend on the
+    number of threads.
+
+    The output is a CSV file with one line per point, in the order of the grid
+    (the last axis varies the fastest): the values of the axes, whether the
+    trim succeeded, the value of its cost function, the normalized throttle,
+    elevator, aileron and rudder commands, alpha, beta, phi, theta and psi in
+    degrees and the total thrust of the engines in pounds.
+  */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class JSBSIM_API FGTrimMap : public FGBatchPool
+{
+public:
+  FGTrimMap(void);
+  ~FGTrimMap();
+
+  /** Overrides the name of the output file of the specification file.
+      @param filename the name of the CSV file. */
+  void SetOutputFileName(const std::string& filename) { OutputName = filename; }
+
+  /// Returns the number of points of the grid.
+  size_t GetNumPoints(void) const { return GetGridSize(); }
+
+  /** Trims the points of the grid and writes the map.
+      @return false if the script cannot be loaded or if the output file
+              cannot be written. The points that cannot be trimmed are
+              reported by GetNumFailedPoints(). */
+  bool Run(void);
+
+  /// Returns the number of points that failed during the last call to Run().
+  unsigned int GetNumFailedPoints(void) const { return NumFailedPoints; }
+
+private:
+  struct Result {
+    bool trimmed = false;
+    std::vector<double> values;
+  };
+
+  SGPath TrimConfigName;
+  int Mode;
+
+  std::vector<Result> Results;
+  unsigned int NumFailedPoints;
+
+  bool LoadSpecification(Element* document) override;
+  void RunTask(FGFDMExec* fdmex, size_t point) override;
+  void SolvePoint(FGFDMExec* fdmex, size_t point, Result& result);
+  bool WriteMap(void) const;
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
@@ -36,7 +36,7 @@ namespace JSBSim
 {
 
 FGTrimmer::FGTrimmer(FGFDMExec * fdm, Constraints * constraints) :
-        m_fdm(fdm), m_constraints(constraints)
+        m_fdm(fdm), m_constraints(constraints), m_runCount(0)
 {
 }
 
@@ -76,7 +76,7 @@ std::vector<double> FGTrimmer::constrain(const std::vector<double> & dv)
     double cAlpha = cos(alpha);
 
     // turn coordination constraint, lewis pg. 190
-    double gd = m_fdm->GetInertial()->gravity();
+    double gd = m_fdm->GetInertial()->GetGravity().Magnitude();
     double gc = m_constraints->yawRate*vt/gd;
     double a = 1 - gc*tAlpha*sBeta;
     double b = sGam/cBeta;
@@ -143,22 +143,22 @@ std::vector<double> FGTrimmer::constrain(const std::vector<double> & dv)
     }
 
     // initialize
-    m_fdm->Initialize(m_fdm->GetIC());
+    m_fdm->Initialize(m_fdm->GetIC().get());
     for (unsigned int i=0; i<m_fdm->GetPropulsion()->GetNumEngines(); i++) {
         m_fdm->GetPropulsion()->GetEngine(i)->InitRunning();
     }
 
     // wait for stable state
+    m_fdm->SetTrimStatus(true);
+    m_fdm->DisableOutput();
+    m_fdm->SuspendIntegration();
     double cost = compute_cost();
     for(int i=0;;i++) {
-        m_fdm->GetPropulsion()->GetSteadyState();
-        m_fdm->SetTrimStatus(true);
-        m_fdm->DisableOutput();
-        m_fdm->SuspendIntegration();
+        // the steady state of the engines only depends on their inputs,
+        // which are loaded by the first run
+        if (i < 2) m_fdm->GetPropulsion()->GetSteadyState();
         m_fdm->Run();
-        m_fdm->SetTrimStatus(false);
-        m_fdm->EnableOutput();
-        m_fdm->ResumeIntegration();
+        m_runCount++;
 
         double costNew = compute_cost();
         double dcost = fabs(costNew - cost);
@@ -178,6 +178,9 @@ std::vector<double> FGTrimmer::constrain(const std::vector<double> & dv)
         }
         cost = costNew;
     }
+    m_fdm->SetTrimStatus(false);
+    m_fdm->EnableOutput();
+    m_fdm->ResumeIntegration();
 
     std::vector<double> data;
     data.push_back(phi);
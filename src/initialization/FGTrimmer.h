@@ -54,9 +54,11 @@ public:
         else if (val>max) val=max;
     }
     void setFdm(FGFDMExec * fdm) {m_fdm = fdm; }
+    unsigned int getRunCount() const { return m_runCount; }
 private:
     FGFDMExec * m_fdm;
     Constraints * m_constraints;
+    unsigned int m_runCount;
 };
 
 } // JSBSim
@@ -0,0 +1,208 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+  Module:       FGBinaryRecord.cpp
+  Author:       Dawn Aerospace
+  Date started: October 2026
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU Lesser General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option) any
+  later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+
+  You should have received a copy of the GNU Lesser General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc., 59
+  Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+  Further information about the GNU Lesser General Public License can also be
+  found on the world wide web at http://www.gnu.org.
+
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  INCLUDES
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstdint>
+#include <cstring>
+#include <set>
+
+#include "FGBinaryRecord.h"
+#include "FGFDMExec.h"
+#include "math/FGFunction.h"
+#include "math/FGFunctionValue.h"
+#include "input_output/FGXMLElement.h"
+#include "input_output/string_utilities.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  CLASS IMPLEMENTATION
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+// Copies the bytes of a value to dst in little endian order.
+template<typename T>
+static void StoreLittleEndian(char* dst, T value)
+{
+  static const uint16_t one = 1;
+  memcpy(dst, &value, sizeof(T));
+
+  if (*reinterpret_cast<const char*>(&one) != 1) {
+    for (size_t i=0; i < sizeof(T)/2; ++i)
+      swap(dst[i], dst[sizeof(T)-1-i]);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+template<typename T>
+static void AppendLittleEndian(vector<char>& buffer, T value)
+{
+  size_t size = buffer.size();
+  buffer.resize(size + sizeof(T));
+  StoreLittleEndian(&buffer[size], value);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+static void AppendString(vector<char>& buffer, const string& s)
+{
+  uint16_t length = static_cast<uint16_t>(min<size_t>(s.size(), UINT16_MAX));
+  AppendLittleEndian(buffer, length);
+  buffer.insert(buffer.end(), s.begin(), s.begin()+length);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGBinaryRecord::Build(FGFDMExec* fdmex,
+                           const vector<FGPropertyValue*>& parameters,
+                           const vector<string>& captions,
+                           const vector<string>& units,
+                           const vector<shared_ptr<FGFunction>>& functions,
+                           eType type)
+{
+  Columns.clear();
+
+  static const char magic[8] = {'J', 'S', 'B', 'S', 'B', 'I', 'N', '\0'};
+  Header.assign(magic, magic+8);
+  AppendLittleEndian<uint32_t>(Header, 1);  // Version
+  AppendLittleEndian<uint32_t>(Header, 0);  // Header size, set below
+  AppendLittleEndian<uint32_t>(Header, 0);  // Record size, set below
+  AppendLittleEndian<uint32_t>(Header, 0);  // Number of columns, set below
+
+  auto PropertyManager = fdmex->GetPropertyManager();
+  SimTime = new FGPropertyValue(PropertyManager->GetNode("simulation/sim-time-sec"));
+  AddColumn(SimTime, "Time", "sec", tDouble);
+
+  for (unsigned int i=0; i<parameters.size(); ++i) {
+    const FGPropertyValue* param = parameters[i];
+    string unit;
+    if (i < units.size() && !units[i].empty())
+      unit = units[i];
+    else if (!dynamic_cast<const FGFunctionValue*>(param))
+      unit = GetUnit(param->GetName());
+
+    if (i < captions.size() && !captions[i].empty())
+      AddColumn(param, captions[i], unit, type);
+    else
+      AddColumn(param, param->GetFullyQualifiedName(), unit, type);
+  }
+
+  for (auto& f: functions)
+    AddColumn(f.get(), f->GetName(), "", type);
+
+  while (Header.size() % 8) Header.push_back('\0');
+
+  size_t recordSize = Columns.empty() ? 0
+    : Columns.back().offset + (Columns.back().type == tDouble ? 8 : 4);
+  StoreLittleEndian<uint32_t>(&Header[12], Header.size());
+  StoreLittleEndian<uint32_t>(&Header[16], recordSize);
+  StoreLittleEndian<uint32_t>(&Header[20], Columns.size());
+
+  Record.assign(recordSize, '\0');
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGBinaryRecord::AddColumn(const FGParameter* source, const string& name,
+                               const string& unit, eType type)
+{
+  size_t offset = 0;
+  if (!Columns.empty())
+    offset = Columns.back().offset + (Columns.back().type == tDouble ? 8 : 4);
+
+  Columns.push_back({source, type, offset});
+
+  Header.push_back(static_cast<char>(type));
+  AppendString(Header, name);
+  AppendString(Header, unit);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+const vector<char>& FGBinaryRecord::Pack(void)
+{
+  for (auto& column: Columns) {
+    double value = column.source->GetValue();
+
+    if (column.type == tDouble)
+      StoreLittleEndian(&Record[column.offset], value);
+    else
+      StoreLittleEndian(&Record[column.offset], static_cast<float>(value));
+  }
+
+  return Record;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGBinaryRecord::eType FGBinaryRecord::ReadFormat(Element* el)
+{
+  string format = el->GetAttributeValue("format");
+  to_upper(format);
+
+  if (format == "FLOAT")
+    return tFloat;
+
+  if (!format.empty() && format != "DOUBLE") {
+    cerr << el->ReadFrom() << FGJSBBase::fgred << "  Unknown format "
+         << format << ". The values will be output as doubles."
+         << FGJSBBase::reset << endl;
+  }
+
+  return tDouble;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+string FGBinaryRecord::GetUnit(const string& name)
+{
+  // The units found at the end of the names of the JSBSim properties. The
+  // other suffixes (such as position in fcs/elevator-position or running in
+  // propulsion/set-running) are not units.
+  static const set<string> units = {
+    "ft", "ft2", "in", "inches", "mt", "meters", "km", "sqft",
+    "fps", "fpm", "kts", "ft_sec", "ft_sec2", "ft2_sec",
+    "deg", "rad", "deg_sec", "rad_sec", "rad_sec2", "sec",
+    "lbs", "lbsft", "ftlb", "ftlbps", "slugs", "slug_ft2", "slugs_ft2",
+    "slugs_ft3", "lbs_sqft", "psf", "psi", "inhg", "pa",
+    "R", "degF", "degC", "K", "hp", "rpm", "pps", "gph", "gal",
+    "lbs_per_gal", "lbs_hphr", "norm"
+  };
+
+  size_t slash = name.find_last_of('/');
+  size_t dash = name.find_last_of('-');
+
+  if (dash == string::npos || (slash != string::npos && dash < slash))
+    return "";
+
+  // Strip the index of a property such as propulsion/engine[0]/thrust-lbs
+  string unit = name.substr(dash+1);
+  unit = unit.substr(0, unit.find('['));
+  return units.count(unit) ? unit : "";
+}
+}
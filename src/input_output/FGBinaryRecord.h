@@ -0,0 +1,141 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+  Header: FGBinaryRecord.h
+  Author: Dawn Aerospace
+  Date started: October 2026
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU Lesser General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option) any
+  later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+
+  You should have received a copy of the GNU Lesser General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc., 59
+  Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+  Further information about the GNU Lesser General Public License can also be
+  found on the world wide web at http://www.gnu.org.
+
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  SENTRY
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGBINARYRECORD_H
+#define FGBINARYRECORD_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  INCLUDES
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "math/FGParameter.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  FORWARD DECLARATIONS
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+class Element;
+class FGFDMExec;
+class FGFunction;
+class FGPropertyValue;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  CLASS DOCUMENTATION
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Encodes the records of the binary outputs.
+    The binary outputs start with a header that describes the columns of the
+    records followed by the records themselves. All the numbers are stored in
+    little endian order:
+
+    - the 8 characters "JSBSBIN" followed by a null character,
+    - the format version (uint32, currently 1),
+    - the size of the header in bytes i.e. the offset of the first record
+      (uint32),
+    - the size of a record in bytes (uint32),
+    - the number of columns (uint32),
+    - for each column: its type ('d' for a 64 bits double, 'f' for a 32 bits
+      float), its name (uint16 length followed by the UTF-8 characters) and its
+      unit (uint16 length followed by the UTF-8 characters, possibly empty),
+    - zero padding up to a multiple of 8 bytes.
+
+    Each record then stores the values of the columns in the order of the header
+    without any padding. The first column is always the simulation time in
+    seconds.
+
+    The unit of a property is given by the attribute unit of its output
+    directive. Otherwise it is taken from the suffix of its name (for instance
+    "ft" for position/h-sl-ft) when the suffix is one of the units of the
+    JSBSim naming conventions, and it is left empty when it is not.
+*/
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  CLASS DECLARATION
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGBinaryRecord
+{
+public:
+  enum eType {tDouble = 'd', tFloat = 'f'};
+
+  /** Defines the columns of the records.
+      @param fdmex the executive from which the simulation time is read
+      @param parameters the properties to record
+      @param captions the names of the properties (an empty caption selects the
+                      name of the property)
+      @param units the units of the properties (an empty unit is looked up
+                   from the name of the property, see GetUnit())
+      @param functions the functions to record after the properties
+      @param type the type in which the properties and functions are stored */
+  void Build(FGFDMExec* fdmex,
+             const std::vector<FGPropertyValue*>& parameters,
+             const std::vector<std::string>& captions,
+             const std::vector<std::string>& units,
+             const std::vector<std::shared_ptr<FGFunction>>& functions,
+             eType type);
+
+  /// Returns the header that describes the records.
+  const std::vector<char>& GetHeader(void) const { return Header; }
+
+  /// Returns the size of the records in bytes.
+  size_t GetRecordSize(void) const { return Record.size(); }
+
+  /** Stores the current values of the columns in the record.
+      @return the record */
+  const std::vector<char>& Pack(void);
+
+  /** Reads the type of the values from the format attribute of an output
+      directive ("double" or "float"). Defaults to double. */
+  static eType ReadFormat(Element* el);
+
+  /** Returns the unit of a property from the suffix of its name, or an empty
+      string if the suffix is not a known unit. */
+  static std::string GetUnit(const std::string& name);
+
+private:
+  struct Column {
+    const FGParameter* source;
+    eType type;
+    size_t offset;
+  };
+
+  std::vector<Column> Columns;
+  std::vector<char> Header;
+  std::vector<char> Record;
+  FGParameter_ptr SimTime;
+
+  void AddColumn(const FGParameter* source, const std::string& name,
+                 const std::string& unit, eType type);
+};
+}
+#endif
@@ -0,0 +1,158 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+  Module:       FGColumnarCodec.cpp
+  Author:       Dawn Aerospace
+  Date started: October 2026
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU Lesser General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option) any
+  later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+
+  You should have received a copy of the GNU Lesser General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc., 59
+  Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+  Further information about the GNU Lesser General Public License can also be
+  found on the world wide web at http://www.gnu.org.
+
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  INCLUDES
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstring>
+
+#include "FGColumnarCodec.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  CLASS IMPLEMENTATION
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+const char FGColumnarCodec::FileMagic[8] = {'J','S','B','S','C','O','L','\0'};
+const char FGColumnarCodec::ChunkMagic[4] = {'C','H','N','K'};
+const char FGColumnarCodec::IndexMagic[8] = {'J','S','B','S','I','D','X','\0'};
+const char FGColumnarCodec::EndMagic[8] = {'J','S','B','S','E','N','D','\0'};
+const uint32_t FGColumnarCodec::Version;
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+static uint64_t ToBits(double value)
+{
+  uint64_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+static double FromBits(uint64_t bits)
+{
+  double value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGColumnarCodec::IsValid(int encoding)
+{
+  return encoding == eRaw || encoding == eXor || encoding == eDelta;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+size_t FGColumnarCodec::Encode(const double* values, size_t n,
+                               eEncoding encoding, char* out)
+{
+  if (encoding == eRaw) {
+    for (size_t i=0; i<n; ++i)
+      Store(&out[8*i], values[i]);
+    return 8*n;
+  }
+
+  char* payload = out + n;
+  uint64_t previous = 0, previousDelta = 0;
+
+  for (size_t i=0; i<n; ++i) {
+    uint64_t bits = ToBits(values[i]);
+    uint64_t word;
+
+    if (encoding == eXor)
+      word = bits ^ previous;
+    else {
+      // Zigzag encoding of the difference between consecutive deltas so that
+      // small negative differences also result in many leading zero bytes.
+      uint64_t delta = bits - previous;
+      uint64_t delta2 = delta - previousDelta;
+      word = (delta2 << 1) ^ (0 - (delta2 >> 63));
+      previousDelta = delta;
+    }
+    previous = bits;
+
+    if (word == 0) {
+      out[i] = static_cast<char>(0x80);
+      continue;
+    }
+
+    unsigned int lz = 0, tz = 0;
+    while ((word >> (56 - 8*lz)) == 0) ++lz;
+    while (((word >> (8*tz)) & 0xff) == 0) ++tz;
+
+    out[i] = static_cast<char>((lz << 4) | tz);
+    for (unsigned int k=tz; k<8-lz; ++k)
+      *payload++ = static_cast<char>((word >> (8*k)) & 0xff);
+  }
+
+  return payload - out;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGColumnarCodec::Decode(const char* data, size_t size, size_t n,
+                             eEncoding encoding, double* values)
+{
+  if (encoding == eRaw) {
+    if (size != 8*n) return false;
+    for (size_t i=0; i<n; ++i)
+      values[i] = Load<double>(&data[8*i]);
+    return true;
+  }
+
+  if (!IsValid(encoding) || size < n) return false;
+
+  const unsigned char* control = reinterpret_cast<const unsigned char*>(data);
+  const unsigned char* payload = control + n;
+  const unsigned char* end = control + size;
+  uint64_t previous = 0, previousDelta = 0;
+
+  for (size_t i=0; i<n; ++i) {
+    unsigned int lz = control[i] >> 4;
+    unsigned int tz = control[i] & 0x0f;
+    if (lz + tz > 8 || 8 - lz - tz > end - payload) return false;
+
+    uint64_t word = 0;
+    for (unsigned int k=tz; k<8-lz; ++k)
+      word |= static_cast<uint64_t>(*payload++) << (8*k);
+
+    if (encoding == eXor)
+      previous ^= word;
+    else {
+      previousDelta += (word >> 1) ^ (0 - (word & 1));
+      previous += previousDelta;
+    }
+
+    values[i] = FromBits(previous);
+  }
+
+  return payload == end;
+}
+}
@@ -0,0 +1,174 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+  Header: FGColumnarCodec.h
+  Author: Dawn Aerospace
+  Date started: October 2026
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU Lesser General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option) any
+  later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+
+  You should have received a copy of the GNU Lesser General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc., 59
+  Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+  Further information about the GNU Lesser General Public License can also be
+  found on the world wide web at http://www.gnu.org.
+
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  SENTRY
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGCOLUMNARCODEC_H
+#define FGCOLUMNARCODEC_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  INCLUDES
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstddef>
+#include <cstdint>
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  FORWARD DECLARATIONS
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  CLASS DOCUMENTATION
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Layout and encodings of the columnar output files.
+    A columnar file stores the records in chunks. Within a chunk, the values of
+    each column are stored in a contiguous block so that reading a column only
+    touches the blocks of that column. All the numbers are little endian.
+
+    The file starts with a header:
+    - the 8 characters "JSBSCOL" followed by a null character,
+    - the format version (uint32, currently 1),
+    - the number of columns (uint32),
+    - the maximum number of records per chunk (uint32),
+    - the size of the header in bytes i.e. the offset of the first chunk
+      (uint32),
+    - for each column: its encoding (uint8), its name (uint16 length followed by
+      the UTF-8 characters) and its unit (uint16 length followed by the UTF-8
+      characters, possibly empty),
+    - zero padding up to a multiple of 8 bytes.
+
+    Each chunk is made of:
+    - the 4 characters "CHNK",
+    - the number of records (uint32),
+    - the time of the first and last records (double),
+    - the size in bytes of the block of each column (uint64),
+    - the blocks of the columns.
+
+    The first column is always the simulation time in seconds. When the file is
+    closed, an index of the chunks is appended:
+    - the 8 characters "JSBSIDX" followed by a null character,
+    - the number of chunks (uint64),
+    - for each chunk: its offset (uint64), its number of records (uint64), the
+      time of its first and last records (double),
+    - the offset of the index (uint64),
+    - the 8 characters "JSBSEND" followed by a null character.
+
+    A file that has not been closed (e.g. because the simulation crashed) has
+    no index; its chunks can still be read by scanning the file.
+
+    The blocks are encoded with one of the following methods, all of which are
+    lossless:
+    - eRaw: the doubles are stored as is.
+    - eXor: each value is XOR'ed with the previous one (which results in many
+      zero bits for slowly varying values).
+    - eDelta: the bits of the values are read as integers and the difference
+      between two consecutive deltas is stored as a zigzag integer (efficient
+      for steadily increasing values such as the time).
+
+    The XOR and delta encoded blocks start with one control byte per value
+    followed by the significant bytes of the words. The high nibble of a
+    control byte is the number of leading zero bytes of the word and the low
+    nibble its number of trailing zero bytes.
+*/
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  CLASS DECLARATION
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGColumnarCodec
+{
+public:
+  enum eEncoding {eRaw = 'r', eXor = 'x', eDelta = 'd'};
+
+  static const char FileMagic[8];
+  static const char ChunkMagic[4];
+  static const char IndexMagic[8];
+  static const char EndMagic[8];
+  static const uint32_t Version = 1;
+
+  /// Returns true if encoding is one of the supported encodings.
+  static bool IsValid(int encoding);
+
+  /// Returns the maximum size in bytes of a block of n values.
+  static size_t GetMaxSize(size_t n) { return 9*n; }
+
+  /** Encodes a block of values.
+      @param values the values to encode
+      @param n the number of values
+      @param encoding the encoding method
+      @param out buffer of at least GetMaxSize(n) bytes
+      @return the size of the encoded block */
+  static size_t Encode(const double* values, size_t n, eEncoding encoding,
+                       char* out);
+
+  /** Decodes a block of values.
+      @param data the encoded block
+      @param size the size of the encoded block
+      @param n the number of values
+      @param encoding the encoding method
+      @param values buffer of at least n values
+      @return false if the block is corrupted */
+  static bool Decode(const char* data, size_t size, size_t n,
+                     eEncoding encoding, double* values);
+
+  /// Stores a number in little endian order.
+  template<typename T> static void Store(char* dst, T value);
+  /// Loads a number stored in little endian order.
+  template<typename T> static T Load(const char* src);
+};
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+template<typename T>
+void FGColumnarCodec::Store(char* dst, T value)
+{
+  static const uint16_t one = 1;
+  bool little = *reinterpret_cast<const char*>(&one) == 1;
+  const char* src = reinterpret_cast<const char*>(&value);
+
+  for (size_t i=0; i<sizeof(T); ++i)
+    dst[i] = src[little ? i : sizeof(T)-1-i];
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+template<typename T>
+T FGColumnarCodec::Load(const char* src)
+{
+  static const uint16_t one = 1;
+  bool little = *reinterpret_cast<const char*>(&one) == 1;
+  T value;
+  char* dst = reinterpret_cast<char*>(&value);
+
+  for (size_t i=0; i<sizeof(T); ++i)
+    dst[little ? i : sizeof(T)-1-i] = src[i];
+
+  return value;
+}
+}
+#endif
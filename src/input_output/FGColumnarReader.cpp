@@ -0,0 +1,353 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+  Module:       FGColumnarReader.cpp
+  Author:       Dawn Aerospace
+  Date started: October 2026
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU Lesser General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option) any
+  later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+
+  You should have received a copy of the GNU Lesser General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc., 59
+  Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+  Further information about the GNU Lesser General Public License can also be
+  found on the world wide web at http://www.gnu.org.
+
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  INCLUDES
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+#ifdef _WIN32
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+#include "FGColumnarReader.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  CLASS IMPLEMENTATION
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+// Size of the fixed part of a chunk header: magic, number of records and time
+// range.
+static const size_t ChunkHeaderSize = 24;
+// Size of an entry of the index: offset, number of records and time range.
+static const size_t IndexEntrySize = 32;
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGColumnarReader::Open(const string& filename)
+{
+  Close();
+  Filename = filename;
+
+  if (!Map(filename)) {
+    cerr << "Unable to map the file " << filename << endl;
+    return false;
+  }
+
+  size_t headerSize;
+  if (!ReadHeader(headerSize)) {
+    cerr << filename << " is not a JSBSim columnar output file" << endl;
+    Close();
+    return false;
+  }
+
+  Indexed = ReadIndex(headerSize);
+  if (!Indexed) ScanChunks(headerSize);
+
+  NumRecords = 0;
+  for (auto& chunk: Chunks)
+    NumRecords += chunk.rows;
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGColumnarReader::Close(void)
+{
+  if (Data) {
+#ifdef _WIN32
+    UnmapViewOfFile(Data);
+    CloseHandle(MappingHandle);
+    CloseHandle(FileHandle);
+    MappingHandle = FileHandle = nullptr;
+#else
+    munmap(const_cast<char*>(Data), Size);
+#endif
+  }
+
+  Data = nullptr;
+  Size = 0;
+  Indexed = false;
+  NumRecords = 0;
+  Columns.clear();
+  Chunks.clear();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGColumnarReader::Map(const string& filename)
+{
+#ifdef _WIN32
+  HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                            nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+                            nullptr);
+  if (file == INVALID_HANDLE_VALUE) return false;
+
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+    CloseHandle(file);
+    return false;
+  }
+
+  HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0,
+                                      nullptr);
+  if (!mapping) {
+    CloseHandle(file);
+    return false;
+  }
+
+  void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (!data) {
+    CloseHandle(mapping);
+    CloseHandle(file);
+    return false;
+  }
+
+  FileHandle = file;
+  MappingHandle = mapping;
+  Data = static_cast<const char*>(data);
+  Size = static_cast<size_t>(size.QuadPart);
+#else
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0) return false;
+
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size == 0) {
+    close(fd);
+    return false;
+  }
+
+  void* data = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  // The mapping remains valid after the file descriptor is closed.
+  close(fd);
+  if (data == MAP_FAILED) return false;
+
+  Data = static_cast<const char*>(data);
+  Size = static_cast<size_t>(st.st_size);
+#endif
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGColumnarReader::ReadHeader(size_t& headerSize)
+{
+  if (Size < 24 || memcmp(Data, FGColumnarCodec::FileMagic, 8) != 0)
+    return false;
+
+  uint32_t version = FGColumnarCodec::Load<uint32_t>(&Data[8]);
+  if (version != FGColumnarCodec::Version) {
+    cerr << "Unsupported version " << version << " of the columnar format"
+         << endl;
+    return false;
+  }
+
+  uint32_t numColumns = FGColumnarCodec::Load<uint32_t>(&Data[12]);
+  headerSize = FGColumnarCodec::Load<uint32_t>(&Data[20]);
+  if (headerSize > Size || numColumns == 0) return false;
+
+  size_t pos = 24;
+  auto ReadString = [&](string& s) {
+    if (pos + 2 > headerSize) return false;
+    size_t length = FGColumnarCodec::Load<uint16_t>(&Data[pos]);
+    pos += 2;
+    if (pos + length > headerSize) return false;
+    s.assign(&Data[pos], length);
+    pos += length;
+    return true;
+  };
+
+  Columns.resize(numColumns);
+  for (auto& column: Columns) {
+    if (pos >= headerSize) return false;
+    int encoding = static_cast<unsigned char>(Data[pos++]);
+    if (!FGColumnarCodec::IsValid(encoding)) return false;
+    column.encoding = static_cast<FGColumnarCodec::eEncoding>(encoding);
+    if (!ReadString(column.name) || !ReadString(column.unit)) return false;
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGColumnarReader::ReadIndex(size_t headerSize)
+{
+  if (Size < headerSize + 32
+      || memcmp(&Data[Size-8], FGColumnarCodec::EndMagic, 8) != 0)
+    return false;
+
+  uint64_t index = FGColumnarCodec::Load<uint64_t>(&Data[Size-16]);
+  if (index < headerSize || index > Size - 32
+      || memcmp(&Data[index], FGColumnarCodec::IndexMagic, 8) != 0)
+    return false;
+
+  uint64_t numChunks = FGColumnarCodec::Load<uint64_t>(&Data[index+8]);
+  if (numChunks != (Size - 32 - index) / IndexEntrySize
+      || index + 16 + numChunks*IndexEntrySize + 16 != Size)
+    return false;
+
+  const char* entry = &Data[index+16];
+  Chunks.resize(numChunks);
+  for (auto& chunk: Chunks) {
+    chunk.offset = FGColumnarCodec::Load<uint64_t>(entry);
+    chunk.rows = FGColumnarCodec::Load<uint64_t>(entry+8);
+    chunk.first = FGColumnarCodec::Load<double>(entry+16);
+    chunk.last = FGColumnarCodec::Load<double>(entry+24);
+    entry += IndexEntrySize;
+
+    if (chunk.offset < headerSize
+        || chunk.offset + ChunkHeaderSize + 8*Columns.size() > index) {
+      Chunks.clear();
+      return false;
+    }
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGColumnarReader::ScanChunks(size_t headerSize)
+{
+  size_t pos = headerSize;
+  size_t tableSize = 8*Columns.size();
+
+  // A truncated chunk at the end of the file is ignored.
+  while (pos + ChunkHeaderSize + tableSize <= Size
+         && memcmp(&Data[pos], FGColumnarCodec::ChunkMagic, 4) == 0) {
+    Chunk chunk;
+    chunk.offset = pos;
+    chunk.rows = FGColumnarCodec::Load<uint32_t>(&Data[pos+4]);
+    chunk.first = FGColumnarCodec::Load<double>(&Data[pos+8]);
+    chunk.last = FGColumnarCodec::Load<double>(&Data[pos+16]);
+
+    size_t end = pos + ChunkHeaderSize + tableSize;
+    for (size_t i=0; i<Columns.size(); ++i)
+      end += FGColumnarCodec::Load<uint64_t>(&Data[pos+ChunkHeaderSize+8*i]);
+    if (end > Size) break;
+
+    Chunks.push_back(chunk);
+    pos = end;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+int FGColumnarReader::GetColumnIndex(const string& name) const
+{
+  for (size_t i=0; i<Columns.size(); ++i)
+    if (Columns[i].name == name) return static_cast<int>(i);
+
+  return -1;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double FGColumnarReader::GetStartTime(void) const
+{
+  return Chunks.empty() ? 0.0 : Chunks.front().first;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double FGColumnarReader::GetEndTime(void) const
+{
+  return Chunks.empty() ? 0.0 : Chunks.back().last;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGColumnarReader::DecodeBlock(const Chunk& chunk, size_t column,
+                                   vector<double>& values) const
+{
+  const char* header = &Data[chunk.offset];
+  if (memcmp(header, FGColumnarCodec::ChunkMagic, 4) != 0
+      || FGColumnarCodec::Load<uint32_t>(header+4) != chunk.rows)
+    return false;
+
+  size_t pos = chunk.offset + ChunkHeaderSize + 8*Columns.size();
+  for (size_t i=0; i<column; ++i)
+    pos += FGColumnarCodec::Load<uint64_t>(header+ChunkHeaderSize+8*i);
+  size_t size = FGColumnarCodec::Load<uint64_t>(header+ChunkHeaderSize+8*column);
+  if (pos > Size || size > Size - pos) return false;
+
+  values.resize(chunk.rows);
+  return FGColumnarCodec::Decode(&Data[pos], size, chunk.rows,
+                                 Columns[column].encoding, values.data());
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGColumnarReader::ReadColumn(size_t column, vector<double>& values,
+                                  double start, double end) const
+{
+  values.clear();
+  if (column >= Columns.size()) return false;
+
+  // The chunks are sorted by time: skip those that end before the window.
+  auto chunk = lower_bound(Chunks.begin(), Chunks.end(), start,
+                           [](const Chunk& c, double t) { return c.last < t; });
+  vector<double> time, block;
+
+  for (; chunk != Chunks.end() && chunk->first <= end; ++chunk) {
+    if (!DecodeBlock(*chunk, column, block)) {
+      cerr << "The chunk at offset " << chunk->offset << " of " << Filename
+           << " is corrupted" << endl;
+      return false;
+    }
+
+    if (chunk->first >= start && chunk->last <= end) {
+      values.insert(values.end(), block.begin(), block.end());
+      continue;
+    }
+
+    // The chunk straddles a bound of the window: filter its records by time.
+    if (column == 0)
+      time = block;
+    else if (!DecodeBlock(*chunk, 0, time)) {
+      cerr << "The chunk at offset " << chunk->offset << " of " << Filename
+           << " is corrupted" << endl;
+      return false;
+    }
+
+    for (size_t i=0; i<block.size(); ++i)
+      if (time[i] >= start && time[i] <= end) values.push_back(block[i]);
+  }
+
+  return true;
+}
+}
@@ -0,0 +1,153 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+  Header: FGColumnarReader.h
+  Author: Dawn Aerospace
+  Date started: October 2026
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU Lesser General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option) any
+  later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+
+  You should have received a copy of the GNU Lesser General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc., 59
+  Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+  Further information about the GNU Lesser General Public License can also be
+  found on the world wide web at http://www.gnu.org.
+
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  SENTRY
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGCOLUMNARREADER_H
+#define FGCOLUMNARREADER_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  INCLUDES
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "FGColumnarCodec.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  FORWARD DECLARATIONS
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  CLASS DOCUMENTATION
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Reads the files written by the COLUMNAR output type.
+    The file is memory mapped so that reading a column over a time window only
+    touches the pages of the chunks that overlap the window: the chunks are
+    located with a binary search in the index and only the blocks of the
+    requested column are decoded (the time column is also decoded for the
+    chunks that straddle the bounds of the window).
+
+    The class only depends on FGColumnarCodec so that it can be compiled with
+    the standalone utilities such as prep_plot.
+
+    @code
+    FGColumnarReader reader;
+    if (reader.Open("flight.col")) {
+      int alt = reader.GetColumnIndex("position/h-sl-ft");
+      std::vector<double> time, h;
+      reader.ReadColumn(0, time, 10.0, 20.0);
+      reader.ReadColumn(alt, h, 10.0, 20.0);
+    }
+    @endcode
+    @see FGColumnarCodec for the layout of the files.
+*/
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  CLASS DECLARATION
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGColumnarReader
+{
+public:
+  FGColumnarReader() = default;
+  ~FGColumnarReader() { Close(); }
+
+  FGColumnarReader(const FGColumnarReader&) = delete;
+  FGColumnarReader& operator=(const FGColumnarReader&) = delete;
+
+  /** Maps a file and reads its header and index.
+      @return false if the file could not be opened or is not a columnar
+              file. */
+  bool Open(const std::string& filename);
+  /// Unmaps the file.
+  void Close(void);
+
+  bool IsOpen(void) const { return Data != nullptr; }
+  /** Returns true if the file has been closed properly by JSBSim. Otherwise
+      the chunks have been located by scanning the file. */
+  bool IsIndexed(void) const { return Indexed; }
+
+  size_t GetNumColumns(void) const { return Columns.size(); }
+  const std::string& GetColumnName(size_t i) const { return Columns[i].name; }
+  const std::string& GetColumnUnit(size_t i) const { return Columns[i].unit; }
+  /// Returns the index of a column or -1 if there is no such column.
+  int GetColumnIndex(const std::string& name) const;
+
+  size_t GetNumChunks(void) const { return Chunks.size(); }
+  size_t GetNumRecords(void) const { return NumRecords; }
+  /// Returns the time of the first record.
+  double GetStartTime(void) const;
+  /// Returns the time of the last record.
+  double GetEndTime(void) const;
+
+  /** Reads the values of a column for the records whose time is in the range
+      [start, end].
+      @param column index of the column (0 is the time)
+      @param values receives the values
+      @return false if the file is corrupted */
+  bool ReadColumn(size_t column, std::vector<double>& values,
+                  double start = -HUGE_VAL, double end = HUGE_VAL) const;
+
+private:
+  struct Column {
+    FGColumnarCodec::eEncoding encoding;
+    std::string name;
+    std::string unit;
+  };
+
+  struct Chunk {
+    uint64_t offset;
+    uint64_t rows;
+    double first;
+    double last;
+  };
+
+  std::string Filename;
+  const char* Data = nullptr;
+  size_t Size = 0;
+#ifdef _WIN32
+  void* FileHandle = nullptr;
+  void* MappingHandle = nullptr;
+#endif
+  bool Indexed = false;
+  size_t NumRecords = 0;
+  std::vector<Column> Columns;
+  std::vector<Chunk> Chunks;
+
+  bool Map(const std::string& filename);
+  bool ReadHeader(size_t& headerSize);
+  bool ReadIndex(size_t headerSize);
+  void ScanChunks(size_t headerSize);
+  bool DecodeBlock(const Chunk& chunk, size_t column,
+                   std::vector<double>& values) const;
+};
+}
+#endif
@@ -0,0 +1,247 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+  Module:       FGGainScheduleReader.cpp
+  Author:       Dawn Aerospace
+  Date started: October 2026
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU Lesser General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option) any
+  later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+
+  You should have received a copy of the GNU Lesser General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc., 59
+  Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+  Further information about the GNU Lesser General Public License can also be
+  found on the world wide web at http://www.gnu.org.
+
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  INCLUDES
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+#include "FGGainScheduleReader.h"
+#include "FGColumnarCodec.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  CLASS IMPLEMENTATION
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+const char FGGainScheduleReader::FileMagic[8] = {'J','S','B','S','L','I','N','\0'};
+const char FGGainScheduleReader::IndexMagic[8] = {'J','S','B','S','I','D','X','\0'};
+const char FGGainScheduleReader::EndMagic[8] = {'J','S','B','S','E','N','D','\0'};
+
+namespace {
+
+// Reads the numbers and the strings of a file with bounds checking.
+class Cursor
+{
+public:
+  Cursor(const vector<char>& data, size_t position)
+    : Data(data), Position(position), Valid(position <= data.size()) {}
+
+  bool IsValid(void) const { return Valid; }
+  size_t GetPosition(void) const { return Position; }
+
+  template<typename T> T Read(void) {
+    if (!Check(sizeof(T))) return T(0);
+    T value = FGColumnarCodec::Load<T>(Data.data()+Position);
+    Position += sizeof(T);
+    return value;
+  }
+
+  void ReadDoubles(vector<double>& values, size_t n) {
+    values.clear();
+    if (!Check(n*sizeof(double))) return;
+    values.reserve(n);
+    for (size_t i=0; i<n; ++i) values.push_back(Read<double>());
+  }
+
+  string ReadString(void) {
+    size_t size = Read<uint16_t>();
+    if (!Check(size)) return string();
+    string value(Data.data()+Position, size);
+    Position += size;
+    return value;
+  }
+
+  bool Match(const char magic[8]) {
+    if (!Check(8)) return false;
+    Valid = memcmp(Data.data()+Position, magic, 8) == 0;
+    Position += 8;
+    return Valid;
+  }
+
+private:
+  const vector<char>& Data;
+  size_t Position;
+  bool Valid;
+
+  bool Check(size_t size) {
+    if (Valid && size > Data.size() - Position) Valid = false;
+    return Valid;
+  }
+};
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGGainScheduleReader::Open(const string& filename)
+{
+  ifstream file(filename, ios::binary);
+  if (!file.is_open()) {
+    cerr << "Unable to open the file " << filename << endl;
+    return false;
+  }
+
+  Data.assign(istreambuf_iterator<char>(file), istreambuf_iterator<char>());
+  Axes.clear();
+  Offsets.clear();
+
+  if (!ReadHeader()) {
+    cerr << filename << " is not a JSBSim gain schedule file" << endl;
+    return false;
+  }
+
+  if (!ReadIndex()) {
+    cerr << "The index of the gain schedule file " << filename
+         << " is missing or corrupted" << endl;
+    Offsets.clear();
+    return false;
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGGainScheduleReader::ReadHeader(void)
+{
+  Cursor cursor(Data, 0);
+
+  if (!cursor.Match(FileMagic) || cursor.Read<uint32_t>() != Version)
+    return false;
+
+  AircraftName = cursor.ReadString();
+  uint32_t naxes = cursor.Read<uint32_t>();
+
+  for (uint32_t i=0; i<naxes && cursor.IsValid(); ++i) {
+    Axis axis;
+    axis.property = cursor.ReadString();
+    uint32_t n = cursor.Read<uint32_t>();
+    cursor.ReadDoubles(axis.values, n);
+    Axes.push_back(axis);
+  }
+
+  return cursor.IsValid();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGGainScheduleReader::ReadIndex(void)
+{
+  if (Data.size() < 16) return false;
+
+  Cursor end(Data, Data.size()-16);
+  uint64_t offset = end.Read<uint64_t>();
+  if (!end.Match(EndMagic)) return false;
+
+  Cursor cursor(Data, offset);
+  if (!cursor.Match(IndexMagic)) return false;
+
+  size_t npoints = 1;
+  for (const auto& axis: Axes) npoints *= axis.values.size();
+  if (cursor.Read<uint64_t>() != npoints) return false;
+
+  for (size_t i=0; i<npoints && cursor.IsValid(); ++i) {
+    uint64_t record = cursor.Read<uint64_t>();
+    if (record >= offset) return false;
+    Offsets.push_back(record);
+  }
+
+  for (unsigned int i=0; i<3; ++i) {
+    Names[i].clear();
+    Units[i].clear();
+    uint32_t n = cursor.Read<uint32_t>();
+    for (uint32_t j=0; j<n && cursor.IsValid(); ++j) {
+      Names[i].push_back(cursor.ReadString());
+      Units[i].push_back(cursor.ReadString());
+    }
+  }
+
+  return cursor.IsValid() && cursor.GetPosition() == Data.size()-16;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+size_t FGGainScheduleReader::GetPointNumber(const vector<size_t>& indices) const
+{
+  if (indices.size() != Axes.size())
+    throw out_of_range("The number of indices differs from the number of axes");
+
+  size_t point = 0;
+  for (size_t i=0; i<Axes.size(); ++i) {
+    if (indices[i] >= Axes[i].values.size())
+      throw out_of_range("The index is out of the grid");
+    point = point*Axes[i].values.size() + indices[i];
+  }
+
+  return point;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+vector<size_t> FGGainScheduleReader::GetPointIndices(size_t point) const
+{
+  vector<size_t> indices(Axes.size());
+
+  for (size_t i=Axes.size(); i>0; --i) {
+    size_t n = Axes[i-1].values.size();
+    indices[i-1] = point % n;
+    point /= n;
+  }
+
+  return indices;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGGainScheduleReader::ReadPoint(size_t point, Point& p) const
+{
+  if (point >= Offsets.size() || !IsSolved(point)) return false;
+
+  Cursor cursor(Data, Offsets[point]);
+  if (cursor.Read<uint64_t>() != point) return false;
+
+  uint32_t ncontrols = cursor.Read<uint32_t>();
+  p.nx = cursor.Read<uint32_t>();
+  p.nu = cursor.Read<uint32_t>();
+  p.ny = cursor.Read<uint32_t>();
+
+  cursor.ReadDoubles(p.controls, ncontrols);
+  cursor.ReadDoubles(p.x0, p.nx);
+  cursor.ReadDoubles(p.u0, p.nu);
+  cursor.ReadDoubles(p.y0, p.ny);
+  cursor.ReadDoubles(p.A, p.nx*p.nx);
+  cursor.ReadDoubles(p.B, p.nx*p.nu);
+  cursor.ReadDoubles(p.C, p.ny*p.nx);
+  cursor.ReadDoubles(p.D, p.ny*p.nu);
+
+  return cursor.IsValid();
+}
+}
@@ -0,0 +1,167 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+  Header: FGGainScheduleReader.h
+  Author: Dawn Aerospace
+  Date started: October 2026
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU Lesser General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option) any
+  later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+
+  You should have received a copy of the GNU Lesser General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc., 59
+  Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+  Further information about the GNU Lesser General Public License can also be
+  found on the world wide web at http://www.gnu.org.
+
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  SENTRY
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+
+#ifndef FGGAINSCHEDULEREADER_H
+#define FGGAINSCHEDULEREADER_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  INCLUDES
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  FORWARD DECLARATIONS
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  CLASS DOCUMENTATION
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Reads the gain schedule files written by FGEnvelopeLinearization.
+    A gain schedule file holds the trimmed controls and the linear models of
+    the points of a grid of flight conditions. All the numbers are little
+    endian and the strings are made of their length (uint16) followed by their
+    UTF-8 characters.
+
+    The file starts with a header:
+    - the 8 characters "JSBSLIN" followed by a null character,
+    - the format version (uint32, currently 1),
+    - the name of the aircraft (string),
+    - the number of axes of the grid (uint32),
+    - for each axis: the name of the property it sets (string), the number of
+      its values (uint32) and the values (double).
+
+    The points of the grid are numbered in row-major order: the index of the
+    last axis varies the fastest. The header is followed by one record for each
+    point that was trimmed and linearized:
+    - the number of the point (uint64),
+    - the number of trim controls, states, inputs and outputs (4 x uint32),
+    - the values of the trim controls, of the states, of the inputs and of the
+      outputs (double),
+    - the matrices A (states x states), B (states x inputs), C (outputs x
+      states) and D (outputs x inputs) stored row by row (double).
+
+    The records are written in the order in which the points are computed,
+    which is not the order of their numbers. When the batch completes, an index
+    is appended:
+    - the 8 characters "JSBSIDX" followed by a null character,
+    - the number of points of the grid (uint64),
+    - for each point: the offset of its record (uint64) or 0 if the point
+      could not be trimmed,
+    - for the states, the inputs and the outputs: their number (uint32) then
+      the name and the unit of each of them (strings),
+    - the offset of the index (uint64),
+    - the 8 characters "JSBSEND" followed by a null character.
+
+    @code
+    FGGainScheduleReader reader;
+    if (reader.Open("c172_envelope.lin")) {
+      FGGainScheduleReader::Point point;
+      size_t n = reader.GetPointNumber({2, 0, 1});
+      if (reader.ReadPoint(n, point))
+        cout << "Mq: " << point.A[3*point.nx+3] << endl;
+    }
+    @endcode
+*/
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  CLASS DECLARATION
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGGainScheduleReader
+{
+public:
+  static const char FileMagic[8];
+  static const char IndexMagic[8];
+  static const char EndMagic[8];
+  static const uint32_t Version = 1;
+
+  /// Trimmed controls and linear model of a point of the grid.
+  struct Point {
+    unsigned int nx = 0, nu = 0, ny = 0;
+    std::vector<double> controls;
+    std::vector<double> x0, u0, y0;
+    /// Matrices stored row by row.
+    std::vector<double> A, B, C, D;
+  };
+
+  /** Reads a file and its index.
+      @return false if the file could not be read, is not a gain schedule file
+              or has no index. */
+  bool Open(const std::string& filename);
+
+  const std::string& GetAircraftName(void) const { return AircraftName; }
+
+  size_t GetNumAxes(void) const { return Axes.size(); }
+  const std::string& GetAxisProperty(size_t i) const { return Axes[i].property; }
+  const std::vector<double>& GetAxisValues(size_t i) const { return Axes[i].values; }
+
+  size_t GetNumPoints(void) const { return Offsets.size(); }
+  /** Returns the number of a point from the index of its value on each axis.
+      @throws std::out_of_range if an index is out of the grid. */
+  size_t GetPointNumber(const std::vector<size_t>& indices) const;
+  /// Returns the index of the value on each axis of a point.
+  std::vector<size_t> GetPointIndices(size_t point) const;
+  /// Returns true if the point has been trimmed and linearized.
+  bool IsSolved(size_t point) const { return Offsets[point] != 0; }
+
+  /** Reads the controls and the linear model of a point.
+      @return false if the point could not be trimmed or if its record is
+              corrupted. */
+  bool ReadPoint(size_t point, Point& p) const;
+
+  const std::vector<std::string>& GetStateNames(void) const { return Names[0]; }
+  const std::vector<std::string>& GetInputNames(void) const { return Names[1]; }
+  const std::vector<std::string>& GetOutputNames(void) const { return Names[2]; }
+  const std::vector<std::string>& GetStateUnits(void) const { return Units[0]; }
+  const std::vector<std::string>& GetInputUnits(void) const { return Units[1]; }
+  const std::vector<std::string>& GetOutputUnits(void) const { return Units[2]; }
+
+private:
+  struct Axis {
+    std::string property;
+    std::vector<double> values;
+  };
+
+  std::vector<char> Data;
+  std::string AircraftName;
+  std::vector<Axis> Axes;
+  std::vector<uint64_t> Offsets;
+  std::vector<std::string> Names[3];
+  std::vector<std::string> Units[3];
+
+  bool ReadHeader(void);
+  bool ReadIndex(void);
+};
+}
+#endif
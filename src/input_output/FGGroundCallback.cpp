@@ -33,6 +33,7 @@ SENTRY
 
 #include "math/FGLocation.h"
 #include "FGGroundCallback.h"
+#include "FGSnapshot.h"
 
 namespace JSBSim {
 
@@ -58,4 +59,21 @@ double FGDefaultGroundCallback::GetAGLevel(double t, const FGLocation& loc,
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGGroundCallback::SyncState(FGSnapshot& snapshot)
+{
+  snapshot.Sync(time);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGDefaultGroundCallback::SyncState(FGSnapshot& snapshot)
+{
+  FGGroundCallback::SyncState(snapshot);
+  snapshot.Sync(a);
+  snapshot.Sync(b);
+  snapshot.Sync(mTerrainElevation);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 } // namespace JSBSim
@@ -42,6 +42,7 @@ namespace JSBSim {
 
 class FGLocation;
 class FGColumnVector3;
+class FGSnapshot;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
@@ -114,6 +115,11 @@ public:
    */
   void SetTime(double _time) { time = _time; }
 
+  /** Saves or restores the state of the callback (see
+      FGFDMExec::SaveSnapshot). The callbacks that hold a state must override
+      this method and call the method of their base class. */
+  virtual void SyncState(FGSnapshot& snapshot);
+
 protected:
   double time;
 };
@@ -139,6 +145,8 @@ public:
   void SetEllipse(double semimajor, double semiminor) override
   { a = semimajor; b = semiminor; }
 
+  void SyncState(FGSnapshot& snapshot) override;
+
 private:
   double a, b;
   double mTerrainElevation = 0.0;
@@ -119,173 +119,351 @@ void FGInputSocket::Read(bool Holding)
 
   string raw_data = socket->Receive(); // read data
 
+  // The subscriptions only last as long as the connection of the client that
+  // has registered them.
+  if (socket->GetConnectionCount() != Session) {
+    ResetSession();
+    data.clear();
+    Session = socket->GetConnectionCount();
+  }
+
   if (!raw_data.empty()) {
     size_t start = 0;
 
     data += raw_data;
 
-    // parse lines
-    while (1) {
-      size_t string_start = data.find_first_not_of("\r\n", start);
-      if (string_start == string::npos) break;
-      size_t string_end = data.find_first_of("\r\n", string_start);
+    while (start < data.size()) {
+      // parse binary frames
+      if (data.compare(start, 4, "JSBF") == 0) {
+        size_t size = 4 + SetHandles.size()*sizeof(double);
+        if (data.size() - start < size) break; // wait for the rest of the frame
+        ReadBinaryFrame(&data[start+4]);
+        start += size;
+        continue;
+      }
+
+      // parse lines
+      if (data[start] == '\r' || data[start] == '\n') {
+        ++start;
+        continue;
+      }
+      size_t string_end = data.find_first_of("\r\n", start);
       if (string_end == string::npos) break;
-      string line = data.substr(string_start, string_end-string_start);
-      if (line.empty()) break;
-
-      // now parse individual line
-      vector <string> tokens = split(line,' ');
-
-      string command, argument, str_value;
-      if (!tokens.empty()) {
-        command = to_lower(tokens[0]);
-        if (tokens.size() > 1) {
-          argument = trim(tokens[1]);
-          if (tokens.size() > 2) {
-            str_value = trim(tokens[2]);
-          }
-        }
+
+      if (!Execute(data.substr(start, string_end-start), Holding)) {
+        data.clear();
+        return;
       }
 
-      if (command == "set") {                       // SET PROPERTY
-        FGPropertyNode* node = nullptr;
+      start = string_end;
+    }
 
-        if (argument.empty()) {
-          socket->Reply("No property argument supplied.\r\n");
-          break;
-        }
-        try {
-          node = PropertyManager->GetNode(argument);
-        } catch(...) {
-          socket->Reply("Badly formed property query\r\n");
-          break;
-        }
+    // Remove processed commands.
+    data.erase(0, start);
+  }
+}
 
-        if (!node) {
-          socket->Reply("Unknown property\r\n");
-          break;
-        } else if (!node->hasValue()) {
-          socket->Reply("Not a leaf property\r\n");
-          break;
-        } else {
-          if (is_number(trim(str_value))) {
-            try {
-              double value = atof_locale_c(str_value);
-              node->setDoubleValue(value);
-            } catch(BaseException& e) {
-              socket->Reply(e.what());
-              break;
-            }
-          }
-          else {
-            socket->Reply("Invalid number\r\n");
-            break;
-          }
-        }
-        socket->Reply("set successful\r\n");
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-      } else if (command == "get") {             // GET PROPERTY
-        FGPropertyNode* node = nullptr;
+bool FGInputSocket::Execute(const string& line, bool Holding)
+{
+  // now parse individual line
+  vector <string> tokens = split(line,' ');
+
+  string command, argument, str_value;
+  if (!tokens.empty()) {
+    command = to_lower(tokens[0]);
+    if (tokens.size() > 1) {
+      argument = trim(tokens[1]);
+      if (tokens.size() > 2) {
+        str_value = trim(tokens[2]);
+      }
+    }
+  }
 
-        if (argument.empty()) {
-          socket->Reply("No property argument supplied.\r\n");
-          break;
-        }
+  if (command == "set") {                       // SET PROPERTY
+    FGPropertyNode* node = nullptr;
+
+    if (argument.empty()) {
+      socket->Reply("No property argument supplied.\r\n");
+      return true;
+    }
+    try {
+      node = PropertyManager->GetNode(argument);
+    } catch(...) {
+      socket->Reply("Badly formed property query\r\n");
+      return true;
+    }
+
+    if (!node) {
+      socket->Reply("Unknown property\r\n");
+      return true;
+    } else if (!node->hasValue()) {
+      socket->Reply("Not a leaf property\r\n");
+      return true;
+    } else {
+      if (is_number(trim(str_value))) {
         try {
-          node = PropertyManager->GetNode(argument);
-        } catch(...) {
-          socket->Reply("Badly formed property query\r\n");
-          break;
+          double value = atof_locale_c(str_value);
+          node->setDoubleValue(value);
+        } catch(BaseException& e) {
+          socket->Reply(e.what());
+          return true;
         }
+      }
+      else {
+        socket->Reply("Invalid number\r\n");
+        return true;
+      }
+    }
+    socket->Reply("set successful\r\n");
 
-        if (!node) {
-          socket->Reply("Unknown property\r\n");
-          break;
-        } else if (!node->hasValue()) {
-          if (Holding) { // if holding can query property list
-            string query = FDMExec->QueryPropertyCatalog(argument, "\r\n");
-            socket->Reply(query);
-          } else {
-            socket->Reply("Must be in HOLD to search properties\r\n");
-          }
-        } else {
-          ostringstream buf;
-          buf << argument << " = " << setw(12) << setprecision(6) << node->getDoubleValue() << '\r' << endl;
-          socket->Reply(buf.str());
-        }
+  } else if (command == "get") {             // GET PROPERTY
+    FGPropertyNode* node = nullptr;
 
-      } else if (command == "hold") {               // PAUSE
+    if (argument.empty()) {
+      socket->Reply("No property argument supplied.\r\n");
+      return true;
+    }
+    try {
+      node = PropertyManager->GetNode(argument);
+    } catch(...) {
+      socket->Reply("Badly formed property query\r\n");
+      return true;
+    }
 
-        FDMExec->Hold();
-        socket->Reply("Holding\r\n");
+    if (!node) {
+      socket->Reply("Unknown property\r\n");
+      return true;
+    } else if (!node->hasValue()) {
+      if (Holding) { // if holding can query property list
+        string query = FDMExec->QueryPropertyCatalog(argument, "\r\n");
+        socket->Reply(query);
+      } else {
+        socket->Reply("Must be in HOLD to search properties\r\n");
+      }
+    } else {
+      ostringstream buf;
+      buf << argument << " = " << setw(12) << setprecision(6) << node->getDoubleValue() << '\r' << endl;
+      socket->Reply(buf.str());
+    }
 
-      } else if (command == "resume") {             // RESUME
+  } else if (command == "hold") {               // PAUSE
 
-        FDMExec->Resume();
-        socket->Reply("Resuming\r\n");
+    FDMExec->Hold();
+    socket->Reply("Holding\r\n");
 
-      } else if (command == "iterate") {            // ITERATE
+  } else if (command == "resume") {             // RESUME
 
-        int argumentInt;
-        istringstream (argument) >> argumentInt;
-        if (argument.empty()) {
-          socket->Reply("No argument supplied for number of iterations.\r\n");
-          break;
-        }
-        if ( !(argumentInt > 0) ){
-          socket->Reply("Required argument must be a positive Integer.\r\n");
-          break;
-        }
-        FDMExec->EnableIncrementThenHold( argumentInt );
-        FDMExec->Resume();
-        socket->Reply("Iterations performed\r\n");
-
-      } else if (command == "quit") {               // QUIT
-
-        // close the socket connection
-        socket->Reply("Closing connection\r\n");
-        socket->Close();
-
-      } else if (command == "info") {               // INFO
-
-        // get info about the sim run and/or aircraft, etc.
-        ostringstream info;
-        info << "JSBSim version: " << JSBSim_version << "\r\n";
-        info << "Config File version: " << needed_cfg_version << "\r\n";
-        info << "Aircraft simulated: " << FDMExec->GetAircraft()->GetAircraftName() << "\r\n";
-        info << "Simulation time: " << setw(8) << setprecision(3) << FDMExec->GetSimTime() << '\r' << endl;
-        socket->Reply(info.str());
-
-      } else if (command == "help") {               // HELP
-
-        socket->Reply(
-        " JSBSim Server commands:\n\r\n"
-        "   get {property name}\r\n"
-        "   set {property name} {value}\r\n"
-        "   hold\r\n"
-        "   resume\r\n"
-        "   iterate {value}\r\n"
-        "   help\r\n"
-        "   quit\r\n"
-        "   info\n\r\n");
+    FDMExec->Resume();
+    socket->Reply("Resuming\r\n");
 
-      } else {
-        socket->Reply(string("Unknown command: ") + command + "\r\n");
-      }
+  } else if (command == "iterate") {            // ITERATE
 
-      start = string_end;
+    int argumentInt;
+    istringstream (argument) >> argumentInt;
+    if (argument.empty()) {
+      socket->Reply("No argument supplied for number of iterations.\r\n");
+      return true;
+    }
+    if ( !(argumentInt > 0) ){
+      socket->Reply("Required argument must be a positive Integer.\r\n");
+      return true;
     }
+    FDMExec->EnableIncrementThenHold( argumentInt );
+    FDMExec->Resume();
+    socket->Reply("Iterations performed\r\n");
 
-    // Remove processed commands.
-    size_t last_crlf = data.find_last_of("\r\n");
-    if (last_crlf != string::npos) {
-      if (last_crlf < data.length()-1)
-        data = data.substr(last_crlf+1);
-      else
-        data.clear();
+  } else if (command == "quit") {               // QUIT
+
+    // close the socket connection
+    socket->Reply("Closing connection\r\n");
+    socket->Close();
+    ResetSession();
+    return false;
+
+  } else if (command == "info") {               // INFO
+
+    // get info about the sim run and/or aircraft, etc.
+    ostringstream info;
+    info << "JSBSim version: " << JSBSim_version << "\r\n";
+    info << "Config File version: " << needed_cfg_version << "\r\n";
+    info << "Aircraft simulated: " << FDMExec->GetAircraft()->GetAircraftName() << "\r\n";
+    info << "Simulation time: " << setw(8) << setprecision(3) << FDMExec->GetSimTime() << '\r' << endl;
+    socket->Reply(info.str());
+
+  } else if (command == "help") {               // HELP
+
+    socket->Reply(
+    " JSBSim Server commands:\n\r\n"
+    "   get {property name}\r\n"
+    "   set {property name} {value}\r\n"
+    "   hold\r\n"
+    "   resume\r\n"
+    "   iterate {value}\r\n"
+    "   subscribe {get|set} {property name} ...\r\n"
+    "   unsubscribe\r\n"
+    "   frame {value} ...\r\n"
+    "   help\r\n"
+    "   quit\r\n"
+    "   info\n\r\n");
+
+  } else if (command == "subscribe") {          // SUBSCRIBE PROPERTIES
+
+    Subscribe(tokens);
+
+  } else if (command == "unsubscribe") {        // UNSUBSCRIBE PROPERTIES
+
+    ResetSession();
+    socket->Reply("Unsubscribed\r\n");
+
+  } else if (command == "frame") {              // EXCHANGE A FRAME
+
+    ReadTextFrame(tokens);
+
+  } else {
+    socket->Reply(string("Unknown command: ") + command + "\r\n");
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGInputSocket::Subscribe(const vector<string>& tokens)
+{
+  string direction;
+  if (tokens.size() > 1) direction = tokens[1];
+  to_lower(direction);
+
+  if (direction != "get" && direction != "set") {
+    socket->Reply("Usage: subscribe {get|set} {property name} ...\r\n");
+    return;
+  }
+
+  vector<FGPropertyManager::PropertyHandle> handles;
+
+  for (size_t i=2; i<tokens.size(); ++i) {
+    FGPropertyNode* node = nullptr;
+    auto handle = FGPropertyManager::InvalidHandle;
+    try {
+      handle = PropertyManager->GetHandle(tokens[i]);
+      if (handle != FGPropertyManager::InvalidHandle)
+        node = PropertyManager->GetNode(handle);
+    } catch(...) {
+      socket->Reply("Badly formed property query: " + tokens[i] + "\r\n");
+      return;
+    }
+
+    if (!node) {
+      socket->Reply("Unknown property: " + tokens[i] + "\r\n");
+      return;
+    } else if (!node->hasValue()) {
+      socket->Reply("Not a leaf property: " + tokens[i] + "\r\n");
+      return;
     }
+
+    handles.push_back(handle);
+  }
+
+  // The buffers are allocated once for all so that the exchange of frames does
+  // not allocate memory.
+  if (direction == "set") {
+    SetHandles = handles;
+    SetValues.resize(handles.size());
+  } else {
+    GetHandles = handles;
+    GetValues.resize(handles.size());
+  }
+  FrameReply.reserve(4 + GetHandles.size()*sizeof(double));
+
+  ostringstream buf;
+  buf << "Subscribed " << handles.size() << " properties\r\n";
+  socket->Reply(buf.str());
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGInputSocket::ReadTextFrame(const vector<string>& tokens)
+{
+  if (tokens.size() != SetHandles.size()+1) {
+    ostringstream buf;
+    buf << "Expected " << SetHandles.size() << " values\r\n";
+    socket->Reply(buf.str());
+    return;
   }
 
+  // The properties are only set if all the values are valid.
+  for (size_t i=0; i<SetHandles.size(); ++i) {
+    string value = tokens[i+1];
+    if (!is_number(trim(value))) {
+      socket->Reply("Invalid number: " + value + "\r\n");
+      return;
+    }
+    SetValues[i] = atof_locale_c(value);
+  }
+
+  PropertyManager->SetDoubles(SetHandles.data(), SetValues.data(),
+                              SetHandles.size());
+  PropertyManager->GetDoubles(GetHandles.data(), GetValues.data(),
+                              GetHandles.size());
+
+  ostringstream buf;
+  buf << setprecision(17);
+  for (size_t i=0; i<GetValues.size(); ++i) {
+    if (i > 0) buf << ' ';
+    buf << GetValues[i];
+  }
+  buf << "\r\n";
+  socket->Reply(buf.str(), false);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+// The values of the binary frames are little endian doubles.
+static void SwapIfBigEndian(char* bytes)
+{
+  const uint16_t one = 1;
+  if (*reinterpret_cast<const char*>(&one) != 1) {
+    for (size_t i=0; i<sizeof(double)/2; ++i)
+      swap(bytes[i], bytes[sizeof(double)-1-i]);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGInputSocket::ReadBinaryFrame(const char* frame)
+{
+  char bytes[sizeof(double)];
+
+  for (size_t i=0; i<SetValues.size(); ++i) {
+    memcpy(bytes, frame + i*sizeof(double), sizeof(double));
+    SwapIfBigEndian(bytes);
+    memcpy(&SetValues[i], bytes, sizeof(double));
+  }
+
+  PropertyManager->SetDoubles(SetHandles.data(), SetValues.data(),
+                              SetHandles.size());
+  PropertyManager->GetDoubles(GetHandles.data(), GetValues.data(),
+                              GetHandles.size());
+
+  FrameReply.assign("JSBF");
+  for (double value: GetValues) {
+    memcpy(bytes, &value, sizeof(double));
+    SwapIfBigEndian(bytes);
+    FrameReply.append(bytes, sizeof(double));
+  }
+  socket->Reply(FrameReply, false);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGInputSocket::ResetSession(void)
+{
+  SetHandles.clear();
+  GetHandles.clear();
+  SetValues.clear();
+  GetValues.clear();
 }
 
 }
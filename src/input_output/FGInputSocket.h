@@ -53,6 +53,30 @@ CLASS DOCUMENTATION
 
 /** Implements the input from a socket. This class inputs data from a telnet
     session. This is a leaf class.
+
+    In addition to the commands that get or set one property at a time, a
+    client can exchange the values of many properties in a single packet per
+    frame. The properties are first registered for the session:
+
+    - <tt>subscribe set {property} ...</tt> registers the properties that are
+      set by each frame,
+    - <tt>subscribe get {property} ...</tt> registers the properties whose
+      values are returned by each frame,
+    - <tt>unsubscribe</tt> clears both lists.
+
+    Each frame then carries the values of the "set" properties and is answered
+    with the values of the "get" properties, in the order in which they have
+    been subscribed. A frame is either
+    - a text line <tt>frame {value} ...</tt> which is answered with a line of
+      the values separated by spaces, or
+    - a binary packet made of the 4 characters "JSBF" followed by the values as
+      little endian doubles, which is answered in the same format.
+
+    Frames are not followed by the "JSBSim> " prompt and binary packets can be
+    interleaved with text commands. The values that are returned are those of
+    the properties when the frame is processed, i.e. before the time step
+    during which the new inputs are used. The subscriptions are cleared when a
+    new client connects.
  */
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -89,6 +113,19 @@ protected:
   FGfdmSocket::ProtocolType SockProtocol;
   std::string data;
   bool BlockingInput;
+
+private:
+  unsigned int Session = 0;
+  std::vector<FGPropertyManager::PropertyHandle> SetHandles, GetHandles;
+  std::vector<double> SetValues, GetValues;
+  std::string FrameReply;
+
+  /// Executes a text command. Returns false if the session is closed.
+  bool Execute(const std::string& line, bool Holding);
+  void Subscribe(const std::vector<std::string>& tokens);
+  void ReadTextFrame(const std::vector<std::string>& tokens);
+  void ReadBinaryFrame(const char* frame);
+  void ResetSession(void);
 };
 }
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -37,6 +37,7 @@ HISTORY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include "FGFDMExec.h"
 #include "FGJSBBase.h"
 #include "FGModelLoader.h"
 #include "FGXMLFileRead.h"
@@ -56,7 +57,7 @@ Element_ptr FGModelLoader::Open(Element *el)
   string fname = el->GetAttributeValue("file");
 
   if (!fname.empty()) {
-    FGXMLFileRead XMLFileRead;
+    FGXMLFileRead XMLFileRead(model->GetExec()->GetDocumentCache());
     SGPath path(SGPath::fromUtf8(fname.c_str()));
 
     if (path.isRelative())
@@ -0,0 +1,106 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+  Module:       FGOutputBinaryFile.cpp
+  Author:       Dawn Aerospace
+  Date started: October 2026
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU Lesser General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option) any
+  later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+
+  You should have received a copy of the GNU Lesser General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc., 59
+  Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+  Further information about the GNU Lesser General Public License can also be
+  found on the world wide web at http://www.gnu.org.
+
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  INCLUDES
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstring>
+
+#include "FGOutputBinaryFile.h"
+#include "input_output/FGXMLElement.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  CLASS IMPLEMENTATION
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+bool FGOutputBinaryFile::Load(Element* el)
+{
+  if (!FGOutputFile::Load(el))
+    return false;
+
+  if (SubSystems) {
+    cerr << el->ReadFrom() << fgred
+         << "  The subsystems are not recorded by the BINARY output. Use"
+         << " <property> elements instead." << reset << endl;
+  }
+
+  Format = FGBinaryRecord::ReadFormat(el);
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGOutputBinaryFile::OpenFile(void)
+{
+  datafile.clear();
+  datafile.open(Filename, ios::out | ios::binary);
+  if (!datafile) {
+    cerr << endl << fgred << highint << "ERROR: unable to open the file "
+         << reset << Filename.c_str() << endl
+         << fgred << highint << "       => Output to this file is disabled."
+         << reset << endl << endl;
+    Disable();
+    return false;
+  }
+
+  Record.Build(FDMExec, OutputParameters, OutputCaptions, OutputUnits,
+               PreFunctions, Format);
+
+  const vector<char>& header = Record.GetHeader();
+  datafile.write(header.data(), header.size());
+  datafile.flush();
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputBinaryFile::Print(void)
+{
+  const vector<char>& record = Record.Pack();
+  datafile.write(record.data(), record.size());
+  datafile.flush();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputBinaryFile::TakeSnapshot(char* record)
+{
+  const vector<char>& packed = Record.Pack();
+  memcpy(record, packed.data(), packed.size());
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputBinaryFile::PrintSnapshot(const char* record)
+{
+  datafile.write(record, Record.GetRecordSize());
+  datafile.flush();
+}
+}
@@ -0,0 +1,278 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+  Module:       FGOutputColumnarFile.cpp
+  Author:       Dawn Aerospace
+  Date started: October 2026
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU Lesser General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option) any
+  later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+
+  You should have received a copy of the GNU Lesser General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc., 59
+  Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+  Further information about the GNU Lesser General Public License can also be
+  found on the world wide web at http://www.gnu.org.
+
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  INCLUDES
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstring>
+
+#include "FGOutputColumnarFile.h"
+#include "FGBinaryRecord.h"
+#include "math/FGFunction.h"
+#include "math/FGFunctionValue.h"
+#include "input_output/FGXMLElement.h"
+#include "input_output/string_utilities.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  CLASS IMPLEMENTATION
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+template<typename T>
+static void Append(vector<char>& buffer, T value)
+{
+  size_t size = buffer.size();
+  buffer.resize(size + sizeof(T));
+  FGColumnarCodec::Store(&buffer[size], value);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+static void AppendString(vector<char>& buffer, const string& s)
+{
+  uint16_t length = static_cast<uint16_t>(min<size_t>(s.size(), UINT16_MAX));
+  Append(buffer, length);
+  buffer.insert(buffer.end(), s.begin(), s.begin()+length);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGOutputColumnarFile::~FGOutputColumnarFile()
+{
+  // The index must be written before the members are destroyed.
+  StopAsync();
+  CloseFile();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGOutputColumnarFile::Load(Element* el)
+{
+  if (!FGOutputFile::Load(el))
+    return false;
+
+  if (SubSystems) {
+    cerr << el->ReadFrom() << fgred
+         << "  The subsystems are not recorded by the COLUMNAR output. Use"
+         << " <property> elements instead." << reset << endl;
+  }
+
+  string compression = el->GetAttributeValue("compression");
+  to_lower(compression);
+
+  if (compression == "none")
+    Compression = FGColumnarCodec::eRaw;
+  else if (compression == "delta")
+    Compression = FGColumnarCodec::eDelta;
+  else if (compression.empty() || compression == "xor")
+    Compression = FGColumnarCodec::eXor;
+  else {
+    cerr << el->ReadFrom() << fgred << "  Unknown compression " << compression
+         << ". The values will be XOR compressed." << reset << endl;
+    Compression = FGColumnarCodec::eXor;
+  }
+
+  if (el->HasAttribute("chunk")) {
+    double chunk = el->GetAttributeValueAsNumber("chunk");
+    if (chunk >= 1.0 && chunk <= UINT32_MAX)
+      ChunkSize = static_cast<size_t>(chunk);
+    else {
+      cerr << el->ReadFrom() << fgred << "  Illegal chunk size " << chunk
+           << ". Using " << ChunkSize << " records instead." << reset << endl;
+    }
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGOutputColumnarFile::OpenFile(void)
+{
+  CloseFile();
+
+  datafile.clear();
+  datafile.open(Filename, ios::out | ios::binary);
+  if (!datafile) {
+    cerr << endl << fgred << highint << "ERROR: unable to open the file "
+         << reset << Filename.c_str() << endl
+         << fgred << highint << "       => Output to this file is disabled."
+         << reset << endl << endl;
+    Disable();
+    return false;
+  }
+
+  vector<char> header(FGColumnarCodec::FileMagic, FGColumnarCodec::FileMagic+8);
+  Append<uint32_t>(header, FGColumnarCodec::Version);
+  Append<uint32_t>(header, 0);  // Number of columns, set below
+  Append<uint32_t>(header, ChunkSize);
+  Append<uint32_t>(header, 0);  // Header size, set below
+
+  Sources.clear();
+  Encodings.clear();
+
+  auto AddColumn = [&](const FGParameter* source, const string& name,
+                       const string& unit, FGColumnarCodec::eEncoding encoding)
+  {
+    Sources.push_back(source);
+    Encodings.push_back(encoding);
+    header.push_back(static_cast<char>(encoding));
+    AppendString(header, name);
+    AppendString(header, unit);
+  };
+
+  auto PropertyManager = FDMExec->GetPropertyManager();
+  SimTime = new FGPropertyValue(PropertyManager->GetNode("simulation/sim-time-sec"));
+  AddColumn(SimTime, "Time", "sec",
+            Compression == FGColumnarCodec::eRaw ? FGColumnarCodec::eRaw
+                                                 : FGColumnarCodec::eDelta);
+
+  for (unsigned int i=0; i<OutputParameters.size(); ++i) {
+    const FGPropertyValue* param = OutputParameters[i];
+    string unit;
+    if (i < OutputUnits.size() && !OutputUnits[i].empty())
+      unit = OutputUnits[i];
+    else if (!dynamic_cast<const FGFunctionValue*>(param))
+      unit = FGBinaryRecord::GetUnit(param->GetName());
+
+    if (i < OutputCaptions.size() && !OutputCaptions[i].empty())
+      AddColumn(param, OutputCaptions[i], unit, Compression);
+    else
+      AddColumn(param, param->GetFullyQualifiedName(), unit, Compression);
+  }
+
+  for (auto& f: PreFunctions)
+    AddColumn(f.get(), f->GetName(), "", Compression);
+
+  while (header.size() % 8) header.push_back('\0');
+  FGColumnarCodec::Store<uint32_t>(&header[12], Sources.size());
+  FGColumnarCodec::Store<uint32_t>(&header[20], header.size());
+
+  datafile.write(header.data(), header.size());
+  datafile.flush();
+  Offset = header.size();
+
+  // Allocate the buffers once for all so that the outputs do not allocate
+  // memory while the simulation is running.
+  Values.assign(Sources.size()*ChunkSize, 0.0);
+  Buffer.resize(24 + 8*Sources.size()
+                + Sources.size()*FGColumnarCodec::GetMaxSize(ChunkSize));
+  Rows = 0;
+  Index.clear();
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputColumnarFile::CloseFile(void)
+{
+  if (!datafile.is_open()) return;
+
+  if (Rows > 0) WriteChunk();
+
+  vector<char> index(FGColumnarCodec::IndexMagic,
+                     FGColumnarCodec::IndexMagic+8);
+  Append<uint64_t>(index, Index.size());
+  for (auto& chunk: Index) {
+    Append(index, chunk.offset);
+    Append(index, chunk.rows);
+    Append(index, chunk.first);
+    Append(index, chunk.last);
+  }
+  Append(index, Offset);
+  index.insert(index.end(), FGColumnarCodec::EndMagic,
+               FGColumnarCodec::EndMagic+8);
+
+  datafile.write(index.data(), index.size());
+  datafile.close();
+  Index.clear();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputColumnarFile::Print(void)
+{
+  for (size_t i=0; i<Sources.size(); ++i)
+    Values[i*ChunkSize + Rows] = Sources[i]->GetValue();
+
+  if (++Rows == ChunkSize) WriteChunk();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputColumnarFile::TakeSnapshot(char* record)
+{
+  double* values = reinterpret_cast<double*>(record);
+
+  for (auto source: Sources)
+    *values++ = source->GetValue();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputColumnarFile::PrintSnapshot(const char* record)
+{
+  const double* values = reinterpret_cast<const double*>(record);
+
+  for (size_t i=0; i<Sources.size(); ++i)
+    Values[i*ChunkSize + Rows] = values[i];
+
+  if (++Rows == ChunkSize) WriteChunk();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputColumnarFile::WriteChunk(void)
+{
+  size_t numColumns = Sources.size();
+  char* header = Buffer.data();
+  char* block = header + 24 + 8*numColumns;
+
+  memcpy(header, FGColumnarCodec::ChunkMagic, 4);
+  FGColumnarCodec::Store<uint32_t>(header+4, Rows);
+  FGColumnarCodec::Store(header+8, Values[0]);
+  FGColumnarCodec::Store(header+16, Values[Rows-1]);
+
+  for (size_t i=0; i<numColumns; ++i) {
+    size_t size = FGColumnarCodec::Encode(&Values[i*ChunkSize], Rows,
+                                          Encodings[i], block);
+    FGColumnarCodec::Store<uint64_t>(header+24+8*i, size);
+    block += size;
+  }
+
+  size_t size = block - header;
+  datafile.write(header, size);
+  // Flush each chunk so that the file remains readable if the simulation is
+  // interrupted.
+  datafile.flush();
+
+  Index.push_back({Offset, Rows, Values[0], Values[Rows-1]});
+  Offset += size;
+  Rows = 0;
+}
+}
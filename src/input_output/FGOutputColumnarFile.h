@@ -0,0 +1,138 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+  Header: FGOutputColumnarFile.h
+  Author: Dawn Aerospace
+  Date started: October 2026
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU Lesser General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option) any
+  later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+
+  You should have received a copy of the GNU Lesser General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc., 59
+  Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+  Further information about the GNU Lesser General Public License can also be
+  found on the world wide web at http://www.gnu.org.
+
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  SENTRY
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGOUTPUTCOLUMNARFILE_H
+#define FGOUTPUTCOLUMNARFILE_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  INCLUDES
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include "FGOutputFile.h"
+#include "FGColumnarCodec.h"
+#include "math/FGParameter.h"
+#include "simgear/io/iostreams/sgstream.hxx"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  FORWARD DECLARATIONS
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  CLASS DOCUMENTATION
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Implements the output to a columnar file. The records are buffered in
+    chunks and each chunk is written column by column, so that a reader can
+    extract a single channel over a time window without parsing the other
+    columns. An index of the chunks is appended to the file when it is closed.
+    See FGColumnarCodec for the layout of the file.
+
+    The columns are the simulation time, the properties and the functions of
+    the output directive; the subsystems flags are not supported by this
+    output. The values are stored as doubles and the compression is lossless.
+    The following attributes are accepted:
+    - compression: "xor" (default) XOR's each value with the previous one,
+      "delta" stores the differences between consecutive values and "none"
+      stores the raw values. Unless the compression is "none", the time is
+      always delta encoded.
+    - chunk: the number of records per chunk (4096 by default).
+
+    The unit of a column is given by the attribute unit of its property or is
+    otherwise taken from the name of the property (see FGBinaryRecord).
+
+    @code
+    <output name="flight.col" type="COLUMNAR" rate="50">
+      <property> position/h-sl-ft </property>
+      <property caption="alpha"> aero/alpha-deg </property>
+      <property unit="g"> accelerations/Nz </property>
+    </output>
+    @endcode
+
+    The files can be read with FGColumnarReader, from Python with
+    jsbsim.ColumnarReader, and plotted directly with utilities/prep_plot.
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  CLASS DECLARATION
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGOutputColumnarFile : public FGOutputFile
+{
+public:
+  /// Constructor
+  FGOutputColumnarFile(FGFDMExec* fdmex) : FGOutputFile(fdmex) {}
+
+  /// Destructor: writes the pending records and the index.
+  ~FGOutputColumnarFile() override;
+
+  /** Init the output directives from an XML file.
+      @param element XML Element that is pointing to the output directives
+  */
+  bool Load(Element* el) override;
+
+  /// Generates the output to the columnar file.
+  void Print(void) override;
+
+protected:
+  sg_ofstream datafile;
+
+  size_t GetSnapshotSize(void) const override
+  { return Sources.size() * sizeof(double); }
+  void TakeSnapshot(char* record) override;
+  void PrintSnapshot(const char* record) override;
+
+  bool OpenFile(void) override;
+  void CloseFile(void) override;
+
+private:
+  struct ChunkEntry {
+    uint64_t offset;
+    uint64_t rows;
+    double first;
+    double last;
+  };
+
+  FGColumnarCodec::eEncoding Compression = FGColumnarCodec::eXor;
+  size_t ChunkSize = 4096;
+
+  FGParameter_ptr SimTime;
+  std::vector<const FGParameter*> Sources;
+  std::vector<FGColumnarCodec::eEncoding> Encodings;
+  // The values of the current chunk, column after column.
+  std::vector<double> Values;
+  size_t Rows = 0;
+  std::vector<char> Buffer;
+  std::vector<ChunkEntry> Index;
+  uint64_t Offset = 0;
+
+  void WriteChunk(void);
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
@@ -87,6 +87,7 @@ void FGOutputFile::SetStartNewOutput(void)
     Filename = SGPath(buf.str());
   }
 
+  Flush();
   CloseFile();
 }
 
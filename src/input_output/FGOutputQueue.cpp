@@ -0,0 +1,160 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+  Module:       FGOutputQueue.cpp
+  Author:       Dawn Aerospace
+  Date started: October 2026
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU Lesser General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option) any
+  later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+
+  You should have received a copy of the GNU Lesser General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc., 59
+  Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+  Further information about the GNU Lesser General Public License can also be
+  found on the world wide web at http://www.gnu.org.
+
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  INCLUDES
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstring>
+
+#include "FGOutputQueue.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  CLASS IMPLEMENTATION
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+FGOutputQueue::FGOutputQueue(size_t recordSize, size_t capacity,
+                             ePolicy policy,
+                             function<void(const char*)> writer)
+  : RecordSize(recordSize), Capacity(capacity > 0 ? capacity : 1),
+    Policy(policy), Writer(writer), Records(RecordSize*Capacity)
+{
+  Thread = thread(&FGOutputQueue::Work, this);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGOutputQueue::~FGOutputQueue()
+{
+  {
+    lock_guard<mutex> lock(Mutex);
+    Stop = true;
+  }
+  NotEmpty.notify_one();
+  Thread.join();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputQueue::Push(const char* record)
+{
+  {
+    unique_lock<mutex> lock(Mutex);
+
+    if (Count == Capacity) {
+      switch (Policy) {
+      case pBlock:
+        NotFull.wait(lock, [this]{ return Count < Capacity; });
+        break;
+      case pDropOldest:
+        Head = (Head + 1) % Capacity;
+        --Count;
+        ++Dropped;
+        break;
+      case pDropNewest:
+        ++Dropped;
+        return;
+      }
+    }
+
+    size_t tail = (Head + Count) % Capacity;
+    memcpy(&Records[tail*RecordSize], record, RecordSize);
+    ++Count;
+  }
+  NotEmpty.notify_one();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputQueue::Flush(void)
+{
+  unique_lock<mutex> lock(Mutex);
+  NotFull.wait(lock, [this]{ return Count == 0 && !Busy; });
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+unsigned long FGOutputQueue::GetDropped(void) const
+{
+  lock_guard<mutex> lock(Mutex);
+  return Dropped;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+unsigned long FGOutputQueue::GetWritten(void) const
+{
+  lock_guard<mutex> lock(Mutex);
+  return Written;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputQueue::Work(void)
+{
+  // The record is copied out of the ring buffer so that the simulation thread
+  // can reuse its slot while it is being written.
+  vector<char> record(RecordSize);
+
+  unique_lock<mutex> lock(Mutex);
+
+  while (true) {
+    NotEmpty.wait(lock, [this]{ return Count > 0 || Stop; });
+    if (Count == 0) break;  // Stop has been requested and the queue is empty.
+
+    memcpy(record.data(), &Records[Head*RecordSize], RecordSize);
+    Head = (Head + 1) % Capacity;
+    --Count;
+    Busy = true;
+
+    lock.unlock();
+    NotFull.notify_all();
+    Writer(record.data());
+    lock.lock();
+
+    Busy = false;
+    ++Written;
+    NotFull.notify_all();
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGOutputQueue::GetPolicy(const string& name, ePolicy& policy)
+{
+  if (name == "block")
+    policy = pBlock;
+  else if (name == "drop-oldest")
+    policy = pDropOldest;
+  else if (name == "drop-newest")
+    policy = pDropNewest;
+  else
+    return false;
+
+  return true;
+}
+}
@@ -0,0 +1,128 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+  Header: FGOutputQueue.h
+  Author: Dawn Aerospace
+  Date started: October 2026
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU Lesser General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option) any
+  later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+
+  You should have received a copy of the GNU Lesser General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc., 59
+  Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+  Further information about the GNU Lesser General Public License can also be
+  found on the world wide web at http://www.gnu.org.
+
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  SENTRY
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGOUTPUTQUEUE_H
+#define FGOUTPUTQUEUE_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  INCLUDES
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  FORWARD DECLARATIONS
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  CLASS DOCUMENTATION
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Queue of the records of an asynchronous output.
+    The simulation thread pushes fixed size records (snapshots of the values to
+    output) into a ring buffer that is allocated once by the constructor. A
+    writer thread pops the records and passes them to the writer function which
+    formats them and performs the I/O.
+
+    When the ring buffer is full, the policy selects what happens to the record
+    that is pushed:
+    - pBlock: the simulation thread waits until the writer thread has made some
+      room. No record is lost.
+    - pDropOldest: the oldest record of the queue is discarded.
+    - pDropNewest: the record that is pushed is discarded.
+
+    The number of records that have been discarded is returned by GetDropped().
+*/
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  CLASS DECLARATION
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGOutputQueue
+{
+public:
+  enum ePolicy {pBlock, pDropOldest, pDropNewest};
+
+  /** Constructor. Starts the writer thread.
+      @param recordSize size in bytes of the records
+      @param capacity number of records that the queue can hold
+      @param policy behavior of Push() when the queue is full
+      @param writer function called by the writer thread for each record */
+  FGOutputQueue(size_t recordSize, size_t capacity, ePolicy policy,
+                std::function<void(const char*)> writer);
+
+  /// Destructor: writes the records left in the queue and stops the thread.
+  ~FGOutputQueue();
+
+  /** Copies a record into the queue. The method neither allocates memory nor
+      performs any I/O. It only waits for the writer thread with the pBlock
+      policy when the queue is full. */
+  void Push(const char* record);
+
+  /// Waits until all the records of the queue have been written.
+  void Flush(void);
+
+  /// Returns the number of records that have been discarded.
+  unsigned long GetDropped(void) const;
+  /// Returns the number of records that have been written.
+  unsigned long GetWritten(void) const;
+
+  /** Converts a policy name ("block", "drop-oldest" or "drop-newest") to its
+      value.
+      @return false if the name is unknown. */
+  static bool GetPolicy(const std::string& name, ePolicy& policy);
+
+private:
+  const size_t RecordSize;
+  const size_t Capacity;
+  const ePolicy Policy;
+  std::function<void(const char*)> Writer;
+
+  std::vector<char> Records;
+  size_t Head = 0;
+  size_t Count = 0;
+  bool Busy = false;
+  bool Stop = false;
+  unsigned long Dropped = 0;
+  unsigned long Written = 0;
+
+  mutable std::mutex Mutex;
+  std::condition_variable NotEmpty;
+  std::condition_variable NotFull;
+  std::thread Thread;
+
+  void Work(void);
+};
+}
+#endif
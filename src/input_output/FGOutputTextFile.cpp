@@ -94,7 +94,10 @@ bool FGOutputTextFile::OpenFile(void)
     return false;
   }
 
-  string scratch = "";
+  string scratch = Filename.utf8Str();
+  toCout = to_upper(scratch) == "COUT";
+
+  scratch = "";
   streambuf* buffer = datafile.rdbuf();
   ostream outstream(buffer);
 
@@ -246,15 +249,9 @@ bool FGOutputTextFile::OpenFile(void)
 
 void FGOutputTextFile::Print(void)
 {
-  streambuf* buffer;
-  string scratch = Filename.utf8Str();
-
-  if (to_upper(scratch) == "COUT") {
-    buffer = cout.rdbuf();
-  } else {
-    buffer = datafile.rdbuf();
-  }
-
+  // The values are written straight to the file buffer so that no memory is
+  // allocated while the simulation is running.
+  streambuf* buffer = toCout ? cout.rdbuf() : datafile.rdbuf();
   ostream outstream(buffer);
 
   outstream.precision(10);
@@ -276,9 +273,11 @@ void FGOutputTextFile::Print(void)
   }
   if (SubSystems & ssRates) {
     outstream << delimeter;
-    outstream << (radtodeg*Propagate->GetPQR()).Dump(delimeter) << delimeter;
-    outstream << (radtodeg*Accelerations->GetPQRdot()).Dump(delimeter) << delimeter;
-    outstream << (radtodeg*Propagate->GetPQRi()).Dump(delimeter);
+    (radtodeg*Propagate->GetPQR()).Dump(outstream, delimeter);
+    outstream << delimeter;
+    (radtodeg*Accelerations->GetPQRdot()).Dump(outstream, delimeter);
+    outstream << delimeter;
+    (radtodeg*Propagate->GetPQRi()).Dump(outstream, delimeter);
   }
   if (SubSystems & ssVelocities) {
     outstream << delimeter;
@@ -286,37 +285,57 @@ void FGOutputTextFile::Print(void)
     outstream << Auxiliary->GetReynoldsNumber() << delimeter;
     outstream << setprecision(12) << Auxiliary->GetVt() << delimeter;
     outstream << Propagate->GetInertialVelocityMagnitude() << delimeter;
-    outstream << setprecision(12) << Propagate->GetUVW().Dump(delimeter) << delimeter;
-    outstream << setprecision(12) << Accelerations->GetUVWdot().Dump(delimeter) << delimeter;
-    outstream << setprecision(12) << Accelerations->GetUVWidot().Dump(delimeter) << delimeter;
-    outstream << setprecision(12) << Accelerations->GetBodyAccel().Dump(delimeter) << delimeter;
-    outstream << Auxiliary->GetAeroUVW().Dump(delimeter) << delimeter;
-    outstream << Propagate->GetInertialVelocity().Dump(delimeter) << delimeter;
-    outstream << Propagate->GetECEFVelocity().Dump(delimeter) << delimeter;
-    outstream << Propagate->GetVel().Dump(delimeter);
+    Propagate->GetUVW().Dump(outstream, delimeter);
+    outstream << delimeter;
+    Accelerations->GetUVWdot().Dump(outstream, delimeter);
+    outstream << delimeter;
+    Accelerations->GetUVWidot().Dump(outstream, delimeter);
+    outstream << delimeter;
+    Accelerations->GetBodyAccel().Dump(outstream, delimeter);
+    outstream << delimeter;
+    Auxiliary->GetAeroUVW().Dump(outstream, delimeter);
+    outstream << delimeter;
+    Propagate->GetInertialVelocity().Dump(outstream, delimeter);
+    outstream << delimeter;
+    Propagate->GetECEFVelocity().Dump(outstream, delimeter);
+    outstream << delimeter;
+    Propagate->GetVel().Dump(outstream, delimeter);
     outstream.precision(10);
   }
   if (SubSystems & ssForces) {
     outstream << delimeter;
-    outstream << Aerodynamics->GetvFw().Dump(delimeter) << delimeter;
+    Aerodynamics->GetvFw().Dump(outstream, delimeter);
+    outstream << delimeter;
     outstream << Aerodynamics->GetLoD() << delimeter;
-    outstream << Aerodynamics->GetForces().Dump(delimeter) << delimeter;
-    outstream << Propulsion->GetForces().Dump(delimeter) << delimeter;
-    outstream << Accelerations->GetGroundForces().Dump(delimeter) << delimeter;
-    outstream << ExternalReactions->GetForces().Dump(delimeter) << delimeter;
-    outstream << BuoyantForces->GetForces().Dump(delimeter) << delimeter;
-    outstream << Accelerations->GetWeight().Dump(delimeter) << delimeter;
-    outstream << Accelerations->GetForces().Dump(delimeter);
+    Aerodynamics->GetForces().Dump(outstream, delimeter);
+    outstream << delimeter;
+    Propulsion->GetForces().Dump(outstream, delimeter);
+    outstream << delimeter;
+    Accelerations->GetGroundForces().Dump(outstream, delimeter);
+    outstream << delimeter;
+    ExternalReactions->GetForces().Dump(outstream, delimeter);
+    outstream << delimeter;
+    BuoyantForces->GetForces().Dump(outstream, delimeter);
+    outstream << delimeter;
+    Accelerations->GetWeight().Dump(outstream, delimeter);
+    outstream << delimeter;
+    Accelerations->GetForces().Dump(outstream, delimeter);
   }
   if (SubSystems & ssMoments) {
     outstream << delimeter;
-    outstream << Aerodynamics->GetMoments().Dump(delimeter) << delimeter;
-    outstream << Aerodynamics->GetMomentsMRC().Dump(delimeter) << delimeter;
-    outstream << Propulsion->GetMoments().Dump(delimeter) << delimeter;
-    outstream << Accelerations->GetGroundMoments().Dump(delimeter) << delimeter;
-    outstream << ExternalReactions->GetMoments().Dump(delimeter) << delimeter;
-    outstream << BuoyantForces->GetMoments().Dump(delimeter) << delimeter;
-    outstream << Accelerations->GetMoments().Dump(delimeter);
+    Aerodynamics->GetMoments().Dump(outstream, delimeter);
+    outstream << delimeter;
+    Aerodynamics->GetMomentsMRC().Dump(outstream, delimeter);
+    outstream << delimeter;
+    Propulsion->GetMoments().Dump(outstream, delimeter);
+    outstream << delimeter;
+    Accelerations->GetGroundMoments().Dump(outstream, delimeter);
+    outstream << delimeter;
+    ExternalReactions->GetMoments().Dump(outstream, delimeter);
+    outstream << delimeter;
+    BuoyantForces->GetMoments().Dump(outstream, delimeter);
+    outstream << delimeter;
+    Accelerations->GetMoments().Dump(outstream, delimeter);
   }
   if (SubSystems & ssAtmosphere) {
     outstream << delimeter;
@@ -328,55 +347,66 @@ void FGOutputTextFile::Print(void)
     outstream << Atmosphere->GetPressure() << delimeter;
     outstream << Winds->GetTurbMagnitude() << delimeter;
     outstream << Winds->GetTurbDirection() << delimeter;
-    outstream << Winds->GetTotalWindNED().Dump(delimeter) << delimeter;
-    outstream << (Winds->GetTurbPQR()*radtodeg).Dump(delimeter);
+    Winds->GetTotalWindNED().Dump(outstream, delimeter);
+    outstream << delimeter;
+    (Winds->GetTurbPQR()*radtodeg).Dump(outstream, delimeter);
   }
   if (SubSystems & ssMassProps) {
     outstream << delimeter;
-    outstream << MassBalance->GetJ().Dump(delimeter) << delimeter;
+    MassBalance->GetJ().Dump(outstream, delimeter);
+    outstream << delimeter;
     outstream << MassBalance->GetMass() << delimeter;
     outstream << MassBalance->GetWeight() << delimeter;
-    outstream << MassBalance->GetXYZcg().Dump(delimeter);
+    MassBalance->GetXYZcg().Dump(outstream, delimeter);
   }
   if (SubSystems & ssPropagate) {
     outstream.precision(14);
     outstream << delimeter;
     outstream << Propagate->GetAltitudeASL() << delimeter;
     outstream << Propagate->GetDistanceAGL() << delimeter;
-    outstream << (radtodeg*Propagate->GetEuler()).Dump(delimeter) << delimeter;
-    outstream << Propagate->GetQuaternion().Dump(delimeter) << delimeter;
+    (radtodeg*Propagate->GetEuler()).Dump(outstream, delimeter);
+    outstream << delimeter;
+    Propagate->GetQuaternion().Dump(outstream, delimeter);
+    outstream << delimeter;
     FGQuaternion Qec = Propagate->GetQuaternionECEF();
-    outstream << Qec.Dump(delimeter) << delimeter;
-    outstream << Propagate->GetQuaternionECI().Dump(delimeter) << delimeter;
+    Qec.Dump(outstream, delimeter);
+    outstream << delimeter;
+    Propagate->GetQuaternionECI().Dump(outstream, delimeter);
+    outstream << delimeter;
     outstream << Auxiliary->Getalpha(inDegrees) << delimeter;
     outstream << Auxiliary->Getbeta(inDegrees) << delimeter;
     outstream << Propagate->GetLatitudeDeg() << delimeter;
     outstream << Propagate->GetGeodLatitudeDeg() << delimeter;
     outstream << Propagate->GetLongitudeDeg() << delimeter;
     outstream.precision(18);
-    outstream << ((FGColumnVector3)Propagate->GetInertialPosition()).Dump(delimeter) << delimeter;
-    outstream << ((FGColumnVector3)Propagate->GetLocation()).Dump(delimeter) << delimeter;
+    ((FGColumnVector3)Propagate->GetInertialPosition()).Dump(outstream, delimeter);
+    outstream << delimeter;
+    ((FGColumnVector3)Propagate->GetLocation()).Dump(outstream, delimeter);
+    outstream << delimeter;
     outstream.precision(14);
     outstream << Propagate->GetEarthPositionAngleDeg() << delimeter;
     outstream << Propagate->GetDistanceAGL() << delimeter;
     outstream << Propagate->GetTerrainElevation();
     outstream.precision(10);
   }
+  // The values below are written with the default precision of a stream.
   if (SubSystems & ssAeroFunctions) {
-    scratch = Aerodynamics->GetAeroFunctionValues(delimeter);
-    if (scratch.length() != 0) outstream << delimeter << scratch;
+    outstream.precision(6);
+    Aerodynamics->GetAeroFunctionValues(outstream, delimeter);
   }
   if (SubSystems & ssFCS) {
-    scratch = FCS->GetComponentValues(delimeter);
-    if (scratch.length() != 0) outstream << delimeter << scratch;
+    outstream.precision(6);
+    FCS->GetComponentValues(outstream, delimeter);
   }
   if (SubSystems & ssGroundReactions) {
     outstream << delimeter;
-    outstream << GroundReactions->GetGroundReactionValues(delimeter);
+    outstream.precision(6);
+    GroundReactions->GetGroundReactionValues(outstream, delimeter);
   }
   if (SubSystems & ssPropulsion && Propulsion->GetNumEngines() > 0) {
     outstream << delimeter;
-    outstream << Propulsion->GetPropulsionValues(delimeter);
+    outstream.precision(6);
+    Propulsion->GetPropulsionValues(outstream, delimeter);
   }
 
   outstream.precision(18);
@@ -391,4 +421,49 @@ void FGOutputTextFile::Print(void)
   outstream << endl;
   outstream.flush();
 }
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+size_t FGOutputTextFile::GetSnapshotSize(void) const
+{
+  // The subsystems values are read from the models by Print() and cannot be
+  // formatted by the writer thread.
+  if (SubSystems) return 0;
+
+  return (1 + OutputParameters.size() + PreFunctions.size()) * sizeof(double);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputTextFile::TakeSnapshot(char* record)
+{
+  double* values = reinterpret_cast<double*>(record);
+
+  *values++ = FDMExec->GetSimTime();
+  for (auto param: OutputParameters)
+    *values++ = param->GetValue();
+  for (auto& f: PreFunctions)
+    *values++ = f->getDoubleValue();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputTextFile::PrintSnapshot(const char* record)
+{
+  const double* values = reinterpret_cast<const double*>(record);
+  streambuf* buffer = toCout ? cout.rdbuf() : datafile.rdbuf();
+  ostream outstream(buffer);
+
+  // Same format as Print()
+  outstream.precision(10);
+  outstream << *values++;
+
+  outstream.precision(18);
+  size_t n = OutputParameters.size() + PreFunctions.size();
+  for (size_t i=0; i<n; ++i)
+    outstream << delimeter << *values++;
+
+  outstream << endl;
+  outstream.flush();
+}
 }
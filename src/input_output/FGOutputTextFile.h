@@ -56,6 +56,9 @@ CLASS DOCUMENTATION
 /** Implements the output to a human readable text file. This class uses the
     standard C++ library to open and close a file to which output values are
     comma-separated (CSV) or tabulated (TAB).
+
+    The output can only be asynchronous (see FGOutputType) when no subsystem is
+    selected i.e. when the output only consists of properties and functions.
  */
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -85,9 +88,14 @@ public:
 protected:
   std::string delimeter;
   sg_ofstream datafile;
+  bool toCout = false;
 
   bool OpenFile(void) override;
   void CloseFile(void) override { if (datafile.is_open()) datafile.close(); }
+
+  size_t GetSnapshotSize(void) const override;
+  void TakeSnapshot(char* record) override;
+  void PrintSnapshot(const char* record) override;
 };
 }
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -37,6 +37,7 @@ HISTORY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <cassert>
 #include <ostream>
 
 #include "FGFDMExec.h"
@@ -80,6 +81,10 @@ FGOutputType::FGOutputType(FGFDMExec* fdmex) :
 
 FGOutputType::~FGOutputType()
 {
+  // The writer thread calls PrintSnapshot() so it must be stopped before the
+  // derived class is destroyed (see StopAsync()).
+  assert(!Queue);
+
   for (auto param: OutputParameters)
     delete param;
 
@@ -94,6 +99,7 @@ void FGOutputType::SetIdx(unsigned int idx)
 
   PropertyManager->Tie(outputProp + "/log_rate_hz", this, &FGOutputType::GetRateHz, &FGOutputType::SetRateHz);
   PropertyManager->Tie(outputProp + "/enabled", &enabled);
+  PropertyManager->Tie(outputProp + "/dropped-records", this, &FGOutputType::GetDroppedRecords);
   OutputIdx = idx;
 }
 
@@ -160,10 +166,26 @@ bool FGOutputType::Load(Element* element)
         OutputCaptions.push_back(property_element->GetAttributeValue("caption"));
       else
         OutputCaptions.push_back("");
+      OutputUnits.push_back(property_element->GetAttributeValue("unit"));
     }
     property_element = element->FindNextElement("property");
   }
 
+  if (element->HasAttribute("async")) {
+    FGOutputQueue::ePolicy policy;
+    string async = element->GetAttributeValue("async");
+    if (FGOutputQueue::GetPolicy(async, policy)) {
+      unsigned int capacity = AsyncCapacity;
+      if (element->HasAttribute("buffer"))
+        capacity = element->GetAttributeValueAsNumber("buffer");
+      SetAsync(policy, capacity);
+    }
+    else {
+      cerr << element->ReadFrom() << fgred << "  Unknown async policy "
+           << async << ". The output will be synchronous." << reset << endl;
+    }
+  }
+
   double outRate = 1.0;
   if (element->HasAttribute("rate"))
     outRate = element->GetAttributeValueAsNumber("rate");
@@ -177,6 +199,10 @@ bool FGOutputType::Load(Element* element)
 
 bool FGOutputType::InitModel(void)
 {
+  // The queued records are written before the output is reinitialized. The
+  // writer thread is then restarted by StartAsync().
+  StopAsync();
+
   bool ret = FGModel::InitModel();
 
   Debug(2);
@@ -191,7 +217,7 @@ bool FGOutputType::Run(void)
   if (!enabled) return true;
 
   RunPreFunctions();
-  Print();
+  Generate();
   RunPostFunctions();
 
   Debug(4);
@@ -201,6 +227,63 @@ bool FGOutputType::Run(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGOutputType::Generate(void)
+{
+  if (Queue) {
+    TakeSnapshot(Snapshot.data());
+    Queue->Push(Snapshot.data());
+  }
+  else
+    Print();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputType::StartAsync(void)
+{
+  if (!Async) return;
+
+  size_t size = GetSnapshotSize();
+  if (size == 0) {
+    cerr << fgred << "  The output " << Name << " cannot be asynchronous."
+         << " It will be synchronous." << reset << endl;
+    Async = false;
+    return;
+  }
+
+  Snapshot.resize(size);
+  Queue.reset(new FGOutputQueue(size, AsyncCapacity, AsyncPolicy,
+                                [this](const char* record) {
+                                  PrintSnapshot(record);
+                                }));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputType::StopAsync(void)
+{
+  Queue.reset();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputType::SetAsync(FGOutputQueue::ePolicy policy,
+                            unsigned int capacity)
+{
+  Async = true;
+  AsyncPolicy = policy;
+  AsyncCapacity = capacity;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+long FGOutputType::GetDroppedRecords(void) const
+{
+  return Queue ? Queue->GetDropped() : 0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGOutputType::SetRateHz(double rtHz)
 {
   rtHz = rtHz>1000?1000:(rtHz<0?0:rtHz);
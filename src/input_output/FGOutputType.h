@@ -41,6 +41,7 @@ INCLUDES
 #include <memory>
 
 #include "models/FGModel.h"
+#include "FGOutputQueue.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
@@ -83,6 +84,25 @@ CLASS DOCUMENTATION
     The class mimics some functionalities of FGModel (methods InitModel(),
     Run() and SetRate()). However it does not inherit from FGModel since it is
     conceptually different from the model paradigm.
+
+    The output can be made asynchronous with the attribute async of the output
+    directive. The simulation thread then only takes a snapshot of the values to
+    output and queues it, while a writer thread formats the values and performs
+    the I/O (see FGOutputQueue). The value of the attribute is the policy
+    applied when the queue is full ("block", "drop-oldest" or "drop-newest")
+    and the attribute buffer sets the number of records that the queue can
+    hold (256 by default):
+
+    @code
+    <output name="flight.csv" type="CSV" rate="100" async="drop-oldest" buffer="1024">
+      <property> position/h-sl-ft </property>
+    </output>
+    @endcode
+
+    The number of records that have been discarded is available from the
+    property simulation/output[n]/dropped-records. Only the output classes that
+    implement GetSnapshotSize(), TakeSnapshot() and PrintSnapshot() can be made
+    asynchronous; the other ones are printed synchronously.
  */
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -156,6 +176,34 @@ public:
    */
   virtual void Print(void) = 0;
 
+  /** Generates the output either synchronously with Print() or, if the output
+      is asynchronous, by queuing a snapshot of the values for the writer
+      thread. */
+  void Generate(void);
+
+  /** Starts the writer thread if the output is asynchronous. This method is
+      called by FGOutput once the output has been initialized. */
+  void StartAsync(void);
+
+  /** Writes the queued records and stops the writer thread. Since the writer
+      thread calls PrintSnapshot(), this method must be called before the
+      derived class is destroyed: by its destructor or by the owner of the
+      output (FGOutput does it before deleting its outputs). */
+  void StopAsync(void);
+
+  /** Makes the output asynchronous. Must be called before the output is
+      initialized.
+      @param policy behavior when the queue of records is full
+      @param capacity number of records that the queue can hold */
+  void SetAsync(FGOutputQueue::ePolicy policy, unsigned int capacity);
+
+  /** Waits until the writer thread has written all the queued records. This
+      method must be called before the output file or socket is closed. */
+  void Flush(void) { if (Queue) Queue->Flush(); }
+
+  /// Returns the number of records discarded by the asynchronous output.
+  long GetDroppedRecords(void) const;
+
   /** Reset the output prior to a restart of the simulation. This method should
       be called when the simulation is restarted with, for example, new initial
       conditions. When this method is executed the output instance can take
@@ -195,6 +243,7 @@ protected:
   int SubSystems;
   std::vector <FGPropertyValue*> OutputParameters;
   std::vector <std::string> OutputCaptions;
+  std::vector <std::string> OutputUnits;
   bool enabled;
 
   std::shared_ptr<FGAerodynamics> Aerodynamics;
@@ -211,7 +260,24 @@ protected:
   std::shared_ptr<FGExternalReactions> ExternalReactions;
   std::shared_ptr<FGBuoyantForces> BuoyantForces;
 
+  /** Returns the size in bytes of the snapshots taken by TakeSnapshot(). The
+      default value 0 denotes an output that cannot be asynchronous. */
+  virtual size_t GetSnapshotSize(void) const { return 0; }
+  /** Copies the values to output into a snapshot. This method is called by the
+      simulation thread. */
+  virtual void TakeSnapshot(char*) {}
+  /** Generates the output from a snapshot. This method is called by the writer
+      thread. */
+  virtual void PrintSnapshot(const char*) {}
+
   void Debug(int from) override;
+
+private:
+  bool Async = false;
+  FGOutputQueue::ePolicy AsyncPolicy = FGOutputQueue::pBlock;
+  unsigned int AsyncCapacity = 256;
+  std::unique_ptr<FGOutputQueue> Queue;
+  std::vector<char> Snapshot;
 };
 }
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -61,6 +61,59 @@ void FGPropertyManager::Unbind(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+constexpr FGPropertyManager::PropertyHandle FGPropertyManager::InvalidHandle;
+
+FGPropertyManager::PropertyHandle
+FGPropertyManager::GetHandle(const string& path, bool create)
+{
+  auto it = handleOfPath.find(path);
+  if (it != handleOfPath.end()) return it->second;
+
+  // The lookups of non existent properties are not cached: the property might
+  // be created later on.
+  auto node = static_cast<FGPropertyNode*>(root->getNode(path.c_str(), create));
+  if (!node) return InvalidHandle;
+
+  auto ret = handleOfNode.emplace(node, handles.size());
+  if (ret.second) handles.push_back(node);
+
+  PropertyHandle handle = ret.first->second;
+  handleOfPath[path] = handle;
+  return handle;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropertyManager::InvalidHandleError(PropertyHandle handle) const
+{
+  throw BaseException("Invalid property handle " + to_string(handle));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropertyManager::GetDoubles(const PropertyHandle* h, double* values,
+                                   size_t n) const
+{
+  for (size_t i=0; i<n; ++i)
+    values[i] = GetCheckedNode(h[i])->getDoubleValue();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropertyManager::SetDoubles(const PropertyHandle* h,
+                                   const double* values, size_t n)
+{
+  // The handles are all checked first so that an invalid handle does not
+  // leave the properties partially updated.
+  for (size_t i=0; i<n; ++i)
+    if (!IsValidHandle(h[i])) InvalidHandleError(h[i]);
+
+  for (size_t i=0; i<n; ++i)
+    handles[h[i]]->setDoubleValue(values[i]);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 string FGPropertyManager::mkPropertyName(string name, bool lowercase) {
 
   /* do this two pass to avoid problems with characters getting skipped
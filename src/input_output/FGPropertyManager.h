@@ -42,6 +42,8 @@ INCLUDES
 #endif
 
 #include <string>
+#include <unordered_map>
+#include <vector>
 #include "simgear/props/props.hxx"
 #if !PROPS_STANDALONE
 # include "simgear/math/SGMath.hxx"
@@ -394,6 +396,55 @@ class JSBSIM_API FGPropertyManager
       return root->HasNode(newPath);
     }
 
+    /// Integer handle to a property (see GetHandle()).
+    typedef unsigned int PropertyHandle;
+    /// Value returned by GetHandle() when the property does not exist.
+    static constexpr PropertyHandle InvalidHandle = ~0u;
+
+    /** Get a handle to a property.
+        The path is resolved only once: further calls with the same path (or
+        with another path to the same property) return the same handle without
+        walking the property tree. The handle remains valid for the lifetime of
+        the property manager and gives access to the property in constant time.
+        @param path The path to the property.
+        @param create true to create the property if it does not exist.
+        @return the handle of the property or InvalidHandle if the property
+                does not exist (and create is false). */
+    PropertyHandle GetHandle(const std::string& path, bool create = false);
+    /** Check whether a handle has been returned by GetHandle(). A handle
+        returned by another property manager can not be told apart from a
+        valid one as long as it is in range. */
+    bool IsValidHandle(PropertyHandle handle) const
+    { return handle < handles.size(); }
+    /** Get the property node referred to by a handle.
+        @return the property node or nullptr if the handle is invalid. */
+    FGPropertyNode* GetNode(PropertyHandle handle) const
+    {
+      if (!IsValidHandle(handle)) return nullptr;
+      return handles[handle];
+    }
+    /** Get the value of the property referred to by a handle.
+        @throw BaseException if the handle is invalid. */
+    double GetDouble(PropertyHandle handle) const
+    { return GetCheckedNode(handle)->getDoubleValue(); }
+    /** Set the value of the property referred to by a handle.
+        @throw BaseException if the handle is invalid. */
+    void SetDouble(PropertyHandle handle, double value)
+    { GetCheckedNode(handle)->setDoubleValue(value); }
+    /** Get the values of several properties.
+        @param h an array of n property handles.
+        @param values an array of n values that receives the property values.
+        @param n the number of properties.
+        @throw BaseException if one of the handles is invalid. */
+    void GetDoubles(const PropertyHandle* h, double* values, size_t n) const;
+    /** Set the values of several properties. No property is modified if one of
+        the handles is invalid.
+        @param h an array of n property handles.
+        @param values the n values to set the properties to.
+        @param n the number of properties.
+        @throw BaseException if one of the handles is invalid. */
+    void SetDoubles(const PropertyHandle* h, const double* values, size_t n);
+
     /** Property-ify a name
      *  replaces spaces with '-' and, optionally, makes name all lower case
      *  @param name string to change
@@ -611,6 +662,16 @@ class JSBSIM_API FGPropertyManager
   private:
     std::vector<SGPropertyNode_ptr> tied_properties;
     FGPropertyNode_ptr root;
+    std::vector<FGPropertyNode_ptr> handles;
+    std::unordered_map<std::string, PropertyHandle> handleOfPath;
+    std::unordered_map<const FGPropertyNode*, PropertyHandle> handleOfNode;
+
+    FGPropertyNode* GetCheckedNode(PropertyHandle handle) const
+    {
+      if (!IsValidHandle(handle)) InvalidHandleError(handle);
+      return handles[handle];
+    }
+    [[noreturn]] void InvalidHandleError(PropertyHandle handle) const;
 };
 }
 #endif // FGPROPERTYMANAGER_H
@@ -50,6 +50,7 @@ INCLUDES
 #include "models/FGInput.h"
 #include "math/FGCondition.h"
 #include "math/FGFunctionValue.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -100,7 +101,7 @@ bool FGScript::LoadScript(const SGPath& script, double default_dT,
   double dt = 0.0, value = 0.0;
   FGCondition *newCondition;
 
-  FGXMLFileRead XMLFileRead;
+  FGXMLFileRead XMLFileRead(FDMExec->GetDocumentCache());
   Element* document = XMLFileRead.LoadXMLDocument(script);
 
   if (!document) {
@@ -536,6 +537,27 @@ bool FGScript::RunScript(void)
   return true;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGScript::SyncState(FGSnapshot& snapshot)
+{
+  snapshot.Sync(StartTime);
+  snapshot.Sync(EndTime);
+
+  snapshot.Check(Events.size());
+  for (auto& ev: Events) {
+    snapshot.Sync(ev.Triggered);
+    snapshot.Sync(ev.Notified);
+    snapshot.Sync(ev.StartTime);
+    snapshot.Sync(ev.TimeSpan);
+    snapshot.Sync(ev.SetValue);
+    snapshot.Sync(ev.newValue);
+    snapshot.Sync(ev.OriginalValue);
+    snapshot.Sync(ev.ValueSpan);
+    snapshot.Sync(ev.Transiting);
+  }
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
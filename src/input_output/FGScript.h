@@ -194,6 +194,10 @@ public:
 
   void ResetEvents(void);
 
+  /** Saves or restores the state of the events of the script (see
+      FGFDMExec::SaveSnapshot). */
+  void SyncState(FGSnapshot& snapshot);
+
 private:
   enum eAction {
     FG_RAMP  = 1,
@@ -0,0 +1,219 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+  Module:       FGSnapshot.cpp
+  Author:       Dawn Aerospace
+  Date started: October 2026
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU Lesser General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option) any
+  later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+
+  You should have received a copy of the GNU Lesser General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc., 59
+  Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+  Further information about the GNU Lesser General Public License can also be
+  found on the world wide web at http://www.gnu.org.
+
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  INCLUDES
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include "FGSnapshot.h"
+#include "FGJSBBase.h"
+#include "math/FGLocation.h"
+#include "math/FGQuaternion.h"
+#include "simgear/props/props.hxx"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  CLASS IMPLEMENTATION
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+void FGSnapshot::Sync(vector<bool>& values)
+{
+  size_t size = values.size();
+  Sync(size);
+  if (!Saving) values.resize(size);
+
+  for (size_t i=0; i<size; ++i) {
+    bool value = values[i];
+    Sync(value);
+    values[i] = value;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSnapshot::Sync(string& value)
+{
+  size_t size = value.size();
+  Sync(size);
+
+  if (Saving)
+    Data.insert(Data.end(), value.begin(), value.end());
+  else {
+    if (Position + size > BlobSize) Truncated();
+    value.assign(Blob+Position, size);
+    Position += size;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSnapshot::Sync(FGColumnVector3& v)
+{
+  for (unsigned int i=1; i<=3; ++i)
+    Sync(v(i));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSnapshot::Sync(FGMatrix33& M)
+{
+  for (unsigned int i=1; i<=3; ++i) {
+    for (unsigned int j=1; j<=3; ++j)
+      Sync(M(i,j));
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+// The cached values of the quaternion and of the location are synchronized as
+// well: some of them are set directly by the constructors rather than computed
+// from the master copy so recomputing them could round them differently.
+
+void FGSnapshot::Sync(FGQuaternion& q)
+{
+  Sync(q.data);
+  Sync(q.mCacheValid);
+  Sync(q.mT);
+  Sync(q.mTInv);
+  Sync(q.mEulerAngles);
+  Sync(q.mEulerSines);
+  Sync(q.mEulerCosines);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSnapshot::Sync(FGLocation& l)
+{
+  Sync(l.mECLoc);
+  Sync(l.mLon);
+  Sync(l.mLat);
+  Sync(l.mRadius);
+  Sync(l.mGeodLat);
+  Sync(l.GeodeticAltitude);
+  Sync(l.mTl2ec);
+  Sync(l.mTec2l);
+  Sync(l.a);
+  Sync(l.e2);
+  Sync(l.c);
+  Sync(l.ec);
+  Sync(l.ec2);
+  Sync(l.mCacheValid);
+  Sync(l.mEllipseSet);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSnapshot::Check(size_t value)
+{
+  size_t saved = value;
+  Sync(saved);
+
+  if (saved != value)
+    throw BaseException("The snapshot was not saved from the same model.");
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSnapshot::SyncProperties(SGPropertyNode* node)
+{
+  using namespace simgear;
+
+  // The type of the value is saved first. The nodes which value is not stored
+  // locally (tied properties and aliases) are marked with EXTENDED.
+  char type = node->hasLocalValue() ? node->getType() : props::EXTENDED;
+  char saved_type = type;
+  Sync(saved_type);
+
+  if (!Saving && (type == props::EXTENDED) != (saved_type == props::EXTENDED))
+    throw BaseException("The property " + node->getPath()
+                        + " is not tied the same way as in the snapshot.");
+
+  switch(saved_type) {
+  case props::BOOL:
+  {
+    bool value = node->getBoolValue();
+    Sync(value);
+    if (!Saving) node->setBoolValue(value);
+  }
+    break;
+  case props::INT:
+  {
+    int value = node->getIntValue();
+    Sync(value);
+    if (!Saving) node->setIntValue(value);
+  }
+    break;
+  case props::LONG:
+  {
+    long value = node->getLongValue();
+    Sync(value);
+    if (!Saving) node->setLongValue(value);
+  }
+    break;
+  case props::FLOAT:
+  {
+    float value = node->getFloatValue();
+    Sync(value);
+    if (!Saving) node->setFloatValue(value);
+  }
+    break;
+  case props::DOUBLE:
+  {
+    double value = node->getDoubleValue();
+    Sync(value);
+    if (!Saving) node->setDoubleValue(value);
+  }
+    break;
+  case props::STRING:
+  case props::UNSPECIFIED:
+  {
+    string value = node->getStringValue();
+    Sync(value);
+    if (!Saving) {
+      if (saved_type == props::STRING)
+        node->setStringValue(value);
+      else
+        node->setUnspecifiedValue(value.c_str());
+    }
+  }
+    break;
+  default:
+    break;
+  }
+
+  int n = node->nChildren();
+  Check(n);
+  for (int i=0; i<n; ++i)
+    SyncProperties(node->getChild(i));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSnapshot::Truncated(void) const
+{
+  throw BaseException("The snapshot is truncated.");
+}
+}
@@ -0,0 +1,175 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+  Header:       FGSnapshot.h
+  Author:       Dawn Aerospace
+  Date started: October 2026
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU Lesser General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option) any
+  later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+
+  You should have received a copy of the GNU Lesser General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc., 59
+  Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+  Further information about the GNU Lesser General Public License can also be
+  found on the world wide web at http://www.gnu.org.
+
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  SENTRY
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGSNAPSHOT_H
+#define FGSNAPSHOT_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  INCLUDES
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "JSBSim_API.h"
+
+class SGPropertyNode;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  FORWARD DECLARATIONS
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+class FGColumnVector3;
+class FGMatrix33;
+class FGQuaternion;
+class FGLocation;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  CLASS DOCUMENTATION
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Binary image of the state of a simulation.
+    A snapshot is either being saved or being restored. The objects that hold
+    a state implement a method SyncState(FGSnapshot&) that passes each of their
+    state variables to Sync(): when the snapshot is saved, the value of the
+    variable is appended to the blob and when it is restored, the variable is
+    overwritten by the next value read from the blob. The same method thus
+    handles both directions and the order of the variables is guaranteed to be
+    the same.
+
+    The values are stored in the native binary representation of the platform
+    without any type information. A blob can therefore only be restored by the
+    same build of JSBSim in an instance that has loaded the same model.
+
+    @code
+    void FGFilter::SyncState(FGSnapshot& snapshot)
+    {
+      FGFCSComponent::SyncState(snapshot);
+      snapshot.Sync(PreviousInput1);
+      snapshot.Sync(PreviousOutput1);
+    }
+    @endcode
+*/
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  CLASS DECLARATION
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class JSBSIM_API FGSnapshot
+{
+public:
+  /// Creates an empty snapshot in which a state is saved.
+  FGSnapshot(void) : Saving(true), Blob(nullptr), BlobSize(0), Position(0) {}
+
+  /** Creates a snapshot from which a state is restored. The blob is not copied
+      and must outlive the snapshot.
+      @param blob the data saved by a previous snapshot
+      @param size the size of the data in bytes */
+  FGSnapshot(const char* blob, size_t size)
+    : Saving(false), Blob(blob), BlobSize(size), Position(0) {}
+
+  /// Returns true if the state is being saved, false if it is being restored.
+  bool IsSaving(void) const { return Saving; }
+
+  /// Saves or restores a number, a boolean or an enumerated value.
+  template <typename T>
+  void Sync(T& value) {
+    static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value,
+                  "Only plain values can be synchronized");
+    SyncBytes(&value, sizeof(T));
+  }
+
+  /// Saves or restores the elements of an array.
+  template <typename T, size_t N>
+  void Sync(T (&values)[N]) {
+    for (auto& value: values) Sync(value);
+  }
+
+  /** Saves or restores the elements of a vector. The vector is resized when
+      restored. */
+  template <typename T>
+  void Sync(std::vector<T>& values) {
+    size_t size = values.size();
+    Sync(size);
+    if (!Saving) values.resize(size);
+    for (auto& value: values) Sync(value);
+  }
+
+  void Sync(std::vector<bool>& values);
+  void Sync(std::string& value);
+  void Sync(FGColumnVector3& v);
+  void Sync(FGMatrix33& M);
+  void Sync(FGQuaternion& q);
+  void Sync(FGLocation& l);
+
+  /** Saves a number that describes the layout of the state (such as the
+      number of elements of a list) or checks that it has the same value when
+      restored.
+      @throws BaseException if the values differ. */
+  void Check(size_t value);
+
+  /** Saves or restores the values of the properties that are stored in the
+      nodes of a property tree. The tied properties are not handled: their
+      value belongs to the objects they are tied to.
+      @throws BaseException if the tree does not have the same structure as
+              when it was saved. */
+  void SyncProperties(SGPropertyNode* root);
+
+  /// Returns the data saved so far.
+  const std::vector<char>& GetData(void) const { return Data; }
+
+  /// Returns true if the data of the blob have all been restored.
+  bool AtEnd(void) const { return Position == BlobSize; }
+
+private:
+  bool Saving;
+  std::vector<char> Data;
+  const char* Blob;
+  size_t BlobSize;
+  size_t Position;
+
+  void SyncBytes(void* value, size_t size) {
+    if (Saving) {
+      size_t offset = Data.size();
+      Data.resize(offset + size);
+      memcpy(Data.data() + offset, value, size);
+    } else {
+      if (Position + size > BlobSize) Truncated();
+      memcpy(value, Blob+Position, size);
+      Position += size;
+    }
+  }
+
+  [[noreturn]] void Truncated(void) const;
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
@@ -53,6 +53,17 @@ namespace JSBSim {
 CLASS IMPLEMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+// The names and sizes of the field types of the binary packets, in the order
+// of FGUDPInputSocket::eFieldType.
+static const struct {
+  const char* name;
+  size_t size;
+} FieldTypes[] = {{"int8", 1}, {"uint8", 1}, {"int16", 2}, {"uint16", 2},
+                  {"int32", 4}, {"uint32", 4}, {"uint64", 8}, {"float", 4},
+                  {"double", 8}};
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 FGUDPInputSocket::FGUDPInputSocket(FGFDMExec* fdmex) :
   FGInputSocket(fdmex), rate(20), oldTimeStamp(0.0)
 {
@@ -70,6 +81,15 @@ bool FGUDPInputSocket::Load(Element* el)
   rate = atoi(el->GetAttributeValue("rate").c_str());
   SetRate(0.5 + 1.0/(FDMExec->GetDeltaT()*rate));
 
+  string format = el->GetAttributeValue("format");
+  to_lower(format);
+  if (format == "binary")
+    return LoadBinary(el);
+  else if (!format.empty() && format != "text") {
+    cerr << el->ReadFrom() << fgred << "  Unknown format " << format
+         << ". The input will be read as text." << reset << endl;
+  }
+
   Element *property_element = el->FindElement("property");
 
   while (property_element) {
@@ -93,6 +113,11 @@ void FGUDPInputSocket::Read(bool Holding)
 {
   if (socket == 0) return;
 
+  if (Binary) {
+    ReadBinary();
+    return;
+  }
+
   data = socket->Receive();
 
   if (!data.empty()) {
@@ -134,4 +159,208 @@ void FGUDPInputSocket::Read(bool Holding)
   }
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGUDPInputSocket::LoadBinary(Element* el)
+{
+  const unsigned int integers = (1 << ftInt8) | (1 << ftUInt8) | (1 << ftInt16)
+                                | (1 << ftUInt16) | (1 << ftInt32)
+                                | (1 << ftUInt32);
+  const unsigned int reals = (1 << ftFloat) | (1 << ftDouble);
+
+  Binary = true;
+
+  string byteorder = el->GetAttributeValue("byteorder");
+  to_lower(byteorder);
+  if (byteorder == "big")
+    BigEndian = true;
+  else if (!byteorder.empty() && byteorder != "little") {
+    cerr << el->ReadFrom() << fgred << "  Unknown byte order " << byteorder
+         << ". The packets are assumed to be little endian." << reset << endl;
+  }
+
+  for (unsigned int i=0; i<el->GetNumElements(); ++i) {
+    Element* field_element = el->GetElement(i);
+    const string& name = field_element->GetName();
+
+    if (name == "property") {
+      Field field;
+      if (!AddField(field_element, ftDouble, integers | reals, field))
+        return false;
+
+      // The field of an unknown property is skipped.
+      string property_str = field_element->GetDataLine();
+      auto handle = PropertyManager->GetHandle(property_str);
+      if (handle == FGPropertyManager::InvalidHandle) {
+        cerr << field_element->ReadFrom() << fgred << highint
+             << "  No property by the name " << property_str
+             << " can be found." << reset << endl;
+        continue;
+      }
+      Fields.push_back(field);
+      Handles.push_back(handle);
+    } else if (name == "sequence" || name == "timestamp") {
+      bool sequence = name == "sequence";
+      bool& present = sequence ? HasSequence : HasTimeStamp;
+      if (present) {
+        cerr << field_element->ReadFrom() << fgred << "  Only one <" << name
+             << "> field is allowed." << reset << endl;
+        return false;
+      }
+      present = true;
+      if (sequence) {
+        if (!AddField(field_element, ftUInt32,
+                      (1 << ftUInt16) | (1 << ftUInt32) | (1 << ftUInt64),
+                      Sequence))
+          return false;
+      } else if (!AddField(field_element, ftDouble, reals, TimeStamp))
+        return false;
+    }
+  }
+
+  // The buffers are allocated once for all. The packet buffer has one extra
+  // byte to detect the packets that are too long.
+  Packet.resize(PacketSize+1);
+  Values.resize(Handles.size());
+
+  string inputProp = CreateIndexedPropertyName("simulation/input", InputIdx);
+  PropertyManager->Tie(inputProp + "/rejected-packets", this,
+                       &FGUDPInputSocket::GetRejectedPackets);
+  PropertyManager->Tie(inputProp + "/lost-packets", this,
+                       &FGUDPInputSocket::GetLostPackets);
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGUDPInputSocket::AddField(Element* el, eFieldType defaultType,
+                                unsigned int allowed, Field& field)
+{
+  field.type = defaultType;
+
+  if (el->HasAttribute("type")) {
+    string type = el->GetAttributeValue("type");
+    to_lower(type);
+
+    unsigned int i = 0;
+    while (i <= ftDouble && type != FieldTypes[i].name) ++i;
+
+    if (i > ftDouble || !(allowed & (1 << i))) {
+      cerr << el->ReadFrom() << fgred << "  Illegal type " << type
+           << " for the <" << el->GetName() << "> field." << reset << endl;
+      return false;
+    }
+    field.type = static_cast<eFieldType>(i);
+  }
+
+  field.offset = PacketSize;
+  PacketSize += FieldTypes[field.type].size;
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGUDPInputSocket::ReadBinary(void)
+{
+  int size;
+
+  while ((size = socket->Receive(Packet.data(), Packet.size())) >= 0) {
+    if (static_cast<size_t>(size) != PacketSize) {
+      ++RejectedPackets;
+      continue;
+    }
+
+    uint64_t sequence = 0, gap = 1;
+    if (HasSequence) {
+      sequence = DecodeBits(Sequence);
+      if (!FirstPacket) {
+        // The sequence numbers are compared modulo the range of their type so
+        // that they can wrap around.
+        size_t bits = 8*FieldTypes[Sequence.type].size;
+        uint64_t mask = bits == 64 ? UINT64_MAX : (UINT64_C(1) << bits) - 1;
+        gap = (sequence - LastSequence) & mask;
+        if (gap == 0 || gap > mask/2) {
+          ++RejectedPackets;
+          continue;
+        }
+      }
+    }
+
+    double timestamp = 0.0;
+    if (HasTimeStamp) {
+      timestamp = DecodeValue(TimeStamp);
+      if (!FirstPacket && timestamp < oldTimeStamp) {
+        ++RejectedPackets;
+        continue;
+      }
+    }
+
+    FirstPacket = false;
+    LastSequence = sequence;
+    LostPackets += gap - 1;
+    oldTimeStamp = timestamp;
+
+    for (size_t i=0; i<Fields.size(); ++i)
+      Values[i] = DecodeValue(Fields[i]);
+
+    PropertyManager->SetDoubles(Handles.data(), Values.data(), Handles.size());
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+uint64_t FGUDPInputSocket::DecodeBits(const Field& field) const
+{
+  size_t size = FieldTypes[field.type].size;
+  const unsigned char* bytes =
+    reinterpret_cast<const unsigned char*>(&Packet[field.offset]);
+  uint64_t bits = 0;
+
+  for (size_t i=0; i<size; ++i)
+    bits = (bits << 8) | bytes[BigEndian ? i : size-1-i];
+
+  return bits;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double FGUDPInputSocket::DecodeValue(const Field& field) const
+{
+  uint64_t bits = DecodeBits(field);
+
+  switch (field.type) {
+  case ftInt8:
+    return static_cast<int8_t>(bits);
+  case ftUInt8:
+    return static_cast<uint8_t>(bits);
+  case ftInt16:
+    return static_cast<int16_t>(bits);
+  case ftUInt16:
+    return static_cast<uint16_t>(bits);
+  case ftInt32:
+    return static_cast<int32_t>(bits);
+  case ftUInt32:
+    return static_cast<uint32_t>(bits);
+  case ftUInt64:
+    return static_cast<double>(bits);
+  case ftFloat:
+    {
+      uint32_t bits32 = static_cast<uint32_t>(bits);
+      float value;
+      memcpy(&value, &bits32, sizeof(value));
+      return value;
+    }
+  case ftDouble:
+    {
+      double value;
+      memcpy(&value, &bits, sizeof(value));
+      return value;
+    }
+  }
+
+  return 0.0;
+}
+
 }
@@ -38,6 +38,8 @@ SENTRY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <cstdint>
+
 #include "FGInputSocket.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -50,7 +52,42 @@ namespace JSBSim {
 CLASS DOCUMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
-/** Implements a UDP input socket. 
+/** Implements a UDP input socket.
+
+    By default each datagram is a line of comma separated values: the time
+    stamp followed by the values of the properties in the order of the
+    <property> elements.
+
+    When the format attribute is set to "binary", each datagram is instead a
+    packed record whose layout is declared by the child elements of the input
+    directive, in the order in which they appear:
+
+    @code
+    <input type="UDP" port="5139" rate="1000" format="binary" byteorder="big">
+      <sequence type="uint32"/>
+      <timestamp type="double"/>
+      <property type="float"> fcs/aileron-cmd-norm </property>
+      <property type="float"> fcs/elevator-cmd-norm </property>
+      <property type="uint8"> gear/gear-cmd-norm </property>
+    </input>
+    @endcode
+
+    - byteorder is either "little" (the default) or "big".
+    - <property> fields are of type int8, uint8, int16, uint16, int32, uint32,
+      float or double (the default).
+    - the optional <sequence> field is of type uint16, uint32 (the default) or
+      uint64. A packet whose sequence number is not ahead of the last accepted
+      one is rejected and the gaps in the sequence are counted as lost
+      packets. The sequence numbers may wrap around.
+    - the optional <timestamp> field is of type float or double (the
+      default). A packet whose time stamp is older than the last accepted one
+      is rejected.
+
+    The datagrams whose size does not match the record are also rejected. All
+    the datagrams received since the last input are decoded in the order of
+    their arrival. The counters of rejected and lost packets are available as
+    the properties simulation/input[n]/rejected-packets and
+    simulation/input[n]/lost-packets.
  */
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -71,11 +108,47 @@ public:
   /// Reads the socket and updates properties accordingly.
   void Read(bool Holding) override;
 
+  /// Returns the number of binary packets that have been rejected.
+  long GetRejectedPackets(void) const { return RejectedPackets; }
+  /// Returns the number of binary packets missing from the sequence.
+  long GetLostPackets(void) const { return LostPackets; }
+
 protected:
 
   int rate;
   double oldTimeStamp;
   std::vector<FGPropertyNode_ptr> InputProperties;
+
+private:
+  enum eFieldType {ftInt8, ftUInt8, ftInt16, ftUInt16, ftInt32, ftUInt32,
+                   ftUInt64, ftFloat, ftDouble};
+
+  struct Field {
+    eFieldType type;
+    size_t offset;
+  };
+
+  bool Binary = false;
+  bool BigEndian = false;
+  bool HasSequence = false;
+  bool HasTimeStamp = false;
+  bool FirstPacket = true;
+  Field Sequence, TimeStamp;
+  uint64_t LastSequence = 0;
+  long RejectedPackets = 0;
+  long LostPackets = 0;
+  std::vector<Field> Fields;
+  std::vector<FGPropertyManager::PropertyHandle> Handles;
+  std::vector<double> Values;
+  std::vector<char> Packet;
+  size_t PacketSize = 0;
+
+  bool LoadBinary(Element* el);
+  bool AddField(Element* el, eFieldType defaultType, unsigned int allowed,
+                Field& field);
+  void ReadBinary(void);
+  uint64_t DecodeBits(const Field& field) const;
+  double DecodeValue(const Field& field) const;
 };
 }
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -355,6 +355,11 @@ public:
   *   @param d the data to store. */
   void AddData(std::string d);
 
+  /** Returns a copy of the element and of all its children.
+  *   The copy has no parent and does not share any data with the original
+  *   element. */
+  Element_ptr Clone(void) const;
+
   /** Prints the element.
   *   Prints this element and calls the Print routine for child elements.
   *   @param d The tab level. A level corresponds to a single space. */
@@ -396,8 +401,9 @@ private:
   std::string file_name;
   int line_number;
   typedef std::map <std::string, std::map <std::string, double> > tMapConvert;
-  static tMapConvert convert;
-  static bool converterIsInitialized;
+  static const tMapConvert convert;
+
+  static tMapConvert InitConverter(void);
 };
 
 } // namespace JSBSim
@@ -45,6 +45,10 @@ Element* FGXMLFileRead::LoadXMLDocument(const SGPath& XML_filename,
   if (!filename.isNull()) {
     if (filename.extension().empty())
       filename.concat(".xml");
+    if (cache) {
+      cached_document = cache->GetDocument(filename.utf8Str());
+      if (cached_document) return cached_document;
+    }
     infile.open(filename);
     if ( !infile.is_open()) {
       if (verbose) std::cerr << "Could not open file: " << filename << std::endl;
@@ -57,7 +61,30 @@ Element* FGXMLFileRead::LoadXMLDocument(const SGPath& XML_filename,
   readXML(infile, fparse, filename.utf8Str());
   Element* document = fparse.GetDocument();
   infile.close();
+  if (cache && document) cache->AddDocument(filename.utf8Str(), document);
   return document;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+Element_ptr FGXMLDocumentCache::GetDocument(const std::string& filename)
+{
+  // The reference counters of the cached documents are not atomic so they
+  // must only be copied while the mutex is locked.
+  std::lock_guard<std::mutex> lock(mutex);
+  auto it = documents.find(filename);
+  if (it == documents.end()) return nullptr;
+  return it->second->Clone();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGXMLDocumentCache::AddDocument(const std::string& filename,
+                                     const Element* document)
+{
+  Element_ptr copy = document->Clone();
+  std::lock_guard<std::mutex> lock(mutex);
+  documents[filename] = copy;
+}
+
 } // end namespace JSBSim
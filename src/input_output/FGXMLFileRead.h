@@ -35,6 +35,10 @@ SENTRY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <map>
+#include <memory>
+#include <mutex>
+
 #include "FGXMLParse.h"
 #include "simgear/misc/sg_path.hxx"
 
@@ -44,9 +48,37 @@ FORWARD DECLARATIONS
 
 namespace JSBSim {
 
+/** Stores the documents parsed from XML files so that the instances of
+    FGFDMExec that load the same files (for instance the workers of a batch
+    run) only parse them once. Each instance gets its own copy of the documents
+    so the cache can be shared between threads. The files are assumed not to
+    be modified while the cache is in use.
+*/
+class JSBSIM_API FGXMLDocumentCache {
+public:
+  /** Returns a copy of the document read from a file.
+      @param filename the name of the file.
+      @return the copy of the document or nullptr if the file has not been
+              cached. */
+  Element_ptr GetDocument(const std::string& filename);
+  /** Stores a copy of the document read from a file.
+      @param filename the name of the file.
+      @param document the document read from the file. */
+  void AddDocument(const std::string& filename, const Element* document);
+
+private:
+  std::mutex mutex;
+  std::map<std::string, Element_ptr> documents;
+};
+
 class JSBSIM_API FGXMLFileRead {
 public:
   FGXMLFileRead(void) {}
+  /** Constructor.
+      @param _cache the documents are copied from this cache (when not null)
+                    rather than parsed again from their file. */
+  explicit FGXMLFileRead(std::shared_ptr<FGXMLDocumentCache> _cache)
+    : cache(_cache) {}
   ~FGXMLFileRead(void) {}
 
   Element* LoadXMLDocument(const SGPath& XML_filename, bool verbose=true)
@@ -61,6 +93,8 @@ public:
 
 private:
   FGXMLParse file_parser;
+  std::shared_ptr<FGXMLDocumentCache> cache;
+  Element_ptr cached_document;
 };
 }
 #endif
@@ -250,6 +250,7 @@ string FGfdmSocket::Receive(void)
   if (sckt_in == INVALID_SOCKET && Protocol == ptTCP) {
     sckt_in = accept(sckt, (struct sockaddr*)&scktName, &len);
     if (sckt_in != INVALID_SOCKET) {
+      ++connections;
 #ifdef _WIN32
       u_long NoBlock = 1;
       ioctlsocket(sckt_in, FIONBIO, &NoBlock);
@@ -279,6 +280,15 @@ string FGfdmSocket::Receive(void)
         sckt_in = INVALID_SOCKET;
       }
     }
+#else
+    // recv() returns 0 when the client has closed the socket. The data that
+    // it sent before closing is returned first so that it can be replied to:
+    // the socket is closed by the next call, for which recv() returns 0 again.
+    if (num_chars == 0 && data.empty()) {
+      cout << "Socket Closed. Back to listening" << endl;
+      close(sckt_in);
+      sckt_in = INVALID_SOCKET;
+    }
 #endif
   }
 
@@ -295,13 +305,31 @@ string FGfdmSocket::Receive(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-int FGfdmSocket::Reply(const string& text)
+int FGfdmSocket::Receive(char* buffer, size_t size)
+{
+  if (sckt == INVALID_SOCKET || Protocol != ptUDP) return -1;
+
+  struct sockaddr addr;
+  socklen_t fromlen = sizeof addr;
+  int num_chars = recvfrom(sckt, buffer, size, 0, &addr, &fromlen);
+#ifdef _WIN32
+  // Windows reports an error for the datagrams that have been truncated.
+  if (num_chars == SOCKET_ERROR && WSAGetLastError() == WSAEMSGSIZE)
+    return (int)size;
+#endif
+
+  return num_chars < 0 ? -1 : num_chars;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+int FGfdmSocket::Reply(const string& text, bool prompt)
 {
   int num_chars_sent=0;
 
   if (sckt_in != INVALID_SOCKET) {
     num_chars_sent = send(sckt_in, text.c_str(), text.size(), 0);
-    send(sckt_in, "JSBSim> ", 8, 0);
+    if (prompt) send(sckt_in, "JSBSim> ", 8, 0);
   } else {
     cerr << "Socket reply must be to a valid socket" << endl;
     return -1;
@@ -318,6 +346,8 @@ void FGfdmSocket::Close(void)
 #else
   close(sckt_in);
 #endif
+  // Listen for the next client.
+  sckt_in = INVALID_SOCKET;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
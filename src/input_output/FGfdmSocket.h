@@ -77,7 +77,15 @@ public:
   void Send(const char *data, int length);
 
   std::string Receive(void);
-  int Reply(const std::string& text);
+  /** Receives a single datagram from a UDP input socket.
+      @param buffer the buffer in which the datagram is stored
+      @param size the size of the buffer. Longer datagrams are truncated.
+      @return the size of the datagram or -1 if no datagram is pending. */
+  int Receive(char* buffer, size_t size);
+  /** Sends a reply to the client connected to a TCP server socket.
+      @param text the reply
+      @param prompt true to send the "JSBSim> " prompt after the reply */
+  int Reply(const std::string& text, bool prompt = true);
   void Append(const std::string& s) {Append(s.c_str());}
   void Append(const char*);
   void Append(double);
@@ -86,6 +94,8 @@ public:
   void Clear(const std::string& s);
   void Close(void);
   bool GetConnectStatus(void) {return connected;}
+  /// Returns the number of clients that a TCP server socket has accepted.
+  unsigned int GetConnectionCount(void) const {return connections;}
   void WaitUntilReadable(void);
 
   enum ProtocolType {ptUDP, ptTCP};
@@ -104,6 +114,7 @@ private:
   std::ostringstream buffer;
   int precision;
   bool connected;
+  unsigned int connections = 0;
   void Debug(int from);
 };
 }
@@ -63,14 +63,23 @@ FGColumnVector3::FGColumnVector3(void)
 string FGColumnVector3::Dump(const string& delimiter) const
 {
   ostringstream buffer;
-  buffer << std::setprecision(16) << data[0] << delimiter;
-  buffer << std::setprecision(16) << data[1] << delimiter;
-  buffer << std::setprecision(16) << data[2];
+  Dump(buffer, delimiter);
   return buffer.str();
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGColumnVector3::Dump(ostream& out, const string& delimiter) const
+{
+  streamsize precision = out.precision(16);
+  out << data[0] << delimiter;
+  out << data[1] << delimiter;
+  out << data[2];
+  out.precision(precision);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 ostream& operator<<(ostream& os, const FGColumnVector3& col)
 {
   os << col(1) << " , " << col(2) << " , " << col(3);
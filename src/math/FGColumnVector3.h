@@ -131,6 +131,12 @@ public:
       @return a string with the delimeter-separated contents of the vector  */
   std::string Dump(const std::string& delimeter) const;
 
+  /** Prints the contents of the vector to a stream. The precision of the
+      stream is left unchanged.
+      @param out the output stream
+      @param delimeter the item separator (tab or comma)  */
+  void Dump(std::ostream& out, const std::string& delimeter) const;
+
   /** Assignment operator.
       @param b source vector.
       Copy the content of the vector given in the argument into *this.   */
@@ -28,15 +28,20 @@ Purpose: Stores various parameter types for functions
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <algorithm>
 #include <iomanip>
+#include <map>
 #include <memory>
+#include <typeinfo>
 
 #include "simgear/misc/strutils.hxx"
 #include "FGFDMExec.h"
 #include "FGFunction.h"
 #include "FGTable.h"
 #include "FGRealValue.h"
+#include "FGSharedExpressions.h"
 #include "input_output/FGXMLElement.h"
+#include "input_output/FGSnapshot.h"
 #include "math/FGFunctionValue.h"
 
 
@@ -107,10 +112,11 @@ template<typename func_t>
 class aFunc<func_t, 0>: public FGFunction
 {
 public:
-  aFunc(const func_t& _f, std::shared_ptr<FGPropertyManager> pm, Element* el,
-        const string& Prefix)
-    : FGFunction(pm), f(_f)
+  aFunc(const func_t& _f, FGFDMExec* fdmex, Element* el, const string& Prefix)
+    : FGFunction(fdmex->GetPropertyManager()), f(_f)
   {
+    SharedExpressions = fdmex->GetSharedExpressions();
+
     if (el->GetNumElements() != 0) {
       ostringstream buffer;
       buffer << el->ReadFrom() << fgred << highint
@@ -124,7 +130,10 @@ public:
 
   double GetValue(void) const override {
     double result = cached ? cachedValue : f();
-    if (pNode) pNode->setDoubleValue(result);
+    if (pNode) {
+      pNode->setDoubleValue(result);
+      SharedExpressions->Invalidate();
+    }
     return result;
   }
 
@@ -133,6 +142,8 @@ public:
     return false;
   }
 
+  bool GetInputs(vector<FGPropertyNode*>&) const override { return false; }
+
 protected:
   // The method GetValue() is not bound for functions without parameters because
   // we do not want the property to return a different value each time it is
@@ -210,6 +221,8 @@ FGFunction::FGFunction(FGFDMExec* fdmex, Element* el, const string& prefix,
   Load(el, var, fdmex, prefix);
   CheckMinArguments(el, 1);
   CheckMaxArguments(el, 1);
+  Compile();
+  SharedExpressions->Register(this);
 
   string sCopyTo = el->GetAttributeValue("copyto");
 
@@ -295,12 +308,19 @@ shared_ptr<RandomNumberGenerator> makeRandomGenerator(Element *el, FGFDMExec* fd
   string seed_attr = el->GetAttributeValue("seed");
   if (seed_attr.empty())
     return fdmex->GetRandomGenerator();
-  else if (seed_attr == "time_now")
-    return make_shared<RandomNumberGenerator>();
+
+  shared_ptr<RandomNumberGenerator> generator;
+  if (seed_attr == "time_now")
+    generator = make_shared<RandomNumberGenerator>();
   else {
     unsigned int seed = atoi(seed_attr.c_str());
-    return make_shared<RandomNumberGenerator>(seed);
+    generator = make_shared<RandomNumberGenerator>(seed);
   }
+
+  // The private generators are registered so that their state is saved in
+  // the snapshots of the simulation.
+  fdmex->AddRandomGenerator(generator);
+  return generator;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -309,6 +329,8 @@ void FGFunction::Load(Element* el, FGPropertyValue* var, FGFDMExec* fdmex,
                       const string& Prefix)
 {
   Name = el->GetAttributeValue("name");
+  Operation = el->GetName();
+  SharedExpressions = fdmex->GetSharedExpressions();
   Element* element = el->GetElement();
       
   auto sum = [](const decltype(Parameters)& Parameters)->double {
@@ -623,8 +645,7 @@ void FGFunction::Load(Element* el, FGPropertyValue* var, FGFDMExec* fdmex,
                  double value = generator->GetNormalRandomNumber();
                  return value*stddev + mean;
                };
-      Parameters.push_back(new aFunc<decltype(f), 0>(f, PropertyManager, element,
-                                                     Prefix));
+      Parameters.push_back(new aFunc<decltype(f), 0>(f, fdmex, element, Prefix));
     } else if (operation == "urandom") {
       double lower = -1.0;
       double upper = 1.0;
@@ -655,8 +676,7 @@ void FGFunction::Load(Element* el, FGPropertyValue* var, FGFDMExec* fdmex,
                  double value = generator->GetUniformRandomNumber();
                  return value*a + b;
                };
-      Parameters.push_back(new aFunc<decltype(f), 0>(f, PropertyManager, element,
-                                                     Prefix));
+      Parameters.push_back(new aFunc<decltype(f), 0>(f, fdmex, element, Prefix));
     } else if (operation == "switch") {
       string ctxMsg = element->ReadFrom();
       auto f = [ctxMsg](const decltype(Parameters)& p)->double {
@@ -928,6 +948,8 @@ FGFunction::~FGFunction()
   if (pNode && pNode->isTied())
     PropertyManager->Untie(pNode);
 
+  if (SharedExpressions) SharedExpressions->Unregister(this);
+
   Debug(1);
 }
 
@@ -945,6 +967,433 @@ bool FGFunction::IsConstant(void) const
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+bool FGFunction::GetInputs(vector<FGPropertyNode*>& inputs) const
+{
+  for (auto p: Parameters) {
+    if (!p->GetInputs(inputs))
+      return false;
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Checks whether the function must be evaluated again. The inputs of the
+// function are collected on the first call: memoization is turned off if the
+// function depends on something else than properties or if one of these
+// properties is tied or aliased (their version is not updated when their value
+// changes). An input that is tied or aliased later on bumps its version once
+// when its local value is cleared, so it is checked again each time its version
+// changes.
+
+bool FGFunction::InputsChanged(void) const
+{
+  switch (memo) {
+  case Memo::Off:
+    return true;
+  case Memo::Unknown:
+    {
+      vector<FGPropertyNode*> nodes;
+      memo = Memo::Off;
+
+      if (!GetInputs(nodes)) return true;
+
+      sort(nodes.begin(), nodes.end());
+      nodes.erase(unique(nodes.begin(), nodes.end()), nodes.end());
+
+      for (auto node: nodes) {
+        if (!node->hasLocalValue()) return true;
+        Inputs.emplace_back(node, node->getVersion());
+      }
+
+      memo = Memo::On;
+      return true;
+    }
+  default:
+    {
+      bool changed = false;
+
+      for (auto& input: Inputs) {
+        unsigned long version = input.first->getVersion();
+        if (version != input.second) {
+          if (!input.first->hasLocalValue()) {
+            memo = Memo::Off;
+            Inputs.clear();
+            return true;
+          }
+          input.second = version;
+          changed = true;
+        }
+      }
+
+      return changed;
+    }
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Operations that FGFunction::Compile() knows how to translate into bytecode.
+// The math functions must be the same as the ones passed to make_MathFn() in
+// FGFunction::Load().
+
+struct CompiledOperation {
+  FGFunctionProgram::OpCode op;
+  double (*math_fn)(double);
+};
+
+// Minimum number of nodes in a sub-expression for it to be shared between
+// functions (i.e. an operation with at least two arguments). Smaller
+// sub-expressions are cheaper to evaluate than to share.
+constexpr size_t MinSharedNodes = 3;
+
+static const map<string, CompiledOperation> CompiledOperations {
+  {"sum",        {FGFunctionProgram::OpCode::Sum,        nullptr}},
+  {"product",    {FGFunctionProgram::OpCode::Product,    nullptr}},
+  {"difference", {FGFunctionProgram::OpCode::Difference, nullptr}},
+  {"min",        {FGFunctionProgram::OpCode::Min,        nullptr}},
+  {"max",        {FGFunctionProgram::OpCode::Max,        nullptr}},
+  {"avg",        {FGFunctionProgram::OpCode::Avg,        nullptr}},
+  {"quotient",   {FGFunctionProgram::OpCode::Quotient,   nullptr}},
+  {"pow",        {FGFunctionProgram::OpCode::Pow,        nullptr}},
+  {"fmod",       {FGFunctionProgram::OpCode::Fmod,       nullptr}},
+  {"atan2",      {FGFunctionProgram::OpCode::Atan2,      nullptr}},
+  {"mod",        {FGFunctionProgram::OpCode::Mod,        nullptr}},
+  {"lt",         {FGFunctionProgram::OpCode::Lt,         nullptr}},
+  {"le",         {FGFunctionProgram::OpCode::Le,         nullptr}},
+  {"gt",         {FGFunctionProgram::OpCode::Gt,         nullptr}},
+  {"ge",         {FGFunctionProgram::OpCode::Ge,         nullptr}},
+  {"eq",         {FGFunctionProgram::OpCode::Eq,         nullptr}},
+  {"nq",         {FGFunctionProgram::OpCode::Nq,         nullptr}},
+  {"toradians",  {FGFunctionProgram::OpCode::ToRadians,  nullptr}},
+  {"todegrees",  {FGFunctionProgram::OpCode::ToDegrees,  nullptr}},
+  {"sqrt",       {FGFunctionProgram::OpCode::Sqrt,       nullptr}},
+  {"log2",       {FGFunctionProgram::OpCode::Log2,       nullptr}},
+  {"ln",         {FGFunctionProgram::OpCode::Ln,         nullptr}},
+  {"log10",      {FGFunctionProgram::OpCode::Log10,      nullptr}},
+  {"sign",       {FGFunctionProgram::OpCode::Sign,       nullptr}},
+  {"fraction",   {FGFunctionProgram::OpCode::Fraction,   nullptr}},
+  {"integer",    {FGFunctionProgram::OpCode::Integer,    nullptr}},
+  {"exp",        {FGFunctionProgram::OpCode::MathFn,     exp}},
+  {"abs",        {FGFunctionProgram::OpCode::MathFn,     fabs}},
+  {"sin",        {FGFunctionProgram::OpCode::MathFn,     sin}},
+  {"cos",        {FGFunctionProgram::OpCode::MathFn,     cos}},
+  {"tan",        {FGFunctionProgram::OpCode::MathFn,     tan}},
+  {"asin",       {FGFunctionProgram::OpCode::MathFn,     asin}},
+  {"acos",       {FGFunctionProgram::OpCode::MathFn,     acos}},
+  {"atan",       {FGFunctionProgram::OpCode::MathFn,     atan}},
+  {"floor",      {FGFunctionProgram::OpCode::MathFn,     floor}},
+  {"ceil",       {FGFunctionProgram::OpCode::MathFn,     ceil}}
+};
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// A parameter is pure when it is translated into bytecode that has no side
+// effect and cannot throw. Parameters that are kept as opaque calls to
+// GetValue() (random numbers, late bound properties, tables, ...) are not pure.
+
+bool FGFunction::IsPure(const FGParameter* p)
+{
+  if (dynamic_cast<const FGRealValue*>(p)) return true;
+
+  auto pv = dynamic_cast<const FGPropertyValue*>(p);
+  if (pv)
+    return typeid(*pv) == typeid(FGPropertyValue) && !pv->IsLateBound();
+
+  auto f = dynamic_cast<const FGFunction*>(p);
+  if (!f || CompiledOperations.find(f->Operation) == CompiledOperations.end())
+    return false;
+
+  for (auto param: f->Parameters) {
+    if (!IsPure(param))
+      return false;
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The operations that accumulate their arguments from left to right. Applying
+// such an operation to its first arguments gives the intermediate result of the
+// operation applied to all its arguments so these first arguments can be
+// replaced by that result without changing the final result.
+
+static bool IsLeftFold(FGFunctionProgram::OpCode op)
+{
+  switch(op) {
+  case FGFunctionProgram::OpCode::Sum:
+  case FGFunctionProgram::OpCode::Product:
+  case FGFunctionProgram::OpCode::Difference:
+  case FGFunctionProgram::OpCode::Min:
+  case FGFunctionProgram::OpCode::Max:
+    return true;
+  default:
+    return false;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Returns a string that identifies the pure parameter p and increments nodes by
+// the number of nodes in its tree. Two parameters with the same key evaluate
+// to the same value.
+
+string FGFunction::GetKey(const FGParameter* p, size_t& nodes)
+{
+  if (dynamic_cast<const FGRealValue*>(p)) {
+    ostringstream key;
+    ++nodes;
+    key << hexfloat << p->GetValue();
+    return key.str();
+  }
+
+  auto pv = dynamic_cast<const FGPropertyValue*>(p);
+  if (pv) {
+    ostringstream key;
+    ++nodes;
+    key << "p:" << pv->GetNode() << "*" << hexfloat << pv->GetSign();
+    return key.str();
+  }
+
+  auto f = static_cast<const FGFunction*>(p);
+  return GetKey(f, f->Parameters.size(), nodes);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Same as above for the operation of f applied to its n first parameters.
+
+string FGFunction::GetKey(const FGFunction* f, size_t n, size_t& nodes)
+{
+  string key = f->Operation + "(";
+
+  ++nodes;
+  for (size_t i=0; i < n; ++i)
+    key += GetKey(f->Parameters[i], nodes) + ",";
+
+  return key + ")";
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Checks if the operation of f applied to its n first parameters is a
+// candidate for sharing and, if so, returns its key. The parameters must be
+// pure, not all constant and large enough for the sharing to pay off.
+
+bool FGFunction::GetSharedKey(const FGFunction* f, size_t n, string& key)
+{
+  bool constant = true;
+
+  for (size_t i=0; i < n; ++i) {
+    const FGParameter* param = f->Parameters[i];
+    if (!IsPure(param)) return false;
+    if (!dynamic_cast<const FGRealValue*>(param)) constant = false;
+  }
+
+  if (constant) return false;
+
+  size_t nodes = 0;
+  key = GetKey(f, n, nodes);
+  return nodes >= MinSharedNodes;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Counts the occurrences of the sub-expressions of p that are candidates for
+// sharing: the pure operations and the leading pure arguments of the left
+// folds. Only the operations that are compiled are walked since the
+// sub-expressions of the other ones are evaluated by the tree. The
+// sub-expressions of an expression that has already been counted are not
+// counted again: they will be evaluated once by the shared expression.
+
+void FGFunction::CountSubExpressions(const FGParameter* p,
+                                     map<string, unsigned int>& occurrences)
+{
+  auto f = dynamic_cast<const FGFunction*>(p);
+  if (!f) return;
+
+  auto it = CompiledOperations.find(f->Operation);
+  if (it == CompiledOperations.end()) return;
+
+  const auto& params = f->Parameters;
+  size_t first = 0; // Number of leading parameters that have been seen before.
+  string key;
+
+  if (GetSharedKey(f, params.size(), key) && occurrences[key]++ > 0) return;
+
+  if (IsLeftFold(it->second.op)) {
+    for (size_t n=params.size()-1; n > 1; --n) {
+      if (GetSharedKey(f, n, key) && occurrences[key]++ > 0) {
+        first = n;
+        break;
+      }
+    }
+  }
+
+  for (size_t i=first; i < params.size(); ++i)
+    CountSubExpressions(params[i], occurrences);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFunction::CountSubExpressions(map<string, unsigned int>& occurrences)
+{
+  CountSubExpressions(Parameters[0], occurrences);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Returns the shared expression for the operation of f applied to its n first
+// parameters or nullptr if that expression is not shared.
+
+FGSharedExpression* FGFunction::GetSharedExpression(const FGFunction* f,
+                                                    size_t n)
+{
+  string key;
+
+  if (!SharedExpressions || !GetSharedKey(f, n, key)) return nullptr;
+
+  bool created;
+  FGSharedExpression* expr = SharedExpressions->Get(key, created);
+  if (created) CompileOperation(expr->Program, f, n);
+
+  return expr;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Appends the bytecode applying the operation of f to its n first parameters.
+// For the left folds, the longest run of leading arguments that is shared is
+// replaced by the shared expression. Otherwise the leading constants are
+// folded into a single constant. In both cases, the operations applied after
+// these leading arguments are unchanged so the result is bit for bit
+// identical.
+
+void FGFunction::CompileOperation(FGFunctionProgram& program,
+                                  const FGFunction* f, size_t n)
+{
+  const CompiledOperation& cop = CompiledOperations.at(f->Operation);
+  const auto& params = f->Parameters;
+  size_t first = 0; // Number of leading arguments pushed as a single value.
+
+  if (IsLeftFold(cop.op)) {
+    for (size_t m=n-1; m > 1; --m) {
+      FGSharedExpression* expr = GetSharedExpression(f, m);
+      if (expr) {
+        program.PushShared(expr);
+        first = m;
+        break;
+      }
+    }
+
+    if (first == 0) {
+      size_t nConst = 0;
+      while (nConst < n && dynamic_cast<FGRealValue*>(params[nConst].ptr()))
+        ++nConst;
+
+      if (nConst > 1) {
+        FGFunctionProgram folded;
+        for (size_t i=0; i < nConst; ++i)
+          folded.PushConstant(params[i]->GetValue());
+        folded.PushOperation(cop.op, nConst);
+        program.PushConstant(folded.Execute());
+        first = nConst;
+      }
+    }
+  }
+
+  for (size_t i=first; i < n; ++i)
+    Compile(program, params[i]);
+
+  if (cop.op == FGFunctionProgram::OpCode::MathFn)
+    program.PushMathFn(cop.math_fn);
+  else if (first > 0)
+    program.PushOperation(cop.op, n-first+1);
+  else
+    program.PushOperation(cop.op, n);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Appends the bytecode evaluating the parameter p to the program and returns
+// whether that bytecode is pure. If p is a sub-expression shared with other
+// functions, the bytecode refers to the shared expression.
+
+bool FGFunction::Compile(FGFunctionProgram& program, FGParameter* p)
+{
+  if (dynamic_cast<FGRealValue*>(p)) {
+    program.PushConstant(p->GetValue());
+    return true;
+  }
+
+  if (IsPure(p)) {
+    auto pv = dynamic_cast<FGPropertyValue*>(p);
+    if (pv) {
+      program.PushProperty(pv->GetNode(), pv->GetSign());
+      return true;
+    }
+  }
+
+  auto f = dynamic_cast<FGFunction*>(p);
+  if (f) {
+    auto it = CompiledOperations.find(f->Operation);
+
+    if (it != CompiledOperations.end()) {
+      const CompiledOperation& cop = it->second;
+      const auto& params = f->Parameters;
+      size_t nImpure = 0;
+
+      for (auto param: params) {
+        if (!IsPure(param)) ++nImpure;
+      }
+
+      // The bytecode evaluates all the arguments from left to right before
+      // applying the operation. The functions that take a variable number of
+      // arguments do the same but the other functions either evaluate their
+      // arguments in an unspecified order or, for <quotient> and <fmod>, skip
+      // the first argument when the second one is zero. Such functions are
+      // only compiled if that cannot change the side effects of the
+      // evaluation.
+      bool inOrder = params.size() == 1 || nImpure == 0;
+      switch(cop.op) {
+      case FGFunctionProgram::OpCode::Sum:
+      case FGFunctionProgram::OpCode::Product:
+      case FGFunctionProgram::OpCode::Difference:
+      case FGFunctionProgram::OpCode::Min:
+      case FGFunctionProgram::OpCode::Max:
+      case FGFunctionProgram::OpCode::Avg:
+        inOrder = true;
+        break;
+      case FGFunctionProgram::OpCode::Quotient:
+      case FGFunctionProgram::OpCode::Fmod:
+        inOrder = inOrder || IsPure(params[0]);
+        break;
+      default:
+        inOrder = inOrder || nImpure == 1;
+        break;
+      }
+
+      if (inOrder) {
+        FGSharedExpression* expr = GetSharedExpression(f, params.size());
+        if (expr)
+          program.PushShared(expr);
+        else
+          CompileOperation(program, f, params.size());
+
+        return nImpure == 0;
+      }
+    }
+  }
+
+  program.PushParameter(p);
+  return false;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFunction::Compile(void)
+{
+  Program.Clear();
+
+  // A program made of a single call to GetValue() would be slower than the
+  // tree it replaces.
+  if (!Compile(Program, Parameters[0]) && Program.GetSize() == 1)
+    Program.Clear();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGFunction::cacheValue(bool cache)
 {
   cached = false; // Must set cached to false prior to calling GetValue(), else
@@ -954,6 +1403,14 @@ void FGFunction::cacheValue(bool cache)
     cached = true;
   }
 }
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFunction::SyncState(FGSnapshot& snapshot)
+{
+  snapshot.Sync(cached);
+  snapshot.Sync(cachedValue);
+}
   
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
@@ -961,9 +1418,17 @@ double FGFunction::GetValue(void) const
 {
   if (cached) return cachedValue;
 
-  double val = Parameters[0]->GetValue();
+  double val = memoValue;
+
+  if (InputsChanged()) {
+    val = Program.IsEmpty() ? Parameters[0]->GetValue() : Program.Execute();
+    memoValue = val;
+  }
 
-  if (pCopyTo) pCopyTo->setDoubleValue(val);
+  if (pCopyTo) {
+    pCopyTo->setDoubleValue(val);
+    SharedExpressions->Invalidate();
+  }
 
   return val;
 }
@@ -34,9 +34,11 @@ SENTRY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <map>
 #include <memory>
 
 #include "FGParameter.h"
+#include "FGFunctionProgram.h"
 #include "input_output/FGPropertyManager.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -48,6 +50,9 @@ namespace JSBSim {
 class Element;
 class FGPropertyValue;
 class FGFDMExec;
+class FGSharedExpression;
+class FGSharedExpressions;
+class FGSnapshot;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
@@ -802,6 +807,8 @@ public:
     constant parameters) ? */
   bool IsConstant(void) const override;
 
+  bool GetInputs(std::vector<FGPropertyNode*>& inputs) const override;
+
 /** Specifies whether to cache the value of the function, so it is calculated
     only once per frame.
     If shouldCache is true, then the value of the function is calculated, and a
@@ -812,6 +819,10 @@ public:
     value. */
   void cacheValue(bool shouldCache);
 
+  /** Saves or restores the value cached by cacheValue() (see
+      FGFDMExec::SaveSnapshot). */
+  void SyncState(FGSnapshot& snapshot);
+
   enum class OddEven {Either, Odd, Even};
 
 protected:
@@ -819,8 +830,16 @@ protected:
   double cachedValue;
   std::vector <FGParameter_ptr> Parameters;
   std::shared_ptr<FGPropertyManager> PropertyManager;
+  std::shared_ptr<FGSharedExpressions> SharedExpressions;
   FGPropertyNode_ptr pNode;
 
+  /** Memoization of the function value. The value is reused as long as the
+      version of its input properties is unchanged (see InputsChanged()). It is
+      Off for the functions which value does not only depend on properties with
+      a local value. */
+  enum class Memo {Unknown, On, Off};
+  mutable Memo memo = Memo::Unknown;
+
   void Load(Element* element, FGPropertyValue* var, FGFDMExec* fdmex,
             const std::string& prefix="");
   virtual void bind(Element*, const std::string&);
@@ -828,11 +847,33 @@ protected:
   void CheckMaxArguments(Element* el, unsigned int _max);
   void CheckOddOrEvenArguments(Element* el, OddEven odd_even);
   std::string CreateOutputNode(Element* el, const std::string& Prefix);
+  /** Flattens the tree of parameters into a bytecode program that is then
+      used by GetValue() to evaluate the function. */
+  void Compile(void);
 
 private:
   std::string Name;
+  std::string Operation; // Name of the XML element that defined the function
   FGPropertyNode_ptr pCopyTo; // Property node for CopyTo property string
-
+  FGFunctionProgram Program;
+  mutable std::vector<std::pair<FGPropertyNode*, unsigned long>> Inputs;
+  mutable double memoValue = 0.0;
+
+  friend class FGSharedExpressions;
+
+  bool InputsChanged(void) const;
+
+  static bool IsPure(const FGParameter* p);
+  static std::string GetKey(const FGParameter* p, size_t& nodes);
+  static std::string GetKey(const FGFunction* f, size_t n, size_t& nodes);
+  static bool GetSharedKey(const FGFunction* f, size_t n, std::string& key);
+  static void CountSubExpressions(const FGParameter* p,
+                                  std::map<std::string, unsigned int>& occurrences);
+  void CountSubExpressions(std::map<std::string, unsigned int>& occurrences);
+  FGSharedExpression* GetSharedExpression(const FGFunction* f, size_t n);
+  void CompileOperation(FGFunctionProgram& program, const FGFunction* f,
+                        size_t n);
+  bool Compile(FGFunctionProgram& program, FGParameter* p);
   void Debug(int from);
 };
 
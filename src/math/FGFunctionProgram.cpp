@@ -0,0 +1,308 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+  Module:       FGFunctionProgram.cpp
+  Author:       Dawn Aerospace
+  Date started: October 2026
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU Lesser General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option) any
+  later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+
+  You should have received a copy of the GNU Lesser General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc., 59
+  Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+  Further information about the GNU Lesser General Public License can also be
+  found on the world wide web at http://www.gnu.org.
+
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  INCLUDES
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cassert>
+#include <cmath>
+
+#include "FGFunctionProgram.h"
+#include "FGParameter.h"
+#include "FGSharedExpressions.h"
+#include "input_output/FGPropertyManager.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  CLASS IMPLEMENTATION
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+// Must be computed with the same expression as in FGFunction.cpp for <log2> to
+// return identical results.
+static const double invlog2val = 1.0/log10(2.0);
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFunctionProgram::Clear(void)
+{
+  Code.clear();
+  Stack.clear();
+  depth = 0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFunctionProgram::Emit(const Instruction& instr, int stack_delta)
+{
+  Code.push_back(instr);
+  assert(stack_delta >= 0 || depth >= static_cast<size_t>(-stack_delta));
+  depth += stack_delta;
+  if (depth > Stack.size()) Stack.resize(depth);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFunctionProgram::PushConstant(double value)
+{
+  Instruction instr;
+  instr.op = OpCode::Constant;
+  instr.nargs = 0;
+  instr.value = value;
+  instr.node = nullptr;
+  Emit(instr, 1);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFunctionProgram::PushProperty(FGPropertyNode* node, double sign)
+{
+  Instruction instr;
+  instr.op = OpCode::Property;
+  instr.nargs = 0;
+  instr.value = sign;
+  instr.node = node;
+  Emit(instr, 1);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFunctionProgram::PushParameter(FGParameter* param)
+{
+  Instruction instr;
+  instr.op = OpCode::Parameter;
+  instr.nargs = 0;
+  instr.value = 0.0;
+  instr.param = param;
+  Emit(instr, 1);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFunctionProgram::PushShared(const FGSharedExpression* expr)
+{
+  Instruction instr;
+  instr.op = OpCode::Shared;
+  instr.nargs = 0;
+  instr.value = 0.0;
+  instr.shared = expr;
+  Emit(instr, 1);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFunctionProgram::PushOperation(OpCode op, unsigned int nargs)
+{
+  assert(op != OpCode::Constant && op != OpCode::Property
+         && op != OpCode::Parameter && op != OpCode::Shared
+         && op != OpCode::MathFn);
+  assert(nargs > 0);
+
+  Instruction instr;
+  instr.op = op;
+  instr.nargs = nargs;
+  instr.value = 0.0;
+  instr.node = nullptr;
+  Emit(instr, 1-static_cast<int>(nargs));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFunctionProgram::PushMathFn(double (*math_fn)(double))
+{
+  Instruction instr;
+  instr.op = OpCode::MathFn;
+  instr.nargs = 1;
+  instr.value = 0.0;
+  instr.math_fn = math_fn;
+  Emit(instr, 0);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The arithmetic below must be kept in sync with the lambdas that are defined in
+// FGFunction::Load().
+
+double FGFunctionProgram::Execute(void) const
+{
+  assert(depth == 1);
+
+  double* sp = Stack.data(); // Points to the first free slot of the stack.
+
+  for (const Instruction& instr: Code) {
+    switch(instr.op) {
+    case OpCode::Constant:
+      *sp++ = instr.value;
+      break;
+    case OpCode::Property:
+      *sp++ = instr.node->getDoubleValue()*instr.value;
+      break;
+    case OpCode::Parameter:
+      *sp++ = instr.param->GetValue();
+      break;
+    case OpCode::Shared:
+      *sp++ = instr.shared->GetValue();
+      break;
+    case OpCode::Sum:
+      {
+        sp -= instr.nargs;
+        double temp = 0.0;
+        for (unsigned int i=0; i < instr.nargs; ++i)
+          temp += sp[i];
+        *sp++ = temp;
+      }
+      break;
+    case OpCode::Product:
+      {
+        sp -= instr.nargs;
+        double temp = 1.0;
+        for (unsigned int i=0; i < instr.nargs; ++i)
+          temp *= sp[i];
+        *sp++ = temp;
+      }
+      break;
+    case OpCode::Difference:
+      {
+        sp -= instr.nargs;
+        double temp = sp[0];
+        for (unsigned int i=1; i < instr.nargs; ++i)
+          temp -= sp[i];
+        *sp++ = temp;
+      }
+      break;
+    case OpCode::Min:
+      {
+        sp -= instr.nargs;
+        double _min = HUGE_VAL;
+        for (unsigned int i=0; i < instr.nargs; ++i)
+          if (sp[i] < _min) _min = sp[i];
+        *sp++ = _min;
+      }
+      break;
+    case OpCode::Max:
+      {
+        sp -= instr.nargs;
+        double _max = -HUGE_VAL;
+        for (unsigned int i=0; i < instr.nargs; ++i)
+          if (sp[i] > _max) _max = sp[i];
+        *sp++ = _max;
+      }
+      break;
+    case OpCode::Avg:
+      {
+        sp -= instr.nargs;
+        double temp = 0.0;
+        for (unsigned int i=0; i < instr.nargs; ++i)
+          temp += sp[i];
+        *sp++ = temp / static_cast<size_t>(instr.nargs);
+      }
+      break;
+    case OpCode::Quotient:
+      --sp;
+      sp[-1] = sp[0] != 0.0 ? sp[-1]/sp[0] : HUGE_VAL;
+      break;
+    case OpCode::Pow:
+      --sp;
+      sp[-1] = pow(sp[-1], sp[0]);
+      break;
+    case OpCode::Fmod:
+      --sp;
+      sp[-1] = sp[0] != 0.0 ? fmod(sp[-1], sp[0]) : HUGE_VAL;
+      break;
+    case OpCode::Atan2:
+      --sp;
+      sp[-1] = atan2(sp[-1], sp[0]);
+      break;
+    case OpCode::Mod:
+      --sp;
+      sp[-1] = static_cast<int>(sp[-1]) % static_cast<int>(sp[0]);
+      break;
+    case OpCode::Lt:
+      --sp;
+      sp[-1] = sp[-1] < sp[0] ? 1.0 : 0.0;
+      break;
+    case OpCode::Le:
+      --sp;
+      sp[-1] = sp[-1] <= sp[0] ? 1.0 : 0.0;
+      break;
+    case OpCode::Gt:
+      --sp;
+      sp[-1] = sp[-1] > sp[0] ? 1.0 : 0.0;
+      break;
+    case OpCode::Ge:
+      --sp;
+      sp[-1] = sp[-1] >= sp[0] ? 1.0 : 0.0;
+      break;
+    case OpCode::Eq:
+      --sp;
+      sp[-1] = sp[-1] == sp[0] ? 1.0 : 0.0;
+      break;
+    case OpCode::Nq:
+      --sp;
+      sp[-1] = sp[-1] != sp[0] ? 1.0 : 0.0;
+      break;
+    case OpCode::ToRadians:
+      sp[-1] = sp[-1]*M_PI/180.;
+      break;
+    case OpCode::ToDegrees:
+      sp[-1] = sp[-1]*180./M_PI;
+      break;
+    case OpCode::Sqrt:
+      sp[-1] = sp[-1] >= 0.0 ? sqrt(sp[-1]) : -HUGE_VAL;
+      break;
+    case OpCode::Log2:
+      sp[-1] = sp[-1] > 0.0 ? log10(sp[-1])*invlog2val : -HUGE_VAL;
+      break;
+    case OpCode::Ln:
+      sp[-1] = sp[-1] > 0.0 ? log(sp[-1]) : -HUGE_VAL;
+      break;
+    case OpCode::Log10:
+      sp[-1] = sp[-1] > 0.0 ? log10(sp[-1]) : -HUGE_VAL;
+      break;
+    case OpCode::Sign:
+      sp[-1] = sp[-1] < 0.0 ? -1 : 1; // 0.0 counts as positive.
+      break;
+    case OpCode::Fraction:
+      {
+        double scratch;
+        sp[-1] = modf(sp[-1], &scratch);
+      }
+      break;
+    case OpCode::Integer:
+      {
+        double result;
+        modf(sp[-1], &result);
+        sp[-1] = result;
+      }
+      break;
+    case OpCode::MathFn:
+      sp[-1] = instr.math_fn(sp[-1]);
+      break;
+    }
+  }
+
+  return sp[-1];
+}
+}
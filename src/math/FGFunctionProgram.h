@@ -0,0 +1,125 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+  Header: FGFunctionProgram.h
+  Author: Dawn Aerospace
+  Date started: October 2026
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU Lesser General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option) any
+  later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+
+  You should have received a copy of the GNU Lesser General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc., 59
+  Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+  Further information about the GNU Lesser General Public License can also be
+  found on the world wide web at http://www.gnu.org.
+
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  SENTRY
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGFUNCTIONPROGRAM_H
+#define FGFUNCTIONPROGRAM_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  INCLUDES
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <vector>
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  FORWARD DECLARATIONS
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+class FGParameter;
+class FGPropertyNode;
+class FGSharedExpression;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  CLASS DOCUMENTATION
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** A flat stack machine program evaluating an FGFunction.
+    The tree of FGParameter objects built by FGFunction is compiled once after
+    loading into a linear sequence of instructions in postfix order. Constants
+    and bound properties are pushed directly on the stack, the arithmetic
+    operations pop their arguments and push their result. Any parameter that
+    the compiler does not know how to translate is kept as an opaque
+    instruction that calls its FGParameter::GetValue() method. Sub-expressions
+    that are shared with other functions are evaluated by an instruction that
+    refers to an FGSharedExpression.
+
+    The instructions perform exactly the same floating point operations in the
+    same order as the FGFunction tree so the results are bit for bit identical.
+*/
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  DECLARATION: FGFunctionProgram
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGFunctionProgram
+{
+public:
+  enum class OpCode : unsigned char {
+    Constant, Property, Parameter, Shared,
+    Sum, Product, Difference, Min, Max, Avg,
+    Quotient, Pow, Fmod, Atan2, Mod,
+    Lt, Le, Gt, Ge, Eq, Nq,
+    ToRadians, ToDegrees, Sqrt, Log2, Ln, Log10, Sign, Fraction, Integer,
+    MathFn
+  };
+
+  /// Removes all the instructions from the program.
+  void Clear(void);
+  /// Returns true if the program has no instructions.
+  bool IsEmpty(void) const { return Code.empty(); }
+  /// Returns the number of instructions in the program.
+  size_t GetSize(void) const { return Code.size(); }
+
+  /// Pushes a constant on the stack.
+  void PushConstant(double value);
+  /// Pushes the value of a property node multiplied by sign on the stack.
+  void PushProperty(FGPropertyNode* node, double sign);
+  /// Pushes the result of param->GetValue() on the stack.
+  void PushParameter(FGParameter* param);
+  /// Pushes the value of an expression shared with other programs on the stack.
+  void PushShared(const FGSharedExpression* expr);
+  /** Pops nargs values from the stack and pushes the result of the operation
+      applied to them. */
+  void PushOperation(OpCode op, unsigned int nargs);
+  /// Pops one value from the stack and pushes the result of math_fn.
+  void PushMathFn(double (*math_fn)(double));
+
+  /// Runs the program and returns the value left on top of the stack.
+  double Execute(void) const;
+
+private:
+  struct Instruction {
+    OpCode op;
+    unsigned int nargs;
+    double value;
+    union {
+      FGPropertyNode* node;
+      FGParameter* param;
+      const FGSharedExpression* shared;
+      double (*math_fn)(double);
+    };
+  };
+
+  std::vector<Instruction> Code;
+  mutable std::vector<double> Stack;
+  size_t depth = 0;
+
+  void Emit(const Instruction& instr, int stack_delta);
+};
+}
+#endif
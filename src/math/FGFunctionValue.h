@@ -65,6 +65,7 @@ public:
     :FGPropertyValue(propName, propertyManager, el), function(f) {}
 
   double GetValue(void) const override { return function->GetValue(GetNode()); }
+  bool GetInputs(std::vector<FGPropertyNode*>&) const override { return false; }
 
   std::string GetName(void) const override {
     return function->GetName() + "(" + FGPropertyValue::GetName() + ")";
@@ -478,6 +478,8 @@ public:
   }
 
 private:
+  friend class FGSnapshot;
+
   /** Computation of derived values.
       This function re-computes the derived values like lat/lon and
       transformation matrices. It does this unconditionally. */
@@ -66,20 +66,29 @@ FGMatrix33::FGMatrix33(void)
 string FGMatrix33::Dump(const string& delimiter) const
 {
   ostringstream buffer;
-  buffer << setw(12) << setprecision(10) << data[0] << delimiter;
-  buffer << setw(12) << setprecision(10) << data[3] << delimiter;
-  buffer << setw(12) << setprecision(10) << data[6] << delimiter;
-  buffer << setw(12) << setprecision(10) << data[1] << delimiter;
-  buffer << setw(12) << setprecision(10) << data[4] << delimiter;
-  buffer << setw(12) << setprecision(10) << data[7] << delimiter;
-  buffer << setw(12) << setprecision(10) << data[2] << delimiter;
-  buffer << setw(12) << setprecision(10) << data[5] << delimiter;
-  buffer << setw(12) << setprecision(10) << data[8];
+  Dump(buffer, delimiter);
   return buffer.str();
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGMatrix33::Dump(ostream& out, const string& delimiter) const
+{
+  streamsize precision = out.precision(10);
+  out << setw(12) << data[0] << delimiter;
+  out << setw(12) << data[3] << delimiter;
+  out << setw(12) << data[6] << delimiter;
+  out << setw(12) << data[1] << delimiter;
+  out << setw(12) << data[4] << delimiter;
+  out << setw(12) << data[7] << delimiter;
+  out << setw(12) << data[2] << delimiter;
+  out << setw(12) << data[5] << delimiter;
+  out << setw(12) << data[8];
+  out.precision(precision);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 string FGMatrix33::Dump(const string& delimiter, const string& prefix) const
 {
   ostringstream buffer;
@@ -138,6 +138,12 @@ public:
       @return a string with the delimeter-separated contents of the matrix  */
   std::string Dump(const std::string& delimeter) const;
 
+  /** Prints the contents of the matrix to a stream. The precision of the
+      stream is left unchanged.
+      @param out the output stream
+      @param delimeter the item separator (tab or comma)  */
+  void Dump(std::ostream& out, const std::string& delimeter) const;
+
   /** Prints the contents of the matrix.
       @param delimeter the item separator (tab or comma, etc.)
       @param prefix an additional prefix that is used to indent the 3X3 matrix
@@ -40,6 +40,7 @@ INCLUDES
 #include "FGFDMExec.h"
 #include "FGModelFunctions.h"
 #include "input_output/FGXMLElement.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -128,6 +129,19 @@ void FGModelFunctions::RunPostFunctions(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGModelFunctions::SyncFunctions(FGSnapshot& snapshot)
+{
+  snapshot.Check(PreFunctions.size());
+  for (auto& prefunc: PreFunctions)
+    prefunc->SyncState(snapshot);
+
+  snapshot.Check(PostFunctions.size());
+  for (auto& postfunc: PostFunctions)
+    postfunc->SyncState(snapshot);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 std::shared_ptr<FGFunction> FGModelFunctions::GetPreFunction(const std::string& name)
 {
   for (auto& prefunc: PreFunctions) {
@@ -167,17 +181,23 @@ string FGModelFunctions::GetFunctionValues(const string& delimeter) const
 {
   ostringstream buf;
 
-  for (auto& prefunc: PreFunctions) {
-    if (buf.tellp() > 0) buf << delimeter;
-    buf << prefunc->GetValue();
-  }
+  GetFunctionValues(buf, delimeter);
 
-  for (auto& postfunc: PostFunctions) {
-    if (buf.tellp() > 0) buf << delimeter;
-    buf << postfunc->GetValue();
-  }
+  // Remove the delimiter that precedes the first value.
+  string values = buf.str();
+  return values.empty() ? values : values.substr(delimeter.size());
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-  return buf.str();
+void FGModelFunctions::GetFunctionValues(ostream& out,
+                                         const string& delimeter) const
+{
+  for (auto& prefunc: PreFunctions)
+    out << delimeter << prefunc->GetValue();
+
+  for (auto& postfunc: PostFunctions)
+    out << delimeter << postfunc->GetValue();
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -49,6 +49,7 @@ class FGFunction;
 class Element;
 class FGPropertyManager;
 class FGFDMExec;
+class FGSnapshot;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
@@ -91,6 +92,12 @@ public:
       functions */
   std::string GetFunctionValues(const std::string& delimeter) const;
 
+  /** Writes the function values to a stream.
+      @param out the output stream
+      @param delimeter either a tab or comma string depending on output type.
+             It is written before each value. */
+  void GetFunctionValues(std::ostream& out, const std::string& delimeter) const;
+
   /** Get one of the "pre" function
       @param name the name of the requested function.
       @return a pointer to the function (NULL if not found)
@@ -103,6 +110,9 @@ protected:
   FGPropertyReader LocalProperties;
 
   virtual bool InitModel(void);
+  /** Saves or restores the values that the pre and post functions have cached
+      for the current frame (see FGFDMExec::SaveSnapshot). */
+  void SyncFunctions(FGSnapshot& snapshot);
 };
 
 } // namespace JSBSim
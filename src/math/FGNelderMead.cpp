@@ -24,7 +24,6 @@
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
-#include <ctime>
 
 namespace JSBSim
 {
@@ -35,8 +34,10 @@ FGNelderMead::FGNelderMead(Function * f, const std::vector<double> & initialGues
                            const std::vector<double> & initialStepSize, int iterMax,
                            double rtol, double abstol, double speed, double randomization,
                            bool showConvergeStatus,
-                           bool showSimplex, bool pause, Callback * callback) :
+                           bool showSimplex, bool pause, Callback * callback,
+                           unsigned int seed) :
         m_f(f), m_callback(callback), m_randomization(randomization),
+        m_generator(seed),
         m_lowerBound(lowerBound), m_upperBound(upperBound),
         m_nDim(initialGuess.size()), m_nVert(m_nDim+1),
         m_iMax(1), m_iNextMax(1), m_iMin(1),
@@ -48,13 +49,10 @@ FGNelderMead::FGNelderMead(Function * f, const std::vector<double> & initialGues
         pause(pause), rtolI(), minCostPrevResize(1), minCost(), minCostPrev(), maxCost(),
         nextMaxCost()
 {
-    srand ( time(NULL) ); // seed random number generator
 }
 
 void FGNelderMead::update()
 {
-    std::cout.precision(3);
-
     // reinitialize simplex whenever rtol condition is met
     if ( rtolI < rtol || iter == 0)
     {
@@ -144,6 +142,7 @@ void FGNelderMead::update()
     // output cost and simplex
     if (showConvergeStatus)
     {
+        std::cout.precision(3);
         if ( (minCostPrev + std::numeric_limits<float>::epsilon() )
                 < minCost && minCostPrev != 0)
         {
@@ -256,7 +255,7 @@ int FGNelderMead::status()
 
 double FGNelderMead::getRandomFactor()
 {
-    double randFact = 1+(float(rand() % 1000)/500-1)*m_randomization;
+    double randFact = 1+(float(m_generator() % 1000)/500-1)*m_randomization;
     //std::cout << "random factor: " << randFact << std::endl;;
     return randFact;
 }
@@ -22,6 +22,7 @@
 #include <vector>
 #include <limits>
 #include <cstddef>
+#include <random>
 
 namespace JSBSim
 {
@@ -52,8 +53,10 @@ public:
                  double randomization=0.1,
                  bool showConvergeStatus=true,bool showSimplex=false,
                  bool pause=false,
-                 Callback * callback=NULL);
+                 Callback * callback=NULL,
+                 unsigned int seed=0);
     std::vector<double> getSolution();
+    int getIterations() const { return iter; }
 
     void update();
     int status();
@@ -63,6 +66,7 @@ private:
     Function * m_f;
     Callback * m_callback;
     double m_randomization;
+    std::mt19937 m_generator; // seeded so that the solutions are repeatable
     const std::vector<double> & m_lowerBound;
     const std::vector<double> & m_upperBound;
     size_t m_nDim, m_nVert;
@@ -37,6 +37,8 @@ INCLUDES
 #include <string>
 
 #include "JSBSim_API.h"
+#include <vector>
+
 #include "simgear/structure/SGSharedPtr.hxx"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -45,6 +47,8 @@ FORWARD DECLARATIONS
 
 namespace JSBSim {
 
+class FGPropertyNode;
+
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
@@ -64,6 +68,11 @@ public:
   virtual double GetValue(void) const = 0;
   virtual std::string GetName(void) const = 0;
   virtual bool IsConstant(void) const { return false; }
+  /** Appends the property nodes that the value of the parameter depends on to
+      inputs. Returns false if the value also depends on something else (random
+      numbers, internal state, ...) in which case inputs is incomplete. */
+  virtual bool GetInputs(std::vector<FGPropertyNode*>& inputs) const
+  { return false; }
 
   // SGPropertyNode impersonation.
   double getDoubleValue(void) const { return GetValue(); }
@@ -89,6 +89,9 @@ public:
 
   double GetValue(void) const override { return param->GetValue(); }
   bool IsConstant(void) const override { return param->IsConstant(); }
+  bool GetInputs(std::vector<FGPropertyNode*>& inputs) const override {
+    return param->GetInputs(inputs);
+  }
 
   std::string GetName(void) const override {
     FGPropertyValue* v = dynamic_cast<FGPropertyValue*>(param.ptr());
@@ -83,6 +83,20 @@ double FGPropertyValue::GetValue(void) const
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+bool FGPropertyValue::GetInputs(std::vector<FGPropertyNode*>& inputs) const
+{
+  // Do not report an error if the property does not exist yet: it might never
+  // be read.
+  if (!PropertyNode
+      && (!PropertyManager || !PropertyManager->HasNode(PropertyName)))
+    return false;
+
+  inputs.push_back(GetNode());
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGPropertyValue::SetValue(double value)
 {
   // SetValue() ignores the Sign flag. So make sure it is never called with a
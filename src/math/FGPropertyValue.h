@@ -73,18 +73,18 @@ public:
     return PropertyNode && (!PropertyNode->isTied()
                          && !PropertyNode->getAttribute(SGPropertyNode::WRITE));
   }
+  bool GetInputs(std::vector<FGPropertyNode*>& inputs) const override;
   void SetNode(FGPropertyNode* node) {PropertyNode = node;}
   void SetValue(double value);
   bool IsLateBound(void) const { return PropertyNode == nullptr; }
+  double GetSign(void) const { return Sign; }
+  FGPropertyNode* GetNode(void) const;
 
   std::string GetName(void) const override;
   virtual std::string GetNameWithSign(void) const;
   virtual std::string GetFullyQualifiedName(void) const;
   virtual std::string GetPrintableName(void) const;
 
-protected:
-  FGPropertyNode* GetNode(void) const;
-
 private:
   std::shared_ptr<FGPropertyManager> PropertyManager; // Property root used to do late binding.
   mutable FGPropertyNode_ptr PropertyNode;
@@ -239,15 +239,24 @@ void FGQuaternion::ComputeDerivedUnconditional(void) const
 std::string FGQuaternion::Dump(const std::string& delimiter) const
 {
   std::ostringstream buffer;
-  buffer << std::setprecision(16) << data[0] << delimiter;
-  buffer << std::setprecision(16) << data[1] << delimiter;
-  buffer << std::setprecision(16) << data[2] << delimiter;
-  buffer << std::setprecision(16) << data[3];
+  Dump(buffer, delimiter);
   return buffer.str();
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGQuaternion::Dump(std::ostream& out, const std::string& delimiter) const
+{
+  std::streamsize precision = out.precision(16);
+  out << data[0] << delimiter;
+  out << data[1] << delimiter;
+  out << data[2] << delimiter;
+  out << data[3];
+  out.precision(precision);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 std::ostream& operator<<(std::ostream& os, const FGQuaternion& q)
 {
   os << q(1) << " , " << q(2) << " , " << q(3) << " , " << q(4);
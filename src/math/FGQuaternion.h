@@ -480,10 +480,14 @@ public:
   static FGQuaternion zero(void) { return FGQuaternion( 0.0, 0.0, 0.0, 0.0 ); }
 
   std::string Dump(const std::string& delimiter) const;
+  /// Prints the quaternion to a stream, leaving its precision unchanged.
+  void Dump(std::ostream& out, const std::string& delimiter) const;
 
   friend FGQuaternion QExp(const FGColumnVector3& omega);
 
 private:
+  friend class FGSnapshot;
+
   /** Copying by assigning the vector valued components.  */
   FGQuaternion(double q1, double q2, double q3, double q4) : mCacheValid(false)
     { data[0] = q1; data[1] = q2; data[2] = q3; data[3] = q4; }
@@ -63,6 +63,7 @@ public:
   double GetValue(void) const override { return Value; };
   std::string GetName(void) const override;
   bool IsConstant(void) const override { return true; }
+  bool GetInputs(std::vector<FGPropertyNode*>&) const override { return true; }
 
 private:
   const double Value;
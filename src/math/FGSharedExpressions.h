@@ -0,0 +1,153 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+  Header: FGSharedExpressions.h
+  Author: Dawn Aerospace
+  Date started: October 2026
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU Lesser General Public License as published by the Free
+  Software Foundation; either version 2 of the License, or (at your option) any
+  later version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+  details.
+
+  You should have received a copy of the GNU Lesser General Public License along
+  with this program; if not, write to the Free Software Foundation, Inc., 59
+  Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+  Further information about the GNU Lesser General Public License can also be
+  found on the world wide web at http://www.gnu.org.
+
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  SENTRY
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGSHAREDEXPRESSIONS_H
+#define FGSHAREDEXPRESSIONS_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  INCLUDES
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+
+#include "FGFunctionProgram.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  FORWARD DECLARATIONS
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+class FGFunction;
+class FGSharedExpressions;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  CLASS DOCUMENTATION
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** A sub-expression shared by several functions.
+    The expression is compiled into its own program which is executed at most
+    once per evaluation pass (see FGSharedExpressions). Outside of a pass the
+    program is executed each time the value is requested.
+*/
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  DECLARATION: FGSharedExpression
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGSharedExpression
+{
+public:
+  explicit FGSharedExpression(const FGSharedExpressions* owner)
+    : Owner(owner) {}
+
+  /// Returns the value of the expression.
+  inline double GetValue(void) const;
+
+  FGFunctionProgram Program;
+
+private:
+  const FGSharedExpressions* Owner;
+  mutable double Value = 0.0;
+  mutable unsigned long Epoch = 0;
+};
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  CLASS DOCUMENTATION
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Registry of the sub-expressions that are shared between the functions of an
+    FDM instance.
+    Each top level FGFunction registers itself when it is constructed. Once the
+    model is loaded, FGFDMExec calls Share() which identifies the pure
+    sub-expressions (i.e. made of constants, properties and compiled
+    operations) that appear in more than one place and recompiles the
+    registered functions so that these sub-expressions are evaluated by a
+    single FGSharedExpression.
+
+    Properties can be modified at any time between two function evaluations so
+    the value of a shared expression is only reused within an evaluation pass.
+    A model opens a pass with BeginPass() when it is about to evaluate a set of
+    functions during which the properties that they read do not change, and
+    closes it with EndPass(). FGFunction calls Invalidate() whenever it writes
+    to a property during a pass.
+*/
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+  DECLARATION: FGSharedExpressions
+  %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGSharedExpressions
+{
+public:
+  /// Adds a top level function to the functions processed by Share().
+  void Register(FGFunction* f) { Functions.insert(f); }
+  /// Removes a function from the registry.
+  void Unregister(FGFunction* f) { Functions.erase(f); }
+  /** Counts the occurrences of the sub-expressions of the registered functions
+      and recompiles them to use the shared expressions. */
+  void Share(void);
+  /** Returns the shared expression identified by key or nullptr if the
+      sub-expression is not shared. The FGSharedExpression object is created by
+      the first call and is then compiled by the caller (as indicated by
+      created). */
+  FGSharedExpression* Get(const std::string& key, bool& created);
+  /// Returns the number of expressions that are shared.
+  size_t GetNumShared(void) const { return Shared.size(); }
+
+  /// Starts a new evaluation pass.
+  void BeginPass(void) { ++Epoch; InPass = true; }
+  /// Ends the current evaluation pass.
+  void EndPass(void) { InPass = false; }
+  /// Discards the values computed so far during the current pass.
+  void Invalidate(void) { ++Epoch; }
+
+private:
+  friend class FGSharedExpression;
+
+  std::set<FGFunction*> Functions;
+  std::map<std::string, unsigned int> Occurrences;
+  std::map<std::string, std::unique_ptr<FGSharedExpression>> Shared;
+  unsigned long Epoch = 1;
+  bool InPass = false;
+};
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double FGSharedExpression::GetValue(void) const
+{
+  if (Owner->InPass && Epoch == Owner->Epoch) return Value;
+
+  Value = Program.Execute();
+  Epoch = Owner->Epoch;
+  return Value;
+}
+}
+#endif
@@ -17,14 +17,32 @@
  */
 
 #include "initialization/FGInitialCondition.h"
+#include "input_output/FGXMLFileRead.h"
 #include "FGStateSpace.h"
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <limits>
 #include <iomanip>
+#include <mutex>
 #include <string>
+#include <thread>
 
 namespace JSBSim
 {
 
+// copy of the state space bound to a reload of the fdm
+struct FGStateSpace::Worker
+{
+    std::unique_ptr<FGFDMExec> fdm;
+    std::unique_ptr<FGStateSpace> ss;
+    std::vector< std::unique_ptr<Component> > components;
+};
+
+FGStateSpace::~FGStateSpace()
+{
+}
+
 void FGStateSpace::linearize(
     std::vector<double> x0,
     std::vector<double> u0,
@@ -35,82 +53,254 @@ void FGStateSpace::linearize(
     std::vector< std::vector<double> > & D)
 {
     double h = 1e-4;
+    WorkerList workers = createWorkers();
 
     // A, d(x)/dx
-    numericalJacobian(A,x,x,x0,x0,h,true);
+    numericalJacobian(A,x,x,x0,x0,workers,h,true);
     // B, d(x)/du
-    numericalJacobian(B,x,u,x0,u0,h,true);
+    numericalJacobian(B,x,u,x0,u0,workers,h,true);
     // C, d(y)/dx
-    numericalJacobian(C,y,x,y0,x0,h);
+    numericalJacobian(C,y,x,y0,x0,workers,h);
     // D, d(y)/du
-    numericalJacobian(D,y,u,y0,u0,h);
+    numericalJacobian(D,y,u,y0,u0,workers,h);
+
+}
+
+FGStateSpace::WorkerList FGStateSpace::createWorkers()
+{
+    WorkerList workers;
+    if (m_numThreads < 2) return workers;
+
+    for (ComponentVector * v : {&x, &u, &y})
+    {
+        for (unsigned int i=0;i<v->getSize();i++)
+        {
+            std::unique_ptr<Component> comp(v->getComp(i)->clone());
+            if (!comp)
+            {
+                std::cerr << "The component " << v->getName(i)
+                          << " cannot be copied, the linearization will not be parallel."
+                          << std::endl;
+                return workers;
+            }
+        }
+    }
+
+    // the reloads share the documents parsed by the fdm
+    if (!m_fdm->GetDocumentCache())
+        m_fdm->SetDocumentCache(std::make_shared<FGXMLDocumentCache>());
+
+    // the reloads read the state of the fdm so they are made one after the
+    // other on this thread
+    int debug_lvl = FGJSBBase::debug_lvl;
+    FGJSBBase::debug_lvl = 0;
+    for (unsigned int i=1;i<m_numThreads;i++)
+    {
+        std::unique_ptr<Worker> worker = createWorker();
+        if (worker) workers.push_back(std::move(worker));
+    }
+    FGJSBBase::debug_lvl = debug_lvl;
+    return workers;
+}
 
+std::unique_ptr<FGStateSpace::Worker> FGStateSpace::createWorker()
+{
+    std::unique_ptr<Worker> worker(new Worker);
+    worker->fdm = m_fdm->CachedReload();
+    if (!worker->fdm) return nullptr;
+
+    worker->ss.reset(new FGStateSpace(worker->fdm.get()));
+    for (ComponentVector * v : {&x, &u, &y})
+    {
+        ComponentVector & copy = worker->ss->matching(*this, *v);
+        for (unsigned int i=0;i<v->getSize();i++)
+        {
+            Component * comp = v->getComp(i)->clone();
+            worker->components.emplace_back(comp);
+            copy.add(comp);
+        }
+    }
+    return worker;
+}
+
+FGStateSpace::ComponentVector & FGStateSpace::matching(FGStateSpace & other, ComponentVector & v)
+{
+    if (&v == &other.x) return x;
+    else if (&v == &other.u) return u;
+    else return y;
 }
 
 void FGStateSpace::numericalJacobian(std::vector< std::vector<double> >  & J, ComponentVector & y,
-                                     ComponentVector & x, const std::vector<double> & y0, const std::vector<double> & x0, double h, bool computeYDerivative)
+                                     ComponentVector & x, const std::vector<double> & y0, const std::vector<double> & x0,
+                                     WorkerList & workers, double h, bool computeYDerivative)
 {
     size_t nX = x.getSize();
     size_t nY = y.getSize();
-    double f1 = 0, f2 = 0, fn1 = 0, fn2 = 0;
-    J.resize(nY);
-    for (unsigned int iY=0;iY<nY;iY++)
+    J.assign(nY, std::vector<double>(nX));
+
+    // all the perturbations start from the same state so that the result does
+    // not depend on the order in which the columns are computed
+    x.set(x0);
+    std::vector<char> base = m_fdm->SaveSnapshot();
+
+    // each thread computes the next column that has not been started yet
+    std::atomic<unsigned int> next(0);
+    std::exception_ptr error;
+    std::mutex errorMutex;
+    auto compute = [&](FGStateSpace & ss) {
+        ComponentVector & ssY = ss.matching(*this, y);
+        ComponentVector & ssX = ss.matching(*this, x);
+        try
+        {
+            for (unsigned int iX=next++;iX<nX;iX=next++)
+                ss.numericalJacobianColumn(J,ssY,ssX,base,iX,h,computeYDerivative);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!error) error = std::current_exception();
+            next = nX;
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (auto & worker : workers)
     {
-        J[iY].resize(nX);
-        for (unsigned int iX=0;iX<nX;iX++)
+        FGStateSpace & ss = *worker->ss;
+        threads.emplace_back([&compute, &ss]() {
+            FGJSBBase::debug_lvl = 0;
+            compute(ss);
+        });
+    }
+    compute(*this);
+    for (auto & thread : threads) thread.join();
+
+    if (error) std::rethrow_exception(error);
+    m_fdm->RestoreSnapshot(base);
+}
+
+void FGStateSpace::numericalJacobianColumn(std::vector< std::vector<double> > & J, ComponentVector & y,
+                                           ComponentVector & x, const std::vector<char> & base,
+                                           unsigned int iX, double h, bool computeYDerivative)
+{
+    size_t nY = y.getSize();
+    const double dx[4] = {h, 2*h, -h, -2*h};
+    std::vector<double> f[4];
+
+    for (unsigned int i=0;i<4;i++)
+    {
+        if (!m_fdm->RestoreSnapshot(base))
+            throw BaseException("The state of the linearization could not be restored.");
+        x.set(iX,x.get(iX)+dx[i]);
+        f[i].resize(nY);
+
+        if (!computeYDerivative)
         {
-            x.set(x0);
-            x.set(iX,x.get(iX)+h);
-            if (computeYDerivative) f1 = y.getDeriv(iY);
-            else f1 = y.get(iY);
-
-            x.set(x0);
-            x.set(iX,x.get(iX)+2*h);
-            if (computeYDerivative) f2 = y.getDeriv(iY);
-            else f2 = y.get(iY);
-
-            x.set(x0);
-            x.set(iX,x.get(iX)-h);
-            if (computeYDerivative) fn1 = y.getDeriv(iY);
-            else fn1 = y.get(iY);
-
-            x.set(x0);
-            x.set(iX,x.get(iX)-2*h);
-            if (computeYDerivative) fn2 = y.getDeriv(iY);
-            else fn2 = y.get(iY);
-
-			double diff1 = f1-fn1;
-			double diff2 = f2-fn2;
-
-			// correct for angle wrap
-			if (x.getComp(iX)->getUnit().compare("rad") == 0) {
-				while(diff1 > M_PI) diff1 -= 2*M_PI;
-				if(diff1 < -M_PI) diff1 += 2*M_PI;
-				if(diff2 > M_PI) diff2 -= 2*M_PI;
-				if(diff2 < -M_PI) diff2 += 2*M_PI;
-			} else if (x.getComp(iX)->getUnit().compare("deg") == 0) {
-				if(diff1 > 180) diff1 -= 360;
-				if(diff1 < -180) diff1 += 360;
-				if(diff2 > 180) diff2 -= 360;
-				if(diff2 < -180) diff2 += 360;
-			}
-            J[iY][iX] = (8*diff1-diff2)/(12*h); // 3rd order taylor approx from lewis, pg 203
-
-            x.set(x0);
-
-            if (m_fdm->GetDebugLevel() > 1)
+            for (unsigned int iY=0;iY<nY;iY++) f[i][iY] = y.get(iY);
+            continue;
+        }
+
+        // the default derivatives of all the outputs are computed from a
+        // single run of the model, the components that override getDeriv()
+        // may run the model themselves so the perturbed state is restored
+        // before each of them
+        std::vector<char> perturbed = m_fdm->SaveSnapshot();
+        runDerivs(y);
+        bool modified = true;
+
+        for (unsigned int iY=0;iY<nY;iY++)
+        {
+            if (modified && !m_fdm->RestoreSnapshot(perturbed))
             {
-                std::cout << std::scientific << "\ty:\t" << y.getName(iY) << "\tx:\t"
-                          << x.getName(iX)
-                          << "\tfn2:\t" << fn2 << "\tfn1:\t" << fn1
-                          << "\tf1:\t" << f1 << "\tf2:\t" << f2
-                          << "\tf1-fn1:\t" << f1-fn1
-                          << "\tf2-fn2:\t" << f2-fn2
-                          << "\tdf/dx:\t" << J[iY][iX]
-                          << std::fixed << std::endl;
+                m_runOutputs = nullptr;
+                throw BaseException("The perturbed state could not be restored.");
             }
+            m_runDerivRead = false;
+            f[i][iY] = y.getDeriv(iY);
+            modified = !m_runDerivRead;
+        }
+        m_runOutputs = nullptr;
+    }
+
+    for (unsigned int iY=0;iY<nY;iY++)
+    {
+        double f1 = f[0][iY], f2 = f[1][iY], fn1 = f[2][iY], fn2 = f[3][iY];
+		double diff1 = f1-fn1;
+		double diff2 = f2-fn2;
+
+		// correct for angle wrap
+		if (x.getComp(iX)->getUnit().compare("rad") == 0) {
+			while(diff1 > M_PI) diff1 -= 2*M_PI;
+			if(diff1 < -M_PI) diff1 += 2*M_PI;
+			if(diff2 > M_PI) diff2 -= 2*M_PI;
+			if(diff2 < -M_PI) diff2 += 2*M_PI;
+		} else if (x.getComp(iX)->getUnit().compare("deg") == 0) {
+			if(diff1 > 180) diff1 -= 360;
+			if(diff1 < -180) diff1 += 360;
+			if(diff2 > 180) diff2 -= 360;
+			if(diff2 < -180) diff2 += 360;
+		}
+        J[iY][iX] = (8*diff1-diff2)/(12*h); // 3rd order taylor approx from lewis, pg 203
+
+        if (m_fdm->GetDebugLevel() > 1)
+        {
+            std::cout << std::scientific << "\ty:\t" << y.getName(iY) << "\tx:\t"
+                      << x.getName(iX)
+                      << "\tfn2:\t" << fn2 << "\tfn1:\t" << fn1
+                      << "\tf1:\t" << f1 << "\tf2:\t" << f2
+                      << "\tf1-fn1:\t" << f1-fn1
+                      << "\tf2-fn2:\t" << f2-fn2
+                      << "\tdf/dx:\t" << J[iY][iX]
+                      << std::fixed << std::endl;
+        }
+    }
+}
+
+void FGStateSpace::runDerivs(ComponentVector & y)
+{
+    std::vector<double> f0 = y.get();
+    double dt0 = m_fdm->GetDeltaT();
+    double time0 = m_fdm->GetSimTime();
+    m_fdm->Setdt(1./120.);
+    m_fdm->DisableOutput();
+    m_fdm->Run();
+    std::vector<double> f1 = y.get();
+
+    m_runDerivs.resize(y.getSize());
+    for (unsigned int iY=0;iY<y.getSize();iY++)
+    {
+        if (m_fdm->GetDebugLevel() > 1)
+        {
+            std::cout << std::scientific
+                      << "name: " << y.getName(iY)
+                      << "\nf1: " << f0[iY]
+                      << "\nf2: " << f1[iY]
+                      << "\ndt: " << m_fdm->GetDeltaT()
+                      << "\tdf/dt: " << (f1[iY]-f0[iY])/m_fdm->GetDeltaT()
+                      << std::fixed << std::endl;
+        }
+        m_runDerivs[iY] = (f1[iY]-f0[iY])/m_fdm->GetDeltaT();
+    }
+
+    m_fdm->Setdt(dt0); // restore original value
+    m_fdm->Setsim_time(time0);
+    m_fdm->EnableOutput();
+    m_runOutputs = &y;
+}
+
+bool FGStateSpace::getRunDeriv(const Component * comp, double & deriv)
+{
+    if (!m_runOutputs) return false;
+    for (unsigned int iY=0;iY<m_runOutputs->getSize();iY++)
+    {
+        if (m_runOutputs->getComp(iY) == comp)
+        {
+            deriv = m_runDerivs[iY];
+            m_runDerivRead = true;
+            return true;
         }
     }
+    return false;
 }
 
 std::ostream &operator<<( std::ostream &out, const FGStateSpace::Component &c )
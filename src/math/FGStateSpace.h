@@ -31,6 +31,7 @@
 #include <fstream>
 #include <iostream>
 #include <limits>
+#include <memory>
 
 namespace JSBSim
 {
@@ -52,9 +53,15 @@ public:
         virtual ~Component() {};
         virtual double get() const = 0;
         virtual void set(double val) = 0;
+        // copy of the component, used to bind it to a reload of the fdm
+        // (returns null if the component cannot be copied)
+        virtual Component * clone() const { return nullptr; }
         virtual double getDeriv() const
         {
-            // by default should calculate using finite difference approx
+            // by default should calculate using finite difference approx,
+            // the linearization runs the model once for all the outputs
+            double runDeriv;
+            if (m_stateSpace->getRunDeriv(this, runDeriv)) return runDeriv;
             std::vector<double> x0 = m_stateSpace->x.get();
             double f0 = get();
             double dt0 = m_fdm->GetDeltaT();
@@ -215,10 +222,15 @@ public:
     ComponentVector x, u, y;
 
     // constructor
-    FGStateSpace(FGFDMExec * fdm) : x(fdm,this), u(fdm,this), y(fdm,this), m_fdm(fdm) {};
+    FGStateSpace(FGFDMExec * fdm) : x(fdm,this), u(fdm,this), y(fdm,this), m_fdm(fdm), m_numThreads(1),
+            m_runOutputs(), m_runDerivRead(false) {};
 
     void setFdm(FGFDMExec * fdm) { m_fdm = fdm; }
 
+    // number of threads over which the perturbations of linearize() are
+    // spread, each additional thread runs its own reload of the fdm
+    void setNumThreads(unsigned int numThreads) { m_numThreads = numThreads; }
+
     void run() {
         // initialize
         m_fdm->Initialize(m_fdm->GetIC().get());
@@ -228,16 +240,20 @@ public:
         }
 
         // wait for stable state
+        // (the integration is only suspended here if the caller has not
+        // already done so, otherwise resuming it would reset the time step
+        // to zero)
+        bool suspended = m_fdm->IntegrationSuspended();
         double cost = stateSum();
         for(int i=0;i<1000;i++) {
             m_fdm->GetPropulsion()->GetSteadyState();
             m_fdm->SetTrimStatus(true);
             m_fdm->DisableOutput();
-            m_fdm->SuspendIntegration();
+            if (!suspended) m_fdm->SuspendIntegration();
             m_fdm->Run();
             m_fdm->SetTrimStatus(false);
             m_fdm->EnableOutput();
-            m_fdm->ResumeIntegration();
+            if (!suspended) m_fdm->ResumeIntegration();
 
             double costNew = stateSum();
             double dcost = fabs(costNew - cost);
@@ -272,7 +288,7 @@ public:
     }
 
     // deconstructor
-    virtual ~FGStateSpace() {};
+    virtual ~FGStateSpace();
 
     // linearization function
     void linearize(std::vector<double> x0, std::vector<double> u0, std::vector<double> y0,
@@ -284,13 +300,42 @@ public:
 
 private:
 
-    // compute numerical jacobian of a matrix
+    // copy of the state space bound to a reload of the fdm
+    struct Worker;
+    typedef std::vector< std::unique_ptr<Worker> > WorkerList;
+
+    // compute numerical jacobian of a matrix, the columns are shared between
+    // this state space and the workers
     void numericalJacobian(std::vector< std::vector<double> > & J, ComponentVector & y,
                            ComponentVector & x, const std::vector<double> & y0,
-                           const std::vector<double> & x0, double h=1e-5, bool computeYDerivative = false);
+                           const std::vector<double> & x0, WorkerList & workers,
+                           double h=1e-5, bool computeYDerivative = false);
+
+    // compute one column of the jacobian: x is perturbed once from the base
+    // snapshot for each point of the finite difference and all the outputs
+    // are evaluated
+    void numericalJacobianColumn(std::vector< std::vector<double> > & J, ComponentVector & y,
+                                 ComponentVector & x, const std::vector<char> & base,
+                                 unsigned int iX, double h, bool computeYDerivative);
+
+    // compute the default derivatives of all the outputs y from a single run
+    // of the model, they are returned by Component::getDeriv() until the
+    // outputs are cleared
+    void runDerivs(ComponentVector & y);
+    bool getRunDeriv(const Component * comp, double & deriv);
+
+    WorkerList createWorkers();
+    std::unique_ptr<Worker> createWorker();
+    ComponentVector & matching(FGStateSpace & other, ComponentVector & v);
 
     // flight dynamcis model
     FGFDMExec * m_fdm;
+    unsigned int m_numThreads;
+
+    // outputs and derivatives of the last call to runDerivs()
+    const ComponentVector * m_runOutputs;
+    std::vector<double> m_runDerivs;
+    bool m_runDerivRead;
 
 public:
 
@@ -300,6 +345,7 @@ public:
     {
     public:
         Vt() : Component("Vt","ft/s") {};
+        Component * clone() const { return new Vt(*this); }
         double get() const
         {
             return m_fdm->GetAuxiliary()->GetVt();
@@ -323,6 +369,7 @@ public:
     {
     public:
         VGround() : Component("VGround","ft/s") {};
+        Component * clone() const { return new VGround(*this); }
         double get() const
         {
             return m_fdm->GetAuxiliary()->GetVground();
@@ -337,6 +384,7 @@ public:
     {
     public:
         AccelX() : Component("AccelX","ft/s^2") {};
+        Component * clone() const { return new AccelX(*this); }
         double get() const
         {
             return m_fdm->GetAuxiliary()->GetPilotAccel(1);
@@ -351,6 +399,7 @@ public:
     {
     public:
         AccelY() : Component("AccelY","ft/s^2") {};
+        Component * clone() const { return new AccelY(*this); }
         double get() const
         {
             return m_fdm->GetAuxiliary()->GetPilotAccel(2);
@@ -365,6 +414,7 @@ public:
     {
     public:
         AccelZ() : Component("AccelZ","ft/s^2") {};
+        Component * clone() const { return new AccelZ(*this); }
         double get() const
         {
             return m_fdm->GetAuxiliary()->GetPilotAccel(3);
@@ -379,6 +429,7 @@ public:
     {
     public:
         Alpha() : Component("Alpha","rad") {};
+        Component * clone() const { return new Alpha(*this); }
         double get() const
         {
             return m_fdm->GetAuxiliary()->Getalpha();
@@ -403,6 +454,7 @@ public:
     {
     public:
         Theta() : Component("Theta","rad") {};
+        Component * clone() const { return new Theta(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetEuler(2);
@@ -422,6 +474,7 @@ public:
     {
     public:
         Q() : Component("Q","rad/s") {};
+        Component * clone() const { return new Q(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetPQR(2);
@@ -440,6 +493,7 @@ public:
     {
     public:
         Alt() : Component("Alt","ft") {};
+        Component * clone() const { return new Alt(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetAltitudeASL();
@@ -458,6 +512,7 @@ public:
     {
     public:
         Beta() : Component("Beta","rad") {};
+        Component * clone() const { return new Beta(*this); }
         double get() const
         {
             return m_fdm->GetAuxiliary()->Getbeta();
@@ -478,6 +533,7 @@ public:
     {
     public:
         Phi() : Component("Phi","rad") {};
+        Component * clone() const { return new Phi(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetEuler(1);
@@ -496,6 +552,7 @@ public:
     {
     public:
         P() : Component("P","rad/s") {};
+        Component * clone() const { return new P(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetPQR(1);
@@ -514,6 +571,7 @@ public:
     {
     public:
         R() : Component("R","rad/s") {};
+        Component * clone() const { return new R(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetPQR(3);
@@ -532,6 +590,7 @@ public:
     {
     public:
         Psi() : Component("Psi","rad") {};
+        Component * clone() const { return new Psi(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetEuler(3);
@@ -550,6 +609,7 @@ public:
     {
     public:
         ThrottleCmd() : Component("ThtlCmd","norm") {};
+        Component * clone() const { return new ThrottleCmd(*this); }
         double get() const
         {
             return m_fdm->GetFCS()->GetThrottleCmd(0);
@@ -566,6 +626,7 @@ public:
     {
     public:
         ThrottlePos() : Component("ThtlPos","norm") {};
+        Component * clone() const { return new ThrottlePos(*this); }
         double get() const
         {
             return m_fdm->GetFCS()->GetThrottlePos(0);
@@ -581,6 +642,7 @@ public:
     {
     public:
         DaCmd() : Component("DaCmd","norm") {};
+        Component * clone() const { return new DaCmd(*this); }
         double get() const
         {
             return m_fdm->GetFCS()->GetDaCmd();
@@ -596,6 +658,7 @@ public:
     {
     public:
         DaPos() : Component("DaPos","norm") {};
+        Component * clone() const { return new DaPos(*this); }
         double get() const
         {
             return m_fdm->GetFCS()->GetDaLPos();
@@ -611,6 +674,7 @@ public:
     {
     public:
         DeCmd() : Component("DeCmd","norm") {};
+        Component * clone() const { return new DeCmd(*this); }
         double get() const
         {
             return m_fdm->GetFCS()->GetDeCmd();
@@ -626,6 +690,7 @@ public:
     {
     public:
         DePos() : Component("DePos","norm") {};
+        Component * clone() const { return new DePos(*this); }
         double get() const
         {
             return m_fdm->GetFCS()->GetDePos();
@@ -640,6 +705,7 @@ public:
     {
     public:
         DrCmd() : Component("DrCmd","norm") {};
+        Component * clone() const { return new DrCmd(*this); }
         double get() const
         {
             return m_fdm->GetFCS()->GetDrCmd();
@@ -655,6 +721,7 @@ public:
     {
     public:
         DrPos() : Component("DrPos","norm") {};
+        Component * clone() const { return new DrPos(*this); }
         double get() const
         {
             return m_fdm->GetFCS()->GetDrPos();
@@ -669,6 +736,7 @@ public:
     {
     public:
         Rpm0() : Component("Rpm0","rev/min") {};
+        Component * clone() const { return new Rpm0(*this); }
         double get() const
         {
             return m_fdm->GetPropulsion()->GetEngine(0)->GetThruster()->GetRPM();
@@ -683,6 +751,7 @@ public:
     {
     public:
         Rpm1() : Component("Rpm1","rev/min") {};
+        Component * clone() const { return new Rpm1(*this); }
         double get() const
         {
             return m_fdm->GetPropulsion()->GetEngine(1)->GetThruster()->GetRPM();
@@ -697,6 +766,7 @@ public:
     {
     public:
         Rpm2() : Component("Rpm2","rev/min") {};
+        Component * clone() const { return new Rpm2(*this); }
         double get() const
         {
             return m_fdm->GetPropulsion()->GetEngine(2)->GetThruster()->GetRPM();
@@ -711,6 +781,7 @@ public:
     {
     public:
         Rpm3() : Component("Rpm3","rev/min") {};
+        Component * clone() const { return new Rpm3(*this); }
         double get() const
         {
             return m_fdm->GetPropulsion()->GetEngine(3)->GetThruster()->GetRPM();
@@ -725,6 +796,7 @@ public:
     {
     public:
         PropPitch() : Component("Prop Pitch","deg") {};
+        Component * clone() const { return new PropPitch(*this); }
         double get() const
         {
             return m_fdm->GetPropulsion()->GetEngine(0)->GetThruster()->GetPitch();
@@ -740,6 +812,7 @@ public:
     {
     public:
         Longitude() : Component("Longitude","rad") {};
+        Component * clone() const { return new Longitude(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetLongitude();
@@ -758,6 +831,7 @@ public:
     {
     public:
         Latitude() : Component("Latitude","rad") {};
+        Component * clone() const { return new Latitude(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetLatitude();
@@ -776,6 +850,7 @@ public:
     {
     public:
         Pi() : Component("P inertial","rad/s") {};
+        Component * clone() const { return new Pi(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetPQRi(1);
@@ -797,6 +872,7 @@ public:
     {
     public:
         Qi() : Component("Q inertial","rad/s") {};
+        Component * clone() const { return new Qi(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetPQRi(2);
@@ -818,6 +894,7 @@ public:
     {
     public:
         Ri() : Component("R inertial","rad/s") {};
+        Component * clone() const { return new Ri(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetPQRi(3);
@@ -839,6 +916,7 @@ public:
     {
     public:
         Vn() : Component("Vel north","feet/s") {};
+        Component * clone() const { return new Vn(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetVel(1);
@@ -858,6 +936,7 @@ public:
     {
     public:
         Ve() : Component("Vel east","feet/s") {};
+        Component * clone() const { return new Ve(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetVel(2);
@@ -877,6 +956,7 @@ public:
     {
     public:
         Vd() : Component("Vel down","feet/s") {};
+        Component * clone() const { return new Vd(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetVel(3);
@@ -896,6 +976,7 @@ public:
     {
     public:
         COG() : Component("Course Over Ground","rad") {};
+        Component * clone() const { return new COG(*this); }
         double get() const
         {
             //cog = atan2(Ve,Vn)
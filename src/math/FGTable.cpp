@@ -36,9 +36,15 @@ JSB  1/9/00          Created
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <cstring>
 #include <limits>
 #include <assert.h>
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define FGTABLE_AVX2
+#include <immintrin.h>
+#endif
+
 #include "FGTable.h"
 #include "input_output/FGXMLElement.h"
 
@@ -54,9 +60,7 @@ FGTable::FGTable(int NRows)
   : nRows(NRows), nCols(1)
 {
   Type = tt1D;
-  // Fill unused elements with NaNs to detect illegal access.
-  Data.push_back(std::numeric_limits<double>::quiet_NaN());
-  Data.push_back(std::numeric_limits<double>::quiet_NaN());
+  Allocate();
   Debug(0);
 }
 
@@ -66,8 +70,7 @@ FGTable::FGTable(int NRows, int NCols)
   : nRows(NRows), nCols(NCols)
 {
   Type = tt2D;
-  // Fill unused elements with NaNs to detect illegal access.
-  Data.push_back(std::numeric_limits<double>::quiet_NaN());
+  Allocate();
   Debug(0);
 }
 
@@ -79,18 +82,39 @@ FGTable::FGTable(const FGTable& t)
   Type = t.Type;
   nRows = t.nRows;
   nCols = t.nCols;
+  nFilled = t.nFilled;
   internal = t.internal;
   Name = t.Name;
   lookupProperty[0] = t.lookupProperty[0];
   lookupProperty[1] = t.lookupProperty[1];
   lookupProperty[2] = t.lookupProperty[2];
 
-  // Deep copy of t.Tables
-  Tables.reserve(t.Tables.size());
-  for(const auto &t: t.Tables)
-    Tables.push_back(std::make_unique<FGTable>(*t));
-
   Data = t.Data;
+  Slices = t.Slices;
+
+  // The lookups of the copy do not start from the intervals found by the
+  // lookups of the original table.
+  for (auto& s: Slices) s.lastRow = s.lastCol = 1;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTable::Allocate(void)
+{
+  assert(Type != tt3D);
+
+  Slice s;
+  s.nRows = nRows;
+  s.nCols = nCols;
+  s.cols = 0;
+  s.rows = Type == tt2D ? nCols : 0;
+  s.values = s.rows + nRows;
+  Slices.assign(1, s);
+
+  // Fill the elements with NaNs to detect illegal access to the elements that
+  // have not been populated.
+  Data.assign(s.values + static_cast<size_t>(nRows)*nCols,
+              std::numeric_limits<double>::quiet_NaN());
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -301,35 +325,57 @@ FGTable::FGTable(std::shared_ptr<FGPropertyManager> pm, Element* el,
     nRows = tableData->GetNumDataLines();
     nCols = 1;
     Type = tt1D;
-    // Fill unused elements with NaNs to detect illegal access.
-    Data.push_back(std::numeric_limits<double>::quiet_NaN());
-    Data.push_back(std::numeric_limits<double>::quiet_NaN());
+    Allocate();
     *this << buf;
     break;
   case 2:
     nRows = tableData->GetNumDataLines()-1;
     nCols = FindNumColumns(tableData->GetDataLine(0));
     Type = tt2D;
-    // Fill unused elements with NaNs to detect illegal access.
-    Data.push_back(std::numeric_limits<double>::quiet_NaN());
+    Allocate();
     *this << buf;
     break;
   case 3:
-    nRows = el->GetNumElements("tableData");
-    nCols = 1;
-    Type = tt3D;
-    // Fill unused elements with NaNs to detect illegal access.
-    Data.push_back(std::numeric_limits<double>::quiet_NaN());
+    {
+      nRows = el->GetNumElements("tableData");
+      nCols = 1;
+      Type = tt3D;
+
+      // Each slice is read as a 2D table and then copied in the storage of
+      // this table.
+      vector<FGTable> tables;
+      vector<double> breakpoints;
+      size_t nBreakpoints = nRows, nValues = 0;
+
+      tables.reserve(nRows);
+      tableData = el->FindElement("tableData");
+      while (tableData) {
+        tables.emplace_back(PropertyManager, tableData);
+        breakpoints.push_back(tableData->GetAttributeValueAsNumber("breakPoint"));
+        const Slice& s = tables.back().Slices.front();
+        nBreakpoints += s.values;
+        nValues += static_cast<size_t>(s.nRows)*s.nCols;
+        tableData = el->FindNextElement("tableData");
+      }
 
-    tableData = el->FindElement("tableData");
-    while (tableData) {
-      Tables.push_back(std::make_unique<FGTable>(PropertyManager, tableData));
-      Data.push_back(tableData->GetAttributeValueAsNumber("breakPoint"));
-      Tables.back()->lookupProperty[eRow] = lookupProperty[eRow];
-      Tables.back()->lookupProperty[eColumn] = lookupProperty[eColumn];
-      tableData = el->FindNextElement("tableData");
+      Data.reserve(nBreakpoints + nValues);
+      Data.assign(breakpoints.begin(), breakpoints.end());
+      Data.resize(nBreakpoints);
+      size_t offset = nRows;
+
+      for (const auto& t: tables) {
+        const Slice& ts = t.Slices.front();
+        Slice s = ts;
+        s.cols = offset;
+        s.rows = offset + ts.rows;
+        s.values = Data.size();
+        s.lastRow = s.lastCol = 1;
+        copy(t.Data.begin(), t.Data.begin()+ts.values, Data.begin()+offset);
+        Data.insert(Data.end(), t.Data.begin()+ts.values, t.Data.end());
+        Slices.push_back(s);
+        offset += ts.values;
+      }
     }
-
     break;
   default:
     assert(false); // Should never be called
@@ -348,12 +394,12 @@ FGTable::FGTable(std::shared_ptr<FGPropertyManager> pm, Element* el,
 
   // check breakpoints, if applicable
   if (Type == tt3D) {
-    for (unsigned int b=2; b<=Tables.size(); ++b) {
+    for (unsigned int b=1; b<nRows; ++b) {
       if (Data[b] <= Data[b-1]) {
         std::cerr << el->ReadFrom()
                   << fgred << highint
                   << "  FGTable: breakpoint lookup is not monotonically increasing" << endl
-                  << "  in breakpoint " << b;
+                  << "  in breakpoint " << b+1;
         if (nameel != 0) std::cerr << " of table in " << nameel->GetAttributeValue("name");
         std::cerr << ":" << reset << endl
                   << "  " << Data[b] << "<=" << Data[b-1] << endl;
@@ -361,34 +407,36 @@ FGTable::FGTable(std::shared_ptr<FGPropertyManager> pm, Element* el,
       }
     }
   }
+  else { // in 3D tables, the slices have already been checked.
+    const double* cols = &Data[Slices[0].cols];
+    const double* rows = &Data[Slices[0].rows];
 
-  // check columns, if applicable
-  if (Type == tt2D) {
-    for (unsigned int c=2; c<=nCols; ++c) {
-      if (Data[c] <= Data[c-1]) {
-        std::cerr << el->ReadFrom()
-                  << fgred << highint
-                  << "  FGTable: column lookup is not monotonically increasing" << endl
-                  << "  in column " << c;
-        if (nameel != 0) std::cerr << " of table in " << nameel->GetAttributeValue("name");
-        std::cerr << ":" << reset << endl
-                  << "  " << Data[c] << "<=" << Data[c-1] << endl;
-        throw BaseException("FGTable: column lookup is not monotonically increasing");
+    // check columns, if applicable
+    if (Type == tt2D) {
+      for (unsigned int c=1; c<nCols; ++c) {
+        if (cols[c] <= cols[c-1]) {
+          std::cerr << el->ReadFrom()
+                    << fgred << highint
+                    << "  FGTable: column lookup is not monotonically increasing" << endl
+                    << "  in column " << c+1;
+          if (nameel != 0) std::cerr << " of table in " << nameel->GetAttributeValue("name");
+          std::cerr << ":" << reset << endl
+                    << "  " << cols[c] << "<=" << cols[c-1] << endl;
+          throw BaseException("FGTable: column lookup is not monotonically increasing");
+        }
       }
     }
-  }
 
-  // check rows
-  if (Type != tt3D) { // in 3D tables, check only rows of subtables
-    for (size_t r=2; r<=nRows; ++r) {
-      if (Data[r*(nCols+1)]<=Data[(r-1)*(nCols+1)]) {
+    // check rows
+    for (unsigned int r=1; r<nRows; ++r) {
+      if (rows[r] <= rows[r-1]) {
         std::cerr << el->ReadFrom()
                   << fgred << highint
                   << "  FGTable: row lookup is not monotonically increasing" << endl
-                  << "  in row " << r;
+                  << "  in row " << r+1;
         if (nameel != 0) std::cerr << " of table in " << nameel->GetAttributeValue("name");
         std::cerr << ":" << reset << endl
-                  << "  " << Data[r*(nCols+1)] << "<=" << Data[(r-1)*(nCols+1)] << endl;
+                  << "  " << rows[r] << "<=" << rows[r-1] << endl;
         throw BaseException("FGTable: row lookup is not monotonically increasing");
       }
     }
@@ -397,14 +445,13 @@ FGTable::FGTable(std::shared_ptr<FGPropertyManager> pm, Element* el,
   // Check the table has been entirely populated.
   switch (Type) {
   case tt1D:
-    if (Data.size() != 2*nRows+2) missingData(el, 2*nRows, Data.size()-2);
+    if (nFilled != 2*nRows) missingData(el, 2*nRows, nFilled);
     break;
   case tt2D:
-    if (Data.size() != static_cast<size_t>(nRows+1)*(nCols+1))
-      missingData(el, (nRows+1)*(nCols+1)-1, Data.size()-1);
+    if (nFilled != Data.size())
+      missingData(el, (nRows+1)*(nCols+1)-1, nFilled);
     break;
   case tt3D:
-    if (Data.size() != nRows+1) missingData(el, nRows, Data.size()-1);
     break;
   default:
     assert(false);  // Should never be called
@@ -451,12 +498,46 @@ FGTable::~FGTable()
 double FGTable::GetElement(unsigned int r, unsigned int c) const
 {
   assert(r <= nRows && c <= nCols);
-  if (Type == tt3D) {
-    assert(Data.size() == nRows+1);
-    return Data[r];
+  // The upper left corner of the table is unused.
+  if (r == 0 && (c == 0 || Type != tt2D))
+    return std::numeric_limits<double>::quiet_NaN();
+
+  if (Type == tt3D) return Data[r-1];
+
+  const Slice& s = Slices.front();
+  if (r == 0) return Data[s.cols+c-1];
+  if (c == 0) return Data[s.rows+r-1];
+  return Data[s.values+(r-1)*nCols+c-1];
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Returns the index i in [1, n-1] of the upper breakpoint of the interval that
+// brackets 'key' i.e. the lowest i such that bp[i] is not lower than 'key', or
+// n-1 if all the breakpoints are lower than 'key'.
+//
+// The interval found by the previous call is checked first as the lookup keys
+// generally move slowly from one time step to the next. Otherwise a branchless
+// binary search is made, the algorithm is then O(log n). The result is the same
+// as the linear search that was used previously, including for NaN keys.
+
+static inline unsigned int FindBracket(const double* bp, unsigned int n,
+                                       double key, unsigned int& last)
+{
+  unsigned int i = last;
+
+  if ((i == 1 || bp[i-1] < key) && (i == n-1 || !(bp[i] < key)))
+    return i;
+
+  unsigned int first = 1, len = n - 1;
+
+  while (len > 1) {
+    unsigned int half = len / 2;
+    first = bp[first+half-1] < key ? first + half : first;
+    len -= half;
   }
-  assert(Data.size() == (nCols+1)*(nRows+1));
-  return Data[r*(nCols+1)+c];
+
+  last = first;
+  return first;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -465,83 +546,128 @@ double FGTable::GetValue(void) const
 {
   assert(!internal);
 
+  double keys[3];
+  unsigned int n = Type + 1;
+
+  for (unsigned int i=0; i<n; ++i) {
+    assert(lookupProperty[i]);
+    keys[i] = lookupProperty[i]->getDoubleValue();
+  }
+
+  // The keys are compared bitwise so that NaN keys and signed zeros are not
+  // mistaken for the previous keys.
+  if (lastValid && memcmp(keys, lastKeys, n*sizeof(double)) == 0)
+    return lastValue;
+
   switch (Type) {
   case tt1D:
-    assert(lookupProperty[eRow]);
-    return GetValue(lookupProperty[eRow]->getDoubleValue());
+    lastValue = GetValue(keys[eRow]);
+    break;
   case tt2D:
-    assert(lookupProperty[eRow]);
-    assert(lookupProperty[eColumn]);
-    return GetValue(lookupProperty[eRow]->getDoubleValue(),
-                    lookupProperty[eColumn]->getDoubleValue());
+    lastValue = GetValue(keys[eRow], keys[eColumn]);
+    break;
   case tt3D:
-    assert(lookupProperty[eRow]);
-    assert(lookupProperty[eColumn]);
-    assert(lookupProperty[eTable]);
-    return GetValue(lookupProperty[eRow]->getDoubleValue(),
-                    lookupProperty[eColumn]->getDoubleValue(),
-                    lookupProperty[eTable]->getDoubleValue());
+    lastValue = GetValue(keys[eRow], keys[eColumn], keys[eTable]);
+    break;
   default:
     assert(false); // Should never be called
     return std::numeric_limits<double>::quiet_NaN();
   }
+
+  memcpy(lastKeys, keys, n*sizeof(double));
+  lastValid = true;
+  return lastValue;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGTable::GetInputs(vector<FGPropertyNode*>& inputs) const
+{
+  if (internal) return false;
+
+  for (unsigned int i=0; i<=Type; ++i) {
+    if (!lookupProperty[i]->GetInputs(inputs))
+      return false;
+  }
+
+  return true;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 double FGTable::GetValue(double key) const
 {
-  assert(Data.size() == 2*nRows+2);
+  assert(Type != tt3D && nCols == 1);
+  assert(nFilled == Data.size());
+  return GetValue(Slices.front(), key);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double FGTable::GetValue(const Slice& s, double key) const
+{
+  const double* rows = &Data[s.rows];
+  const double* values = &Data[s.values];
+  unsigned int n = s.nRows;
+
   // If the key is off the end (or before the beginning) of the table, just
   // return the boundary-table value, do not extrapolate.
-  if (key <= Data[2])
-    return Data[3];
-  else if (key >= Data[2*nRows])
-    return Data[2*nRows+1];
+  if (key <= rows[0])
+    return values[0];
+  else if (key >= rows[n-1])
+    return values[n-1];
 
   // Search for the right breakpoint.
-  // This is a linear search, the algorithm is O(n).
-  unsigned int r = 2;
-  while (Data[2*r] < key) r++;
+  unsigned int r = FindBracket(rows, n, key, s.lastRow);
 
-  double x0 = Data[2*r-2];
-  double Span = Data[2*r] - x0;
+  double x0 = rows[r-1];
+  double Span = rows[r] - x0;
   assert(Span > 0.0);
   double Factor = (key - x0) / Span;
   assert(Factor >= 0.0 && Factor <= 1.0);
 
-  double y0 = Data[2*r-1];
-  return Factor*(Data[2*r+1] - y0) + y0;
+  double y0 = values[r-1];
+  return Factor*(values[r] - y0) + y0;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 double FGTable::GetValue(double rowKey, double colKey) const
 {
-  if (nCols == 1) return GetValue(rowKey);
+  assert(Type != tt3D);
+  assert(nFilled == Data.size());
+  return GetValue(Slices.front(), rowKey, colKey);
+}
 
-  assert(Data.size() == (nCols+1)*(nRows+1));
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-  unsigned int c = 2;
-  while(Data[c] < colKey && c < nCols) c++;
-  double x0 = Data[c-1];
-  double Span = Data[c] - x0;
+double FGTable::GetValue(const Slice& s, double rowKey, double colKey) const
+{
+  if (s.nCols == 1) return GetValue(s, rowKey);
+
+  const double* cols = &Data[s.cols];
+  const double* rows = &Data[s.rows];
+  const double* values = &Data[s.values];
+  unsigned int nc = s.nCols;
+
+  unsigned int c = FindBracket(cols, nc, colKey, s.lastCol);
+  double x0 = cols[c-1];
+  double Span = cols[c] - x0;
   assert(Span > 0.0);
   double cFactor = Constrain(0.0, (colKey - x0) / Span, 1.0);
 
-  if (nRows == 1) {
-    double y0 = Data[(nCols+1)+c-1];
-    return cFactor*(Data[(nCols+1)+c] - y0) + y0;
+  if (s.nRows == 1) {
+    double y0 = values[c-1];
+    return cFactor*(values[c] - y0) + y0;
   }
 
-  size_t r = 2;
-  while(Data[r*(nCols+1)] < rowKey && r < nRows) r++;
-  x0 = Data[(r-1)*(nCols+1)];
-  Span = Data[r*(nCols+1)] - x0;
+  size_t r = FindBracket(rows, s.nRows, rowKey, s.lastRow);
+  x0 = rows[r-1];
+  Span = rows[r] - x0;
   assert(Span > 0.0);
   double rFactor = Constrain(0.0, (rowKey - x0) / Span, 1.0);
-  double col1temp = rFactor*Data[r*(nCols+1)+c-1]+(1.0-rFactor)*Data[(r-1)*(nCols+1)+c-1];
-  double col2temp = rFactor*Data[r*(nCols+1)+c]+(1.0-rFactor)*Data[(r-1)*(nCols+1)+c];
+  double col1temp = rFactor*values[r*nc+c-1]+(1.0-rFactor)*values[(r-1)*nc+c-1];
+  double col2temp = rFactor*values[r*nc+c]+(1.0-rFactor)*values[(r-1)*nc+c];
 
   return cFactor*(col2temp-col1temp)+col1temp;
 }
@@ -550,18 +676,17 @@ double FGTable::GetValue(double rowKey, double colKey) const
 
 double FGTable::GetValue(double rowKey, double colKey, double tableKey) const
 {
-  assert(Data.size() == nRows+1);
+  assert(Type == tt3D);
+  assert(Slices.size() == nRows);
   // If the key is off the end (or before the beginning) of the table, just
   // return the boundary-table value, do not extrapolate.
-  if(tableKey <= Data[1])
-    return Tables[0]->GetValue(rowKey, colKey);
-  else if (tableKey >= Data[nRows])
-    return Tables[nRows-1]->GetValue(rowKey, colKey);
+  if(tableKey <= Data[0])
+    return GetValue(Slices[0], rowKey, colKey);
+  else if (tableKey >= Data[nRows-1])
+    return GetValue(Slices[nRows-1], rowKey, colKey);
 
   // Search for the right breakpoint.
-  // This is a linear search, the algorithm is O(n).
-  unsigned int r = 2;
-  while (Data[r] < tableKey) r++;
+  unsigned int r = FindBracket(Data.data(), nRows, tableKey, lastTable);
 
   double x0 = Data[r-1];
   double Span = Data[r] - x0;
@@ -569,8 +694,225 @@ double FGTable::GetValue(double rowKey, double colKey, double tableKey) const
   double Factor = (tableKey - x0) / Span;
   assert(Factor >= 0.0 && Factor <= 1.0);
 
-  double y0 = Tables[r-2]->GetValue(rowKey, colKey);
-  return Factor*(Tables[r-1]->GetValue(rowKey, colKey) - y0) + y0;
+  double y0 = GetValue(Slices[r-1], rowKey, colKey);
+  return Factor*(GetValue(Slices[r], rowKey, colKey) - y0) + y0;
+}
+
+#ifdef FGTABLE_AVX2
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// AVX2 versions of the lookups for the batch evaluation. They process 4 keys at
+// a time and perform exactly the same floating point operations as the scalar
+// versions so that the results are identical. The code is compiled for AVX2
+// regardless of the compiler flags and is only called when the CPU supports it.
+
+static bool HasAVX2(void)
+{
+  static const bool avx2 = __builtin_cpu_supports("avx2");
+  return avx2;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Vectorized version of FindBracket() without the interval caching. The number
+// of iterations of the branchless binary search only depends on n so the 4
+// lanes progress together. Requires n >= 2.
+
+__attribute__((target("avx2")))
+static inline __m256i FindBracket4(const double* bp, unsigned int n, __m256d key)
+{
+  __m256i first = _mm256_set1_epi64x(1);
+  unsigned int len = n - 1;
+
+  while (len > 1) {
+    unsigned int half = len / 2;
+    __m256i i = _mm256_add_epi64(first, _mm256_set1_epi64x(half-1));
+    __m256d b = _mm256_i64gather_pd(bp, i, 8);
+    __m256i lower = _mm256_castpd_si256(_mm256_cmp_pd(b, key, _CMP_LT_OQ));
+    first = _mm256_add_epi64(first, _mm256_and_si256(lower, _mm256_set1_epi64x(half)));
+    len -= half;
+  }
+
+  return first;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+__attribute__((target("avx2")))
+static inline __m256d Constrain4(__m256d x)
+{
+  // Same as FGJSBBase::Constrain(0.0, x, 1.0), including for NaNs.
+  const __m256d zero = _mm256_setzero_pd(), one = _mm256_set1_pd(1.0);
+  x = _mm256_blendv_pd(x, zero, _mm256_cmp_pd(x, zero, _CMP_LT_OQ));
+  return _mm256_blendv_pd(x, one, _mm256_cmp_pd(x, one, _CMP_GT_OQ));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// 1D lookups of the 4*(n/4) first keys. Returns the number of keys processed.
+
+__attribute__((target("avx2")))
+static size_t GetValues1D_AVX2(const double* rows, const double* values,
+                               unsigned int nRows, const double* keys,
+                               double* results, size_t n)
+{
+  const __m256i one = _mm256_set1_epi64x(1);
+  const __m256d firstRow = _mm256_set1_pd(rows[0]);
+  const __m256d lastRow = _mm256_set1_pd(rows[nRows-1]);
+  const __m256d firstValue = _mm256_set1_pd(values[0]);
+  const __m256d lastValue = _mm256_set1_pd(values[nRows-1]);
+  size_t i = 0;
+
+  for (; i+4 <= n; i += 4) {
+    __m256d key = _mm256_loadu_pd(keys+i);
+    __m256d below = _mm256_cmp_pd(key, firstRow, _CMP_LE_OQ);
+    __m256d above = _mm256_cmp_pd(key, lastRow, _CMP_GE_OQ);
+    __m256i r = FindBracket4(rows, nRows, key);
+    __m256i r0 = _mm256_sub_epi64(r, one);
+    __m256d x0 = _mm256_i64gather_pd(rows, r0, 8);
+    __m256d x1 = _mm256_i64gather_pd(rows, r, 8);
+    __m256d y0 = _mm256_i64gather_pd(values, r0, 8);
+    __m256d y1 = _mm256_i64gather_pd(values, r, 8);
+    // The keys off the table are replaced so that no spurious floating point
+    // exception is raised by the interpolation of the lanes that are discarded.
+    key = _mm256_blendv_pd(key, x0, _mm256_or_pd(below, above));
+    __m256d Factor = _mm256_div_pd(_mm256_sub_pd(key, x0), _mm256_sub_pd(x1, x0));
+    __m256d y = _mm256_add_pd(_mm256_mul_pd(Factor, _mm256_sub_pd(y1, y0)), y0);
+    y = _mm256_blendv_pd(y, lastValue, above);
+    y = _mm256_blendv_pd(y, firstValue, below);
+    _mm256_storeu_pd(results+i, y);
+  }
+
+  return i;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// 2D lookups of the 4*(n/4) first keys. Requires nRows >= 2 and nCols >= 2.
+// Returns the number of keys processed.
+
+__attribute__((target("avx2")))
+static size_t GetValues2D_AVX2(const double* cols, const double* rows,
+                               const double* values, unsigned int nRows,
+                               unsigned int nCols, const double* rowKeys,
+                               const double* colKeys, double* results, size_t n)
+{
+  const __m256i one = _mm256_set1_epi64x(1);
+  const __m256i stride = _mm256_set1_epi64x(nCols);
+  const __m256d unity = _mm256_set1_pd(1.0);
+  size_t i = 0;
+
+  for (; i+4 <= n; i += 4) {
+    __m256d colKey = _mm256_loadu_pd(colKeys+i);
+    __m256i c = FindBracket4(cols, nCols, colKey);
+    __m256i c0 = _mm256_sub_epi64(c, one);
+    __m256d x0 = _mm256_i64gather_pd(cols, c0, 8);
+    __m256d Span = _mm256_sub_pd(_mm256_i64gather_pd(cols, c, 8), x0);
+    __m256d cFactor = Constrain4(_mm256_div_pd(_mm256_sub_pd(colKey, x0), Span));
+
+    __m256d rowKey = _mm256_loadu_pd(rowKeys+i);
+    __m256i r = FindBracket4(rows, nRows, rowKey);
+    x0 = _mm256_i64gather_pd(rows, _mm256_sub_epi64(r, one), 8);
+    Span = _mm256_sub_pd(_mm256_i64gather_pd(rows, r, 8), x0);
+    __m256d rFactor = Constrain4(_mm256_div_pd(_mm256_sub_pd(rowKey, x0), Span));
+
+    __m256i i1 = _mm256_add_epi64(_mm256_mul_epu32(r, stride), c0);
+    __m256i i0 = _mm256_sub_epi64(i1, stride);
+    __m256d rFactor0 = _mm256_sub_pd(unity, rFactor);
+    __m256d col1temp = _mm256_add_pd(
+                      _mm256_mul_pd(rFactor, _mm256_i64gather_pd(values, i1, 8)),
+                      _mm256_mul_pd(rFactor0, _mm256_i64gather_pd(values, i0, 8)));
+    i1 = _mm256_add_epi64(i1, one);
+    i0 = _mm256_add_epi64(i0, one);
+    __m256d col2temp = _mm256_add_pd(
+                      _mm256_mul_pd(rFactor, _mm256_i64gather_pd(values, i1, 8)),
+                      _mm256_mul_pd(rFactor0, _mm256_i64gather_pd(values, i0, 8)));
+    __m256d y = _mm256_add_pd(_mm256_mul_pd(cFactor,
+                                            _mm256_sub_pd(col2temp, col1temp)),
+                              col1temp);
+    _mm256_storeu_pd(results+i, y);
+  }
+
+  return i;
+}
+#endif
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTable::GetValues(const double* keys, double* results, size_t n) const
+{
+  assert(Type != tt3D && nCols == 1);
+  assert(nFilled == Data.size());
+  const Slice& s = Slices.front();
+  size_t i = 0;
+
+#ifdef FGTABLE_AVX2
+  if (s.nRows >= 2 && HasAVX2())
+    i = GetValues1D_AVX2(&Data[s.rows], &Data[s.values], s.nRows, keys,
+                         results, n);
+#endif
+
+  for (; i<n; ++i)
+    results[i] = GetValue(s, keys[i]);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTable::GetValues(const double* rowKeys, const double* colKeys,
+                        double* results, size_t n) const
+{
+  assert(Type != tt3D);
+  assert(nFilled == Data.size());
+  const Slice& s = Slices.front();
+
+  if (s.nCols == 1) {
+    GetValues(rowKeys, results, n);
+    return;
+  }
+
+  size_t i = 0;
+
+#ifdef FGTABLE_AVX2
+  if (s.nRows >= 2 && HasAVX2())
+    i = GetValues2D_AVX2(&Data[s.cols], &Data[s.rows], &Data[s.values],
+                         s.nRows, s.nCols, rowKeys, colKeys, results, n);
+#endif
+
+  for (; i<n; ++i)
+    results[i] = GetValue(s, rowKeys[i], colKeys[i]);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The keys of a batch generally span several slices of the table so 3D tables
+// are evaluated one key at a time.
+
+void FGTable::GetValues(const double* rowKeys, const double* colKeys,
+                        const double* tableKeys, double* results,
+                        size_t n) const
+{
+  for (size_t i=0; i<n; ++i)
+    results[i] = GetValue(rowKeys[i], colKeys[i], tableKeys[i]);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Returns the address in Data of the next element to be input with operator<<
+// or nullptr if the table is already populated. The elements are input in the
+// same order as in the <tableData> element.
+
+double* FGTable::NextElement(void)
+{
+  assert(Type != tt3D);
+  const Slice& s = Slices.front();
+  size_t n = nFilled++;
+
+  lastValid = false;
+
+  if (n >= Data.size()) return nullptr;
+
+  if (Type == tt2D) {
+    if (n < nCols) return &Data[s.cols+n];
+    n -= nCols;
+  }
+
+  size_t r = n / (nCols+1), c = n % (nCols+1);
+  if (c == 0) return &Data[s.rows+r];
+  return &Data[s.values+r*nCols+c-1];
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -580,9 +922,12 @@ void FGTable::operator<<(istream& in_stream)
   double x;
   assert(Type != tt3D);
 
+  // Extra elements are counted but not stored, so that the caller can report
+  // the discrepancy.
   in_stream >> x;
   while(in_stream) {
-    Data.push_back(x);
+    double* element = NextElement();
+    if (element) *element = x;
     in_stream >> x;
   }
 }
@@ -592,19 +937,28 @@ void FGTable::operator<<(istream& in_stream)
 FGTable& FGTable::operator<<(const double x)
 {
   assert(Type != tt3D);
-  Data.push_back(x);
+  double* element = NextElement();
+
+  if (!element) {
+    --nFilled;
+    throw BaseException("FGTable: the table is already populated");
+  }
+
+  *element = x;
+
+  const Slice& s = Slices.front();
+  const double* cols = &Data[s.cols];
+  const double* rows = &Data[s.rows];
 
   // Check column is monotically increasing
-  size_t n = Data.size();
-  if (Type == tt2D && nCols > 1 && n >= 3 && n <= nCols+1) {
-    if (Data.at(n-1) <= Data.at(n-2))
+  if (Type == tt2D && element > cols && element < cols+nCols) {
+    if (*element <= *(element-1))
       throw BaseException("FGTable: column lookup is not monotonically increasing");
   }
 
   // Check row is monotically increasing
-  size_t row = (n-1) / (nCols+1);
-  if (row >=2 && row*(nCols+1) == n-1) {
-    if (Data.at(row*(nCols+1)) <= Data.at((row-1)*(nCols+1)))
+  if (element > rows && element < rows+nRows) {
+    if (*element <= *(element-1))
       throw BaseException("FGTable: row lookup is not monotonically increasing");
   }
 
@@ -618,46 +972,41 @@ void FGTable::Print(void)
   ios::fmtflags flags = cout.setf(ios::fixed); // set up output stream
   cout.precision(4);
 
-  switch(Type) {
-    case tt1D:
-      cout << "    1 dimensional table with " << nRows << " rows." << endl;
-      break;
-    case tt2D:
-      cout << "    2 dimensional table with " << nRows << " rows, " << nCols << " columns." << endl;
-      break;
-    case tt3D:
-      cout << "    3 dimensional table with " << nRows << " breakpoints, "
-                                          << Tables.size() << " tables." << endl;
-      break;
+  if (Type == tt3D) {
+    cout << "    3 dimensional table with " << nRows << " breakpoints, "
+                                        << Slices.size() << " tables." << endl;
+    for (unsigned int r=0; r<nRows; r++) {
+      cout << "\t" << Data[r] << "\t" << endl;
+      PrintSlice(Slices[r], tt2D);
+      cout << endl;
+    }
   }
-  unsigned int startCol=1, startRow=1;
-  unsigned int p = 1;
+  else
+    PrintSlice(Slices.front(), Type);
 
-  if (Type == tt1D) {
-    startCol = 0;
-    p = 2;
-  }
-  if (Type == tt2D) startRow = 0;
+  cout.setf(flags); // reset
+}
 
-  for (unsigned int r=startRow; r<=nRows; r++) {
-    cout << "\t";
-    if (Type == tt2D) {
-      if (r == startRow)
-        cout << "\t";
-      else
-        startCol = 0;
-    }
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-    for (unsigned int c=startCol; c<=nCols; c++) {
-      cout << Data[p++] << "\t";
-      if (Type == tt3D) {
-        cout << endl;
-        Tables[r-1]->Print();
-      }
-    }
+void FGTable::PrintSlice(const Slice& s, type t) const
+{
+  if (t == tt1D)
+    cout << "    1 dimensional table with " << s.nRows << " rows." << endl;
+  else {
+    cout << "    2 dimensional table with " << s.nRows << " rows, " << s.nCols << " columns." << endl;
+    cout << "\t\t";
+    for (unsigned int c=0; c<s.nCols; c++)
+      cout << Data[s.cols+c] << "\t";
+    cout << endl;
+  }
+
+  for (unsigned int r=0; r<s.nRows; r++) {
+    cout << "\t" << Data[s.rows+r] << "\t";
+    for (unsigned int c=0; c<s.nCols; c++)
+      cout << Data[s.values+r*s.nCols+c] << "\t";
     cout << endl;
   }
-  cout.setf(flags); // reset
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -254,6 +254,24 @@ public:
   double GetValue(double key) const;
   double GetValue(double rowKey, double colKey) const;
   double GetValue(double rowKey, double colKey, double TableKey) const;
+  /** Evaluate a 1D table for a batch of lookup keys.
+      This gives the same results as calling GetValue(keys[i]) for each key,
+      bit for bit, but without a function call per key. When the CPU supports
+      AVX2 instructions, the breakpoint search and the interpolation are
+      processed 4 keys at a time.
+      @param keys array of n lookup keys
+      @param results array where the n results are written
+      @param n number of lookups */
+  void GetValues(const double* keys, double* results, size_t n) const;
+  /** Evaluate a 2D table for a batch of lookup keys.
+      @see GetValues(const double*, double*, size_t) const */
+  void GetValues(const double* rowKeys, const double* colKeys, double* results,
+                 size_t n) const;
+  /** Evaluate a 3D table for a batch of lookup keys.
+      @see GetValues(const double*, double*, size_t) const */
+  void GetValues(const double* rowKeys, const double* colKeys,
+                 const double* tableKeys, double* results, size_t n) const;
+  bool GetInputs(std::vector<FGPropertyNode*>& inputs) const override;
   /** Read the table in.
       Data in the config file should be in matrix format with the row
       independents as the first column and the column independents in
@@ -300,10 +318,38 @@ private:
   bool internal = false;
   std::shared_ptr<FGPropertyManager> PropertyManager; // Property root used to do late binding.
   FGPropertyValue_ptr lookupProperty[3];
+  /* A 2D table (or a 1D table, which has a single column and no column
+     breakpoint) stored in Data. The column breakpoints, the row breakpoints and
+     the values (in row-major order) are each stored contiguously so that the
+     breakpoint searches only touch the breakpoints. A 3D table is made of one
+     slice per breakpoint of its table axis. */
+  struct Slice {
+    unsigned int nRows, nCols;
+    size_t cols, rows, values; // Offsets in Data
+    // Breakpoint intervals found by the last lookup. Lookup keys usually vary
+    // slowly from one call to the next so the search is started from there.
+    mutable unsigned int lastRow = 1, lastCol = 1;
+  };
+  /* All the breakpoints and values of the table are stored in a single
+     allocation. For a 3D table, the table breakpoints come first, followed by
+     the column and row breakpoints of each slice, and then the values of all
+     the slices in a single block. */
   std::vector<double> Data;
-  std::vector<std::unique_ptr<FGTable>> Tables;
+  std::vector<Slice> Slices;
   unsigned int nRows, nCols;
+  size_t nFilled = 0; // Number of elements input with operator<<
+  mutable unsigned int lastTable = 1;
+  // Lookup keys and result of the last call to GetValue(void). The result is
+  // reused when the lookup properties have not changed since.
+  mutable double lastKeys[3];
+  mutable double lastValue;
+  mutable bool lastValid = false;
   std::string Name;
+  void Allocate(void);
+  double* NextElement(void);
+  double GetValue(const Slice& s, double key) const;
+  double GetValue(const Slice& s, double rowKey, double colKey) const;
+  void PrintSlice(const Slice& s, type t) const;
   void bind(Element* el, const std::string& Prefix);
   void missingData(Element *el, unsigned int expected_size, size_t actual_size);
   void Debug(int from);
@@ -54,6 +54,9 @@ FGTemplateFunc::FGTemplateFunc(FGFDMExec* fdmex, Element* element)
   Load(element, var, fdmex);
   CheckMinArguments(element, 1);
   CheckMaxArguments(element, 1);
+  Compile();
+  // The property read by var changes with each call to GetValue(node).
+  memo = Memo::Off;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
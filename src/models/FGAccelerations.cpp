@@ -55,6 +55,7 @@ INCLUDES
 
 #include "FGAccelerations.h"
 #include "FGFDMExec.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -240,8 +241,8 @@ void FGAccelerations::CalculateFrictionForces(double dt)
   // If no gears are in contact with the ground then return
   if (!n) return;
 
-  vector<double> a(n*n); // Will contain Jac*M^-1*Jac^T
-  vector<double> rhs(n);
+  a.assign(n*n, 0.0); // Will contain Jac*M^-1*Jac^T
+  rhs.assign(n, 0.0);
 
   // Assemble the linear system of equations
   for (unsigned int i=0; i < n; i++) {
@@ -388,6 +389,21 @@ void FGAccelerations::bind(void)
   PropertyManager->Tie("forces/fbz-gear-lbs", this, eZ, (PMF)&FGAccelerations::GetGroundForces);
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGAccelerations::SyncState(FGSnapshot& snapshot)
+{
+  FGModel::SyncState(snapshot);
+  snapshot.Sync(vPQRdot);
+  snapshot.Sync(vPQRidot);
+  snapshot.Sync(vUVWdot);
+  snapshot.Sync(vUVWidot);
+  snapshot.Sync(vBodyAccel);
+  snapshot.Sync(vFrictionForces);
+  snapshot.Sync(vFrictionMoments);
+  snapshot.Sync(gravTorque);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -114,6 +114,7 @@ public:
                      "Resume" command to be given.
       @return false if no error */
   bool Run(bool Holding) override;
+  void SyncState(FGSnapshot& snapshot) override;
 
   /** Retrieves the body axis acceleration.
       Retrieves the computed body axis accelerations based on the
@@ -367,6 +368,10 @@ private:
   FGColumnVector3 vBodyAccel;
   FGColumnVector3 vFrictionForces;
   FGColumnVector3 vFrictionMoments;
+  // Linear system solved by CalculateFrictionForces(). The storage is kept
+  // between time steps so that it is only allocated when the number of
+  // contacts grows.
+  std::vector<double> a, rhs;
 
   bool gravTorque;
 
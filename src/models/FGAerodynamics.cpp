@@ -37,7 +37,9 @@ INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 #include "FGAerodynamics.h"
+#include "FGFDMExec.h"
 #include "input_output/FGXMLElement.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -182,6 +184,11 @@ bool FGAerodynamics::Run(bool Holding)
 
   BuildStabilityTransformMatrices();
 
+  // The properties read by the aero functions do not change while they are
+  // evaluated so their common sub-expressions can be evaluated only once.
+  auto SharedExpressions = FDMExec->GetSharedExpressions();
+  SharedExpressions->BeginPass();
+
   for (axis_ctr = 0; axis_ctr < 3; ++axis_ctr) {
     AeroFunctionArray::iterator f;
 
@@ -202,6 +209,8 @@ bool FGAerodynamics::Run(bool Holding)
     }
   }
 
+  SharedExpressions->EndPass();
+
   switch (forceAxisType) {
   case atBodyXYZ:       // Forces already in body axes; no manipulation needed
     vForces = vFnative;
@@ -250,6 +259,9 @@ bool FGAerodynamics::Run(bool Holding)
 
   vMomentsMRC.InitMatrix();
 
+  // The forces have been updated in the meantime so a new pass is started.
+  SharedExpressions->BeginPass();
+
   for (axis_ctr = 0; axis_ctr < 3; axis_ctr++) {
     AeroFunctionArray* array = &AeroFunctions[axis_ctr+3];
     for (AeroFunctionArray::iterator f=array->begin(); f != array->end(); ++f) {
@@ -262,6 +274,8 @@ bool FGAerodynamics::Run(bool Holding)
     }
   }
 
+  SharedExpressions->EndPass();
+
   // Transform moments to bodyXYZ if the moments are specified in stability or
   // wind axes
   vMomentsMRCBodyXYZ.InitMatrix();
@@ -577,24 +591,24 @@ string FGAerodynamics::GetAeroFunctionValues(const string& delimeter) const
 {
   ostringstream buf;
 
-  for (unsigned int axis = 0; axis < 6; axis++) {
-    for (unsigned int sd = 0; sd < AeroFunctions[axis].size(); sd++) {
-      if (buf.tellp() > 0) buf << delimeter;
-      buf << AeroFunctions[axis][sd]->GetValue();
-    }
-  }
+  GetAeroFunctionValues(buf, delimeter);
 
-  string FunctionValues = FGModelFunctions::GetFunctionValues(delimeter);
+  // Remove the delimiter that precedes the first value.
+  string values = buf.str();
+  return values.empty() ? values : values.substr(delimeter.size());
+}
 
-  if (!FunctionValues.empty()) {
-    if (!buf.str().empty()) {
-      buf << delimeter << FunctionValues;
-    } else {
-      buf << FunctionValues;
-    }
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGAerodynamics::GetAeroFunctionValues(ostream& out,
+                                           const string& delimeter) const
+{
+  for (unsigned int axis = 0; axis < 6; axis++) {
+    for (unsigned int sd = 0; sd < AeroFunctions[axis].size(); sd++)
+      out << delimeter << AeroFunctions[axis][sd]->GetValue();
   }
 
-  return buf.str();
+  FGModelFunctions::GetFunctionValues(out, delimeter);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -671,6 +685,51 @@ void FGAerodynamics::BuildStabilityTransformMatrices(void)
   Tb2s = Ts2b.Transposed();
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGAerodynamics::SyncState(FGSnapshot& snapshot)
+{
+  FGModel::SyncState(snapshot);
+  snapshot.Sync(in.Alpha);
+  snapshot.Sync(in.Beta);
+  snapshot.Sync(in.Vt);
+  snapshot.Sync(in.Qbar);
+  snapshot.Sync(in.RPBody);
+  snapshot.Sync(in.Tb2w);
+  snapshot.Sync(in.Tw2b);
+  snapshot.Sync(Ts2b);
+  snapshot.Sync(Tb2s);
+  snapshot.Sync(vFnative);
+  snapshot.Sync(vFw);
+  snapshot.Sync(vForces);
+  snapshot.Sync(vFnativeAtCG);
+  snapshot.Sync(vForcesAtCG);
+  snapshot.Sync(vMoments);
+  snapshot.Sync(vMomentsMRC);
+  snapshot.Sync(vMomentsMRCBodyXYZ);
+  snapshot.Sync(vDXYZcg);
+  snapshot.Sync(vDeltaRP);
+  snapshot.Sync(alphaclmax);
+  snapshot.Sync(alphaclmin);
+  snapshot.Sync(alphahystmax);
+  snapshot.Sync(alphahystmin);
+  snapshot.Sync(impending_stall);
+  snapshot.Sync(stall_hyst);
+  snapshot.Sync(bi2vel);
+  snapshot.Sync(ci2vel);
+  snapshot.Sync(alphaw);
+  snapshot.Sync(clsq);
+  snapshot.Sync(lod);
+  snapshot.Sync(qbar_area);
+
+  for (unsigned int axis=0; axis<6; ++axis) {
+    for (auto f: AeroFunctions[axis])
+      f->SyncState(snapshot);
+    for (auto f: AeroFunctionsAtCG[axis])
+      f->SyncState(snapshot);
+  }
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -130,6 +130,7 @@ public:
                      "Resume" command to be given.
       @return false if no error */
   bool Run(bool Holding) override;
+  void SyncState(FGSnapshot& snapshot) override;
 
   /** Loads the Aerodynamics model.
       The Load function for this class expects the XML parser to
@@ -233,6 +234,12 @@ public:
       aero functions */
   std::string GetAeroFunctionValues(const std::string& delimeter) const;
 
+  /** Writes the aero function values to a stream.
+      @param out the output stream
+      @param delimeter either a tab or comma string depending on output type.
+             It is written before each value. */
+  void GetAeroFunctionValues(std::ostream& out, const std::string& delimeter) const;
+
   std::vector <FGFunction*> * GetAeroFunctions(void) const { return AeroFunctions; }
 
   struct Inputs {
@@ -40,6 +40,7 @@ INCLUDES
 
 #include "FGAircraft.h"
 #include "input_output/FGXMLElement.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -197,6 +198,19 @@ void FGAircraft::bind(void)
   PropertyManager->Tie("metrics/visualrefpoint-z-in", this, eZ, (PMF)&FGAircraft::GetXYZvrp);
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGAircraft::SyncState(FGSnapshot& snapshot)
+{
+  FGModel::SyncState(snapshot);
+  snapshot.Sync(vMoments);
+  snapshot.Sync(vForces);
+  snapshot.Sync(vXYZrp);
+  snapshot.Sync(vXYZvrp);
+  snapshot.Sync(vXYZep);
+  snapshot.Sync(vDXYZcg);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
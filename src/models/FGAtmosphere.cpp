@@ -44,6 +44,7 @@ INCLUDES
 
 #include "FGFDMExec.h"
 #include "FGAtmosphere.h"
+#include "input_output/FGSnapshot.h"
 
 namespace JSBSim {
 
@@ -53,9 +54,7 @@ CLASS IMPLEMENTATION
 
 // Atmosphere constants in British units converted from the SI values specified in the 
 // ISA document - https://ntrs.nasa.gov/archive/nasa/casi.ntrs.nasa.gov/19770009539.pdf
-double FGAtmosphere::Reng = Rstar / Mair;
-
-const double FGAtmosphere::StdDaySLsoundspeed = sqrt(SHRatio*Reng*StdDaySLtemperature);
+const double FGAtmosphere::StdDaySLsoundspeed = sqrt(SHRatio*(Rstar/Mair)*StdDaySLtemperature);
 
 FGAtmosphere::FGAtmosphere(FGFDMExec* fdmex) : FGModel(fdmex),
                                                PressureAltitude(0.0),      // ft
@@ -106,21 +105,29 @@ bool FGAtmosphere::Run(bool Holding)
 
 void FGAtmosphere::Calculate(double altitude)
 {
-  FGPropertyNode* node = PropertyManager->GetNode();
-  if (!PropertyManager->HasNode("atmosphere/override/temperature"))
+  // The override nodes are looked up child by child rather than by their path
+  // so that no memory is allocated at each time step.
+  const SGPropertyNode* root = PropertyManager->GetNode();
+  const SGPropertyNode* overrides = root->getChild("atmosphere");
+  if (overrides) overrides = overrides->getChild("override");
+
+  const SGPropertyNode* node = overrides ? overrides->getChild("temperature") : nullptr;
+  if (!node)
     Temperature = GetTemperature(altitude);
   else
-    Temperature = node->GetDouble("atmosphere/override/temperature");
+    Temperature = node->getDoubleValue();
 
-  if (!PropertyManager->HasNode("atmosphere/override/pressure"))
+  node = overrides ? overrides->getChild("pressure") : nullptr;
+  if (!node)
     Pressure = GetPressure(altitude);
   else
-    Pressure = node->GetDouble("atmosphere/override/pressure");
+    Pressure = node->getDoubleValue();
 
-  if (!PropertyManager->HasNode("atmosphere/override/density"))
+  node = overrides ? overrides->getChild("density") : nullptr;
+  if (!node)
     Density = GetDensity(altitude);
   else
-    Density = node->GetDouble("atmosphere/override/density");
+    Density = node->getDoubleValue();
 
   Soundspeed  = sqrt(SHRatio*Reng*Temperature);
   PressureAltitude = CalculatePressureAltitude(Pressure, altitude);
@@ -285,6 +292,25 @@ void FGAtmosphere::bind(void)
   PropertyManager->Tie("atmosphere/pressure-altitude", this, &FGAtmosphere::GetPressureAltitude);
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGAtmosphere::SyncState(FGSnapshot& snapshot)
+{
+  FGModel::SyncState(snapshot);
+  snapshot.Sync(SLtemperature);
+  snapshot.Sync(SLdensity);
+  snapshot.Sync(SLpressure);
+  snapshot.Sync(SLsoundspeed);
+  snapshot.Sync(Temperature);
+  snapshot.Sync(Density);
+  snapshot.Sync(Pressure);
+  snapshot.Sync(Soundspeed);
+  snapshot.Sync(PressureAltitude);
+  snapshot.Sync(DensityAltitude);
+  snapshot.Sync(Viscosity);
+  snapshot.Sync(KinematicViscosity);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
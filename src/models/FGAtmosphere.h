@@ -96,6 +96,7 @@ public:
                      "Resume" command to be given.
       @return false if no error */
   bool Run(bool Holding) override;
+  void SyncState(FGSnapshot& snapshot) override;
 
   bool InitModel(void) override;
 
@@ -266,8 +267,10 @@ protected:
       value is fixed whichever gravity model is used by FGInertial.
   */
   static constexpr double g0 = 9.80665 / fttom;
-  /// Specific gas constant for air - ft*lbf/slug/R
-  static double Reng;
+  /** Specific gas constant for air - ft*lbf/slug/R.
+      It is a member rather than a constant because the humidity and the Mars
+      models modify it for their own instance. */
+  double Reng = Rstar / Mair;
   //@}
 
   static constexpr double SHRatio = 1.4;
@@ -47,6 +47,7 @@ INCLUDES
 #include "FGFDMExec.h"
 #include "input_output/FGPropertyManager.h"
 #include "FGInertial.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -374,6 +375,81 @@ double FGAuxiliary::BadUnits(void) const
   cerr << "Bad units" << endl; return 0.0;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGAuxiliary::SyncState(FGSnapshot& snapshot)
+{
+  FGModel::SyncState(snapshot);
+  snapshot.Sync(vcas);
+  snapshot.Sync(veas);
+  snapshot.Sync(pt);
+  snapshot.Sync(tat);
+  snapshot.Sync(tatc);
+  snapshot.Sync(mTw2b);
+  snapshot.Sync(mTb2w);
+  snapshot.Sync(vPilotAccel);
+  snapshot.Sync(vPilotAccelN);
+  snapshot.Sync(vNcg);
+  snapshot.Sync(vNwcg);
+  snapshot.Sync(vAeroPQR);
+  snapshot.Sync(vAeroUVW);
+  snapshot.Sync(vEulerRates);
+  snapshot.Sync(vMachUVW);
+  snapshot.Sync(vLocationVRP);
+  snapshot.Sync(Vt);
+  snapshot.Sync(Vground);
+  snapshot.Sync(Mach);
+  snapshot.Sync(MachU);
+  snapshot.Sync(qbar);
+  snapshot.Sync(qbarUW);
+  snapshot.Sync(qbarUV);
+  snapshot.Sync(Re);
+  snapshot.Sync(alpha);
+  snapshot.Sync(beta);
+  snapshot.Sync(adot);
+  snapshot.Sync(bdot);
+  snapshot.Sync(psigt);
+  snapshot.Sync(gamma);
+  snapshot.Sync(Nx);
+  snapshot.Sync(Ny);
+  snapshot.Sync(Nz);
+  snapshot.Sync(seconds_in_day);
+  snapshot.Sync(day_of_year);
+  snapshot.Sync(hoverbcg);
+  snapshot.Sync(hoverbmac);
+
+  // Some of the properties are computed from the inputs.
+  snapshot.Sync(in.Pressure);
+  snapshot.Sync(in.Density);
+  snapshot.Sync(in.DensitySL);
+  snapshot.Sync(in.PressureSL);
+  snapshot.Sync(in.Temperature);
+  snapshot.Sync(in.SoundSpeed);
+  snapshot.Sync(in.KinematicViscosity);
+  snapshot.Sync(in.DistanceAGL);
+  snapshot.Sync(in.Mass);
+  snapshot.Sync(in.Tl2b);
+  snapshot.Sync(in.Tb2l);
+  snapshot.Sync(in.vPQR);
+  snapshot.Sync(in.vPQRi);
+  snapshot.Sync(in.vPQRidot);
+  snapshot.Sync(in.vUVW);
+  snapshot.Sync(in.vUVWdot);
+  snapshot.Sync(in.vVel);
+  snapshot.Sync(in.vBodyAccel);
+  snapshot.Sync(in.ToEyePt);
+  snapshot.Sync(in.RPBody);
+  snapshot.Sync(in.VRPBody);
+  snapshot.Sync(in.vFw);
+  snapshot.Sync(in.vLocation);
+  snapshot.Sync(in.CosTht);
+  snapshot.Sync(in.SinTht);
+  snapshot.Sync(in.CosPhi);
+  snapshot.Sync(in.SinPhi);
+  snapshot.Sync(in.TotalWindNED);
+  snapshot.Sync(in.TurbPQR);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -117,6 +117,7 @@ public:
                      on a socket for the "Resume" command to be given.  @return
                      false if no error */
   bool Run(bool Holding) override;
+  void SyncState(FGSnapshot& snapshot) override;
 
 // GET functions
 
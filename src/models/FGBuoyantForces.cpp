@@ -39,6 +39,7 @@ INCLUDES
 #include "FGFDMExec.h"
 #include "FGBuoyantForces.h"
 #include "input_output/FGXMLElement.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -256,6 +257,26 @@ void FGBuoyantForces::bind(void)
                        &FGBuoyantForces::GetForces, (PSF)nullptr);
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGBuoyantForces::SyncState(FGSnapshot& snapshot)
+{
+  FGModel::SyncState(snapshot);
+  snapshot.Sync(in.Pressure);
+  snapshot.Sync(in.Temperature);
+  snapshot.Sync(in.Density);
+  snapshot.Sync(in.gravity);
+  snapshot.Sync(vTotalForces);
+  snapshot.Sync(vTotalMoments);
+  snapshot.Sync(gasCellJ);
+  snapshot.Sync(vGasCellXYZ);
+  snapshot.Sync(vXYZgasCell_arm);
+
+  snapshot.Check(Cells.size());
+  for (auto cell: Cells)
+    cell->SyncState(snapshot);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -61,6 +61,7 @@ INCLUDES
 #include "models/flight_control/FGLinearActuator.h"
 
 #include "FGFCSChannel.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -736,22 +737,23 @@ string FGFCS::GetComponentValues(const string& delimiter) const
 {
   std::ostringstream buf;
 
-  bool firstime = true;
-  int total_count=0;
+  GetComponentValues(buf, delimiter);
 
+  // Remove the delimiter that precedes the first value.
+  string values = buf.str();
+  return values.empty() ? values : values.substr(delimiter.size());
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFCS::GetComponentValues(ostream& out, const string& delimiter) const
+{
   for (unsigned int i=0; i<SystemChannels.size(); i++)
   {
     for (unsigned int c=0; c<SystemChannels[i]->GetNumComponents(); c++)
-    {
-      if (firstime) firstime = false;
-      else          buf << delimiter;
-
-      buf << setprecision(9) << SystemChannels[i]->GetComponent(c)->GetOutput();
-      total_count++;
-    }
+      out << delimiter << setprecision(9)
+          << SystemChannels[i]->GetComponent(c)->GetOutput();
   }
-
-  return buf.str();
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -879,6 +881,48 @@ void FGFCS::bindThrottle(unsigned int num)
                                         &FGFCS::SetOperationMode);
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFCS::SyncState(FGSnapshot& snapshot)
+{
+  FGModel::SyncState(snapshot);
+  snapshot.Sync(DaCmd);
+  snapshot.Sync(DeCmd);
+  snapshot.Sync(DrCmd);
+  snapshot.Sync(DfCmd);
+  snapshot.Sync(DsbCmd);
+  snapshot.Sync(DspCmd);
+  snapshot.Sync(DePos);
+  snapshot.Sync(DaLPos);
+  snapshot.Sync(DaRPos);
+  snapshot.Sync(DrPos);
+  snapshot.Sync(DfPos);
+  snapshot.Sync(DsbPos);
+  snapshot.Sync(DspPos);
+  snapshot.Sync(PTrimCmd);
+  snapshot.Sync(YTrimCmd);
+  snapshot.Sync(RTrimCmd);
+  snapshot.Sync(ThrottleCmd);
+  snapshot.Sync(ThrottlePos);
+  snapshot.Sync(MixtureCmd);
+  snapshot.Sync(MixturePos);
+  snapshot.Sync(PropAdvanceCmd);
+  snapshot.Sync(PropAdvance);
+  snapshot.Sync(PropFeatherCmd);
+  snapshot.Sync(PropFeather);
+  snapshot.Sync(OperationModeCmd);
+  snapshot.Sync(OperationMode);
+  snapshot.Sync(BrakePos);
+  snapshot.Sync(GearCmd);
+  snapshot.Sync(GearPos);
+  snapshot.Sync(TailhookPos);
+  snapshot.Sync(WingFoldPos);
+
+  snapshot.Check(SystemChannels.size());
+  for (auto channel: SystemChannels)
+    channel->SyncState(snapshot);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
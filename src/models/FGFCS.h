@@ -205,6 +205,7 @@ public:
                      "Resume" command to be given.
       @return false if no error */
   bool Run(bool Holding) override;
+  void SyncState(FGSnapshot& snapshot) override;
 
   /// @name Pilot input command retrieval
   //@{
@@ -381,6 +382,12 @@ public:
       component outputs */
   std::string GetComponentValues(const std::string& delimiter) const;
 
+  /** Writes all component outputs to a stream.
+      @param out the output stream
+      @param delimiter either a tab or comma string depending on output type.
+             It is written before each value. */
+  void GetComponentValues(std::ostream& out, const std::string& delimiter) const;
+
   /// @name Pilot input command setting
   //@{
   /** Sets the aileron command
@@ -40,6 +40,8 @@ INCLUDES
 
 #include <iostream>
 
+#include "input_output/FGSnapshot.h"
+
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
@@ -137,6 +139,13 @@ public:
   }
   /// Get the channel rate
   int GetRate(void) const { return ExecRate; }
+  /// Saves or restores the state of the channel and of its components.
+  void SyncState(FGSnapshot& snapshot) {
+    snapshot.Sync(ExecFrameCountSinceLastRun);
+    snapshot.Check(FCSComponents.size());
+    for (auto comp: FCSComponents)
+      comp->SyncState(snapshot);
+  }
 
   private:
     FGFCS* fcs;
@@ -39,6 +39,7 @@ INCLUDES
 #include "models/FGMassBalance.h"
 #include "FGGasCell.h"
 #include "input_output/FGXMLElement.h"
+#include "input_output/FGSnapshot.h"
 
 using std::cerr;
 using std::endl;
@@ -423,6 +424,27 @@ void FGGasCell::Calculate(double dt)
   }
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGGasCell::SyncState(FGSnapshot& snapshot)
+{
+  FGForce::SyncState(snapshot);
+  snapshot.Sync(Pressure);
+  snapshot.Sync(Contents);
+  snapshot.Sync(Volume);
+  snapshot.Sync(dVolumeIdeal);
+  snapshot.Sync(Temperature);
+  snapshot.Sync(Buoyancy);
+  snapshot.Sync(ValveOpen);
+  snapshot.Sync(Mass);
+  snapshot.Sync(gasCellJ);
+  snapshot.Sync(gasCellM);
+
+  snapshot.Check(Ballonet.size());
+  for (auto ballonet: Ballonet)
+    ballonet->SyncState(snapshot);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -773,6 +795,20 @@ void FGBallonet::Calculate(double dt)
   ballonetJ += MassBalance->GetPointmassInertia(GetMass(), GetXYZ());
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGBallonet::SyncState(FGSnapshot& snapshot)
+{
+  snapshot.Sync(Pressure);
+  snapshot.Sync(Contents);
+  snapshot.Sync(Volume);
+  snapshot.Sync(dVolumeIdeal);
+  snapshot.Sync(dU);
+  snapshot.Sync(Temperature);
+  snapshot.Sync(ValveOpen);
+  snapshot.Sync(ballonetJ);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -184,6 +184,7 @@ public:
   /** Runs the gas cell model; called by BuoyantForces
    */
   void Calculate(double dt);
+  void SyncState(FGSnapshot& snapshot) override;
 
   /** Get the index of this gas cell
       @return gas cell index. */
@@ -310,6 +311,9 @@ public:
    */
   void Calculate(double dt);
 
+  /// Saves or restores the state of the ballonet.
+  void SyncState(FGSnapshot& snapshot);
+
 
   /** Get the center of gravity location of the ballonet
       @return CoG location in the structural frame in inches. */
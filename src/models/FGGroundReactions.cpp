@@ -41,6 +41,7 @@ INCLUDES
 #include "FGGroundReactions.h"
 #include "FGAccelerations.h"
 #include "input_output/FGXMLElement.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -133,8 +134,6 @@ void FGGroundReactions::SetDsCmd(double cmd)
 
 bool FGGroundReactions::Load(Element* document)
 {
-  static int num = 0;
-
   Name = "Ground Reactions Model: " + document->GetAttributeValue("name");
 
   Debug(2);
@@ -145,7 +144,8 @@ bool FGGroundReactions::Load(Element* document)
 
   Element* contact_element = document->FindElement("contact");
   while (contact_element) {
-    lGear.push_back(make_shared<FGLGear>(contact_element, FDMExec, num++, in));
+    int num = lGear.size();
+    lGear.push_back(make_shared<FGLGear>(contact_element, FDMExec, num, in));
     contact_element = document->FindNextElement("contact");
   }
 
@@ -200,6 +200,16 @@ string FGGroundReactions::GetGroundReactionValues(string delimeter) const
 {
   std::ostringstream buf;
 
+  GetGroundReactionValues(buf, delimeter);
+
+  return buf.str();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGGroundReactions::GetGroundReactionValues(ostream& buf,
+                                                const string& delimeter) const
+{
   for (auto& gear: lGear) {
     if (gear->IsBogey()) {
       buf << (gear->GetWOW() ? "1" : "0") << delimeter
@@ -231,8 +241,6 @@ string FGGroundReactions::GetGroundReactionValues(string delimeter) const
       << Accelerations->GetGroundMoments(eX) << delimeter
       << Accelerations->GetGroundMoments(eY) << delimeter
       << Accelerations->GetGroundMoments(eZ);
-
-  return buf.str();
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -248,6 +256,39 @@ void FGGroundReactions::bind(void)
                        &FGGroundReactions::SetDsCmd);
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGGroundReactions::SyncState(FGSnapshot& snapshot)
+{
+  FGModel::SyncState(snapshot);
+  FGSurface::SyncState(snapshot);
+  snapshot.Sync(in.Vground);
+  snapshot.Sync(in.VcalibratedKts);
+  snapshot.Sync(in.Temperature);
+  snapshot.Sync(in.DistanceAGL);
+  snapshot.Sync(in.DistanceASL);
+  snapshot.Sync(in.TotalDeltaT);
+  snapshot.Sync(in.TakeoffThrottle);
+  snapshot.Sync(in.WOW);
+  snapshot.Sync(in.Tb2l);
+  snapshot.Sync(in.Tec2l);
+  snapshot.Sync(in.Tec2b);
+  snapshot.Sync(in.PQR);
+  snapshot.Sync(in.UVW);
+  snapshot.Sync(in.vXYZcg);
+  snapshot.Sync(in.Location);
+  snapshot.Sync(in.BrakePos);
+  snapshot.Sync(in.FCSGearPos);
+  snapshot.Sync(in.EmptyWeight);
+  snapshot.Sync(vForces);
+  snapshot.Sync(vMoments);
+  snapshot.Sync(DsCmd);
+
+  snapshot.Check(lGear.size());
+  for (auto& gear: lGear)
+    gear->SyncState(snapshot);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -90,6 +90,7 @@ public:
                      "Resume" command to be given.
       @return false if no error */
   bool Run(bool Holding) override;
+  void SyncState(FGSnapshot& snapshot) override;
   bool Load(Element* el) override;
   const FGColumnVector3& GetForces(void) const {return vForces;}
   double GetForces(int idx) const {return vForces(idx);}
@@ -97,6 +98,7 @@ public:
   double GetMoments(int idx) const {return vMoments(idx);}
   std::string GetGroundReactionStrings(std::string delimeter) const;
   std::string GetGroundReactionValues(std::string delimeter) const;
+  void GetGroundReactionValues(std::ostream& out, const std::string& delimeter) const;
   bool GetWOW(void) const;
 
   /** Gets the number of gears.
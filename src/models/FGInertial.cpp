@@ -38,6 +38,7 @@ INCLUDES
 #include "FGInertial.h"
 #include "input_output/FGXMLElement.h"
 #include "GeographicLib/Geodesic.hpp"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -261,6 +262,17 @@ void FGInertial::bind(void)
                        &FGInertial::SetGravityType);
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGInertial::SyncState(FGSnapshot& snapshot)
+{
+  FGModel::SyncState(snapshot);
+  snapshot.Sync(vOmegaPlanet);
+  snapshot.Sync(vGravAccel);
+  snapshot.Sync(gravType);
+  GroundCallback->SyncState(snapshot);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -97,7 +97,7 @@ bool FGInput::Load(Element* el)
 
   if (type.empty() || type == "SOCKET") {
     Input = new FGInputSocket(FDMExec);
-  } else if (type == "QTJSBSIM") {
+  } else if (type == "UDP" || type == "QTJSBSIM") {
     Input = new FGUDPInputSocket(FDMExec);
   } else if (type != string("NONE")) {
     cerr << element->ReadFrom()
@@ -150,7 +150,7 @@ bool FGInput::Run(bool Holding)
 
 bool FGInput::SetDirectivesFile(const SGPath& fname)
 {
-  FGXMLFileRead XMLFile;
+  FGXMLFileRead XMLFile(FDMExec->GetDocumentCache());
   Element* document = XMLFile.LoadXMLDocument(fname);
   if (!document) {
     stringstream s;
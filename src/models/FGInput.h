@@ -63,6 +63,9 @@ CLASS DOCUMENTATION
       SOCKET      Will eventually send data to a socket input, where NAME
                   would then be the IP address of the machine the data should
                   be sent to. DON'T USE THIS YET!
+      UDP         Reads the values of properties from UDP datagrams, either as
+                  comma separated text or as packed binary records (see
+                  FGUDPInputSocket). QTJSBSIM is a synonym.
       NONE        Specifies to do nothing. This setting makes it easy to turn on and
                   off the data input without having to mess with anything else.
 
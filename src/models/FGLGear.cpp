@@ -47,6 +47,7 @@ INCLUDES
 #include "math/FGTable.h"
 #include "input_output/FGXMLElement.h"
 #include "models/FGInertial.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -883,6 +884,53 @@ void FGLGear::Report(ReportType repType)
   }
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGLGear::SyncState(FGSnapshot& snapshot)
+{
+  FGSurface::SyncState(snapshot);
+  FGForce::SyncState(snapshot);
+  snapshot.Sync(mTGear);
+  snapshot.Sync(vLocalGear);
+  snapshot.Sync(vWhlVelVec);
+  snapshot.Sync(vGroundWhlVel);
+  snapshot.Sync(vGroundNormal);
+  snapshot.Sync(SteerAngle);
+  snapshot.Sync(compressLength);
+  snapshot.Sync(compressSpeed);
+  snapshot.Sync(rollingFCoeff);
+  snapshot.Sync(BrakeFCoeff);
+  snapshot.Sync(SinkRate);
+  snapshot.Sync(GroundSpeed);
+  snapshot.Sync(TakeoffDistanceTraveled);
+  snapshot.Sync(TakeoffDistanceTraveled50ft);
+  snapshot.Sync(LandingDistanceTraveled);
+  snapshot.Sync(MaximumStrutForce);
+  snapshot.Sync(StrutForce);
+  snapshot.Sync(MaximumStrutTravel);
+  snapshot.Sync(FCoeff);
+  snapshot.Sync(WheelSlip);
+  snapshot.Sync(GearPos);
+  snapshot.Sync(WOW);
+  snapshot.Sync(lastWOW);
+  snapshot.Sync(FirstContact);
+  snapshot.Sync(StartedGroundRun);
+  snapshot.Sync(LandingReported);
+  snapshot.Sync(TakeoffReported);
+  snapshot.Sync(ReportEnable);
+  snapshot.Sync(Castered);
+  snapshot.Sync(StaticFriction);
+  snapshot.Sync(useFCSGearPos);
+
+  for (auto& multiplier: LMultiplier) {
+    snapshot.Sync(multiplier.ForceJacobian);
+    snapshot.Sync(multiplier.LeverArm);
+    snapshot.Sync(multiplier.Min);
+    snapshot.Sync(multiplier.Max);
+    snapshot.Sync(multiplier.value);
+  }
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
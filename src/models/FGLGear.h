@@ -239,6 +239,8 @@ public:
    */
   const FGColumnVector3& GetBodyForces(FGSurface *surface = NULL);
 
+  void SyncState(FGSnapshot& snapshot) override;
+
   /// Gets the location of the gear in Body axes
   FGColumnVector3 GetBodyLocation(void) const {
     return Ts2b * (vXYZn - in.vXYZcg);
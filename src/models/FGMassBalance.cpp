@@ -43,6 +43,7 @@ INCLUDES
 #include "FGMassBalance.h"
 #include "FGFDMExec.h"
 #include "input_output/FGXMLElement.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -492,6 +493,44 @@ void FGMassBalance::GetMassPropertiesReport(int i)
   cout.setf(ios_base::fixed);
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGMassBalance::SyncState(FGSnapshot& snapshot)
+{
+  FGModel::SyncState(snapshot);
+  snapshot.Sync(in.GasMass);
+  snapshot.Sync(in.TanksWeight);
+  snapshot.Sync(in.GasMoment);
+  snapshot.Sync(in.GasInertia);
+  snapshot.Sync(in.TanksMoment);
+  snapshot.Sync(in.TankInertia);
+  snapshot.Sync(in.WOW);
+  snapshot.Sync(Weight);
+  snapshot.Sync(EmptyWeight);
+  snapshot.Sync(Mass);
+  snapshot.Sync(mJ);
+  snapshot.Sync(mJinv);
+  snapshot.Sync(pmJ);
+  snapshot.Sync(baseJ);
+  snapshot.Sync(vXYZcg);
+  snapshot.Sync(vLastXYZcg);
+  snapshot.Sync(vDeltaXYZcg);
+  snapshot.Sync(vDeltaXYZcgBody);
+  snapshot.Sync(vXYZtank);
+  snapshot.Sync(vbaseXYZcg);
+  snapshot.Sync(vPMxyz);
+  snapshot.Sync(PointMassCG);
+
+  snapshot.Check(PointMasses.size());
+  for (auto pm: PointMasses) {
+    snapshot.Sync(pm->Location);
+    snapshot.Sync(pm->Weight);
+    snapshot.Sync(pm->Radius);
+    snapshot.Sync(pm->Length);
+    snapshot.Sync(pm->mPMInertia);
+  }
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
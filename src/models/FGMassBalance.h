@@ -139,6 +139,7 @@ public:
                      on a socket for the "Resume" command to be given.  @return
                      false if no error */
   bool Run(bool Holding) override;
+  void SyncState(FGSnapshot& snapshot) override;
 
   double GetMass(void) const {return Mass;}
   double GetWeight(void) const {return Weight;}
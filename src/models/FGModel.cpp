@@ -41,6 +41,7 @@ INCLUDES
 #include "FGModel.h"
 #include "FGFDMExec.h"
 #include "input_output/FGModelLoader.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -100,6 +101,14 @@ bool FGModel::Run(bool Holding)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGModel::SyncState(FGSnapshot& snapshot)
+{
+  SyncFunctions(snapshot);
+  snapshot.Sync(exe_ctr);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 SGPath FGModel::FindFullPathName(const SGPath& path) const
 {
   return CheckPathName(FDMExec->GetFullAircraftPath(), path);
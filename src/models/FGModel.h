@@ -53,6 +53,7 @@ namespace JSBSim {
 class FGFDMExec;
 class Element;
 class FGPropertyManager;
+class FGSnapshot;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
@@ -91,13 +92,17 @@ public:
   void SetRate(unsigned int tt) {rate = tt;}
   /// Get the output rate for the model in frames
   unsigned int GetRate(void)   {return rate;}
-  FGFDMExec* GetExec(void)     {return FDMExec;}
+  FGFDMExec* GetExec(void) const {return FDMExec;}
 
   void SetPropertyManager(std::shared_ptr<FGPropertyManager> fgpm) { PropertyManager=fgpm;}
   virtual SGPath FindFullPathName(const SGPath& path) const;
   const std::string& GetName(void) { return Name; }
   virtual bool Load(Element* el) { return true; }
 
+  /** Saves or restores the state of the model (see FGFDMExec::SaveSnapshot).
+      The derived classes must call the method of their base class. */
+  virtual void SyncState(FGSnapshot& snapshot);
+
 protected:
   unsigned int exe_ctr;
   unsigned int rate;
@@ -40,8 +40,12 @@ INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 #include "FGOutput.h"
+#include "FGFDMExec.h"
 #include "input_output/FGOutputTextFile.h"
 #include "input_output/FGOutputFG.h"
+#include "input_output/FGOutputBinaryFile.h"
+#include "input_output/FGOutputBinarySocket.h"
+#include "input_output/FGOutputColumnarFile.h"
 #include "input_output/FGXMLFileRead.h"
 #include "input_output/FGModelLoader.h"
 
@@ -59,6 +63,7 @@ FGOutput::FGOutput(FGFDMExec* fdmex) : FGModel(fdmex)
 
   Name = "FGOutput";
   enabled = true;
+  inhibited = false;
 
   PropertyManager->Tie("simulation/force-output", this, (iOPV)0, &FGOutput::ForceOutput);
 
@@ -69,8 +74,12 @@ FGOutput::FGOutput(FGFDMExec* fdmex) : FGModel(fdmex)
 
 FGOutput::~FGOutput()
 {
-  for (auto output: OutputTypes)
+  for (auto output: OutputTypes) {
+    // The records queued by asynchronous outputs must be written and their
+    // writer thread stopped before the files and sockets are closed.
+    output->StopAsync();
     delete output;
+  }
 
   Debug(1);
 }
@@ -82,9 +91,12 @@ bool FGOutput::InitModel(void)
   bool ret = false;
 
   if (!FGModel::InitModel()) return false;
+  if (inhibited) return ret;
 
-  for (auto output: OutputTypes)
+  for (auto output: OutputTypes) {
     ret &= output->InitModel();
+    output->StartAsync();
+  }
 
   return ret;
 }
@@ -108,14 +120,18 @@ bool FGOutput::Run(bool Holding)
 
 void FGOutput::Print(void)
 {
+  if (inhibited) return;
+
   for (auto output: OutputTypes)
-    output->Print();
+    output->Generate();
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 void FGOutput::SetStartNewOutput(void)
 {
+  if (inhibited) return;
+
   for (auto output: OutputTypes)
     output->SetStartNewOutput();
 }
@@ -142,8 +158,10 @@ void FGOutput::SetRateHz(double rate)
 
 void FGOutput::ForceOutput(int idx)
 {
+  if (inhibited) return;
+
   if (idx >= (int)0 && idx < (int)OutputTypes.size())
-    OutputTypes[idx]->Print();
+    OutputTypes[idx]->Generate();
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -171,7 +189,7 @@ string FGOutput::GetOutputName(unsigned int idx) const
 
 bool FGOutput::SetDirectivesFile(const SGPath& fname)
 {
-  FGXMLFileRead XMLFile;
+  FGXMLFileRead XMLFile(FDMExec->GetDocumentCache());
   Element* document = XMLFile.LoadXMLDocument(fname);
   if (!document) {
     stringstream s;
@@ -213,6 +231,15 @@ bool FGOutput::Load(int subSystems, std::string protocol, std::string type,
   } else if (type == "FLIGHTGEAR") {
     Output = new FGOutputFG(FDMExec);
     name += ":" + port + "/" + protocol;
+  } else if (type == "BINARY") {
+    if (port.empty())
+      Output = new FGOutputBinaryFile(FDMExec);
+    else {
+      Output = new FGOutputBinarySocket(FDMExec);
+      name += ":" + port + "/" + protocol;
+    }
+  } else if (type == "COLUMNAR") {
+    Output = new FGOutputColumnarFile(FDMExec);
   } else if (type == "TERMINAL") {
     // Not done yet
   } else if (type != string("NONE")) {
@@ -260,6 +287,13 @@ bool FGOutput::Load(Element* document, const SGPath& dir)
     Output = new FGOutputSocket(FDMExec);
   } else if (type == "FLIGHTGEAR") {
     Output = new FGOutputFG(FDMExec);
+  } else if (type == "BINARY") {
+    if (document->HasAttribute("port"))
+      Output = new FGOutputBinarySocket(FDMExec);
+    else
+      Output = new FGOutputBinaryFile(FDMExec);
+  } else if (type == "COLUMNAR") {
+    Output = new FGOutputColumnarFile(FDMExec);
   } else if (type == "TERMINAL") {
     // Not done yet
   } else if (type != string("NONE")) {
@@ -72,6 +72,11 @@ CLASS DOCUMENTATION
                   an external instance of FlightGear for visuals.  Parameters
                   defining the socket are given on the \<output> line.
       TABULAR     Columnar data.
+      BINARY      Packed binary records preceded by a header that describes
+                  them (see FGOutputBinaryFile). The data goes to a socket if
+                  a port is given on the \<output> line.
+      COLUMNAR    Compressed columns stored in chunks with a time index for
+                  random access (see FGOutputColumnarFile).
       TERMINAL    Output to terminal. NOT IMPLEMENTED YET!
       NONE        Specifies to do nothing. This setting makes it easy to turn on
                   and off the data output without having to mess with anything
@@ -96,6 +101,12 @@ CLASS DOCUMENTATION
                 This value may not be *exactly* what you want, due to the
                 dependence on dt, the cycle rate for the FDM.
 
+    async       block|drop-oldest|drop-newest. Formats and writes the data
+                in a separate thread (see FGOutputType). The value is the
+                policy applied when the writer thread cannot keep up.
+
+    buffer      The number of records that can be queued by an async output.
+
     The following parameters tell which subsystems of data to output:
 
     simulation       ON|OFF
@@ -177,9 +188,14 @@ public:
       @return true if the execution succeeded. */
   bool SetDirectivesFile(const SGPath& fname);
   /// Enables the output generation for all output instances.
-  void Enable(void) { enabled = true; }
+  void Enable(void) { enabled = !inhibited; }
   /// Disables the output generation for all output instances.
   void Disable(void) { enabled = false; }
+  /** Disables the output generation for good: the output instances no longer
+      open their files nor their sockets. This is meant for the simulations
+      run in batch (see FGBatchRunner) and must be called before the model is
+      initialized. */
+  void Inhibit(void) { enabled = false; inhibited = true; }
   /** Toggles the output generation of each ouput instance.
       @param idx ID of the output instance which output generation will be
                  toggled.
@@ -222,6 +238,7 @@ public:
 private:
   std::vector<FGOutputType*> OutputTypes;
   bool enabled;
+  bool inhibited;
   SGPath includePath;
 
   void Debug(int from) override;
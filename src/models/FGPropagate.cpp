@@ -70,6 +70,7 @@ INCLUDES
 #include "FGFDMExec.h"
 #include "simgear/io/iostreams/sgstream.hxx"
 #include "FGInertial.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -95,11 +96,6 @@ FGPropagate::FGPropagate(FGFDMExec* fdmex)
   integrator_rotational_position = eRectEuler;
   integrator_translational_position = eAdamsBashforth3;
 
-  VState.dqPQRidot.resize(5, FGColumnVector3(0.0,0.0,0.0));
-  VState.dqUVWidot.resize(5, FGColumnVector3(0.0,0.0,0.0));
-  VState.dqInertialVelocity.resize(5, FGColumnVector3(0.0,0.0,0.0));
-  VState.dqQtrndot.resize(5, FGQuaternion(0.0,0.0,0.0));
-
   epa = 0.0;
 
   bind();
@@ -123,11 +119,6 @@ bool FGPropagate::InitModel(void)
   VState.vLocation.SetEllipse(in.SemiMajor, in.SemiMinor);
   Inertial->SetAltitudeAGL(VState.vLocation, 4.0);
 
-  VState.dqPQRidot.resize(5, FGColumnVector3(0.0,0.0,0.0));
-  VState.dqUVWidot.resize(5, FGColumnVector3(0.0,0.0,0.0));
-  VState.dqInertialVelocity.resize(5, FGColumnVector3(0.0,0.0,0.0));
-  VState.dqQtrndot.resize(5, FGColumnVector3(0.0,0.0,0.0));
-
   integrator_rotational_rate = eRectEuler;
   integrator_translational_rate = eAdamsBashforth2;
   integrator_rotational_position = eRectEuler;
@@ -185,14 +176,14 @@ void FGPropagate::SetInitialState(const FGInitialCondition* FGIC)
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
-// Initialize the past value deques
+// Initialize the past value histories
 
 void FGPropagate::InitializeDerivatives()
 {
-  VState.dqPQRidot.assign(5, in.vPQRidot);
-  VState.dqUVWidot.assign(5, in.vUVWidot);
-  VState.dqInertialVelocity.assign(5, VState.vInertialVelocity);
-  VState.dqQtrndot.assign(5, VState.vQtrndot);
+  VState.dqPQRidot.assign(in.vPQRidot);
+  VState.dqUVWidot.assign(in.vUVWidot);
+  VState.dqInertialVelocity.assign(VState.vInertialVelocity);
+  VState.dqQtrndot.assign(VState.vQtrndot);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -335,12 +326,11 @@ void FGPropagate::CalculateUVW(void)
 
 void FGPropagate::Integrate( FGColumnVector3& Integrand,
                              FGColumnVector3& Val,
-                             deque <FGColumnVector3>& ValDot,
+                             History<FGColumnVector3>& ValDot,
                              double dt,
                              eIntegrateType integration_type)
 {
   ValDot.push_front(Val);
-  ValDot.pop_back();
 
   switch(integration_type) {
   case eRectEuler:       Integrand += dt*ValDot[0];
@@ -370,12 +360,11 @@ void FGPropagate::Integrate( FGColumnVector3& Integrand,
 
 void FGPropagate::Integrate( FGQuaternion& Integrand,
                              FGQuaternion& Val,
-                             deque <FGQuaternion>& ValDot,
+                             History<FGQuaternion>& ValDot,
                              double dt,
                              eIntegrateType integration_type)
 {
   ValDot.push_front(Val);
-  ValDot.pop_back();
 
   switch(integration_type) {
   case eRectEuler:       Integrand += dt*ValDot[0];
@@ -905,6 +894,67 @@ void FGPropagate::bind(void)
   PropertyManager->Tie("simulation/write-state-file", this, (iPMF)0, &FGPropagate::WriteStateFile);
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+template <typename T>
+void FGPropagate::History<T>::SyncState(FGSnapshot& snapshot)
+{
+  for (auto& value: values) snapshot.Sync(value);
+  snapshot.Sync(head);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropagate::SyncState(FGSnapshot& snapshot)
+{
+  FGModel::SyncState(snapshot);
+
+  snapshot.Sync(VState.vLocation);
+  snapshot.Sync(VState.vUVW);
+  snapshot.Sync(VState.vPQR);
+  snapshot.Sync(VState.vPQRi);
+  snapshot.Sync(VState.qAttitudeLocal);
+  snapshot.Sync(VState.qAttitudeECI);
+  snapshot.Sync(VState.vQtrndot);
+  snapshot.Sync(VState.vInertialVelocity);
+  snapshot.Sync(VState.vInertialPosition);
+  VState.dqPQRidot.SyncState(snapshot);
+  VState.dqUVWidot.SyncState(snapshot);
+  VState.dqInertialVelocity.SyncState(snapshot);
+  VState.dqQtrndot.SyncState(snapshot);
+
+  snapshot.Sync(vVel);
+  snapshot.Sync(Tec2b);
+  snapshot.Sync(Tb2ec);
+  snapshot.Sync(Tl2b);
+  snapshot.Sync(Tb2l);
+  snapshot.Sync(Tl2ec);
+  snapshot.Sync(Tec2l);
+  snapshot.Sync(Tec2i);
+  snapshot.Sync(Ti2ec);
+  snapshot.Sync(Ti2b);
+  snapshot.Sync(Tb2i);
+  snapshot.Sync(Ti2l);
+  snapshot.Sync(Tl2i);
+  snapshot.Sync(epa);
+  snapshot.Sync(h);
+  snapshot.Sync(Inclination);
+  snapshot.Sync(RightAscension);
+  snapshot.Sync(Eccentricity);
+  snapshot.Sync(PerigeeArgument);
+  snapshot.Sync(TrueAnomaly);
+  snapshot.Sync(ApoapsisRadius);
+  snapshot.Sync(PeriapsisRadius);
+  snapshot.Sync(OrbitalPeriod);
+  snapshot.Sync(Qec2b);
+  snapshot.Sync(LocalTerrainVelocity);
+  snapshot.Sync(LocalTerrainAngularVelocity);
+  snapshot.Sync(integrator_rotational_rate);
+  snapshot.Sync(integrator_translational_rate);
+  snapshot.Sync(integrator_rotational_position);
+  snapshot.Sync(integrator_translational_position);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
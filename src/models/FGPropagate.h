@@ -38,6 +38,7 @@ SENTRY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <array>
 #include <memory>
 
 #include "models/FGModel.h"
@@ -95,6 +96,37 @@ CLASS DECLARATION
 class JSBSIM_API FGPropagate : public FGModel {
 public:
 
+  /** Fixed size history of the past values of a derivative, as needed by the
+      multistep integrators. The values are stored in place in a circular
+      buffer so that pushing a new value neither allocates nor moves the older
+      values. The capacity is the number of steps of the highest order
+      integrator (Adams Bashforth 5). */
+  template <typename T>
+  class History {
+  public:
+    /// Sets all the past values to value.
+    void assign(const T& value) { values.fill(value); head = 0; }
+    /// Adds the most recent value and drops the oldest one.
+    void push_front(const T& value) {
+      head = head ? head-1 : N-1;
+      values[head] = value;
+    }
+    /// Returns the i-th most recent value (0 is the most recent).
+    const T& operator[](unsigned int i) const {
+      unsigned int k = head + i;
+      return values[k < N ? k : k-N];
+    }
+    /// Returns the capacity of the history.
+    static constexpr unsigned int size(void) { return N; }
+    /// Saves or restores the values of the history.
+    void SyncState(FGSnapshot& snapshot);
+
+  private:
+    static constexpr unsigned int N = 5;
+    std::array<T, N> values;
+    unsigned int head = 0;
+  };
+
   /** The current vehicle state vector structure contains the translational and
     angular position, and the translational and angular velocity. */
   struct VehicleState {
@@ -132,10 +164,10 @@ public:
 
     FGColumnVector3 vInertialPosition;
 
-    std::deque <FGColumnVector3> dqPQRidot;
-    std::deque <FGColumnVector3> dqUVWidot;
-    std::deque <FGColumnVector3> dqInertialVelocity;
-    std::deque <FGQuaternion>    dqQtrndot;
+    History<FGColumnVector3> dqPQRidot;
+    History<FGColumnVector3> dqUVWidot;
+    History<FGColumnVector3> dqInertialVelocity;
+    History<FGQuaternion>    dqQtrndot;
   };
 
   /** Constructor.
@@ -170,6 +202,7 @@ public:
                      "Resume" command to be given.
       @return false if no error */
   bool Run(bool Holding);
+  void SyncState(FGSnapshot& snapshot) override;
 
   /** Retrieves the velocity vector.
       The vector returned is represented by an FGColumnVector reference. The vector
@@ -674,13 +707,13 @@ private:
 
   void Integrate( FGColumnVector3& Integrand,
                   FGColumnVector3& Val,
-                  std::deque <FGColumnVector3>& ValDot,
+                  History<FGColumnVector3>& ValDot,
                   double dt,
                   eIntegrateType integration_type);
 
   void Integrate( FGQuaternion& Integrand,
                   FGQuaternion& Val,
-                  std::deque <FGQuaternion>& ValDot,
+                  History<FGQuaternion>& ValDot,
                   double dt,
                   eIntegrateType integration_type);
 
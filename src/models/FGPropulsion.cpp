@@ -58,14 +58,13 @@ INCLUDES
 #include "models/propulsion/FGTank.h"
 #include "input_output/FGModelLoader.h"
 #include "models/propulsion/FGBrushLessDCMotor.h"
+#include "input_output/FGSnapshot.h"
 
 
 using namespace std;
 
 namespace JSBSim {
 
-extern short debug_lvl;
-
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS IMPLEMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
@@ -79,6 +78,7 @@ FGPropulsion::FGPropulsion(FGFDMExec* exec) : FGModel(exec)
   DumpRate = 0.0;
   RefuelRate = 6000.0;
   FuelFreeze = false;
+  PropertiesBound = false;
 
   Debug(0);
 }
@@ -171,7 +171,6 @@ void FGPropulsion::ConsumeFuel(FGEngine* engine)
 
   unsigned int TanksWithFuel=0, CurrentFuelTankPriority=1;
   unsigned int TanksWithOxidizer=0, CurrentOxidizerTankPriority=1;
-  vector <int> FeedListFuel, FeedListOxi;
   bool Starved = true; // Initially set Starved to true. Set to false in code below.
   bool hasOxTanks = false;
 
@@ -182,6 +181,8 @@ void FGPropulsion::ConsumeFuel(FGEngine* engine)
   // 3) Build the feed list.
   // 4) Do the same for oxidizer tanks, if needed.
   size_t numTanks = Tanks.size();
+  FeedListFuel.clear();
+  FeedListOxi.clear();
 
   // Process fuel tanks, if any
   while ((TanksWithFuel == 0) && (CurrentFuelTankPriority <= numTanks)) {
@@ -418,10 +419,8 @@ bool FGPropulsion::Load(Element* el)
     engine_element = el->FindNextElement("engine");
   }
 
-  static bool properties_bound = false;
-
-  if (numEngines && !properties_bound) {
-    properties_bound = true;
+  if (numEngines && !PropertiesBound) {
+    PropertiesBound = true;
     bind();
   }
 
@@ -508,24 +507,29 @@ string FGPropulsion::GetPropulsionStrings(const string& delimiter) const
 
 string FGPropulsion::GetPropulsionValues(const string& delimiter) const
 {
-  string PropulsionValues;
-  bool firstime = true;
   stringstream buf;
 
+  GetPropulsionValues(buf, delimiter);
+
+  return buf.str();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropulsion::GetPropulsionValues(ostream& out, const string& delimiter) const
+{
+  bool firstime = true;
+
   for (const auto& engine: Engines) {
     if (firstime)  firstime = false;
-    else           PropulsionValues += delimiter;
+    else           out << delimiter;
 
-    PropulsionValues += engine->GetEngineValues(delimiter);
+    engine->GetEngineValues(out, delimiter);
   }
   for (const auto& tank: Tanks) {
-    buf << delimiter;
-    buf << tank->GetContents();
+    out << delimiter;
+    out << tank->GetContents();
   }
-
-  PropulsionValues += buf.str();
-
-  return PropulsionValues;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -844,6 +848,59 @@ void FGPropulsion::bind(void)
   PropertyManager->Tie("propulsion/fuel_freeze", this, (bPMF)nullptr, &FGPropulsion::SetFuelFreeze);
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropulsion::SyncState(FGSnapshot& snapshot)
+{
+  FGModel::SyncState(snapshot);
+  snapshot.Sync(in.Pressure);
+  snapshot.Sync(in.PressureRatio);
+  snapshot.Sync(in.Temperature);
+  snapshot.Sync(in.Density);
+  snapshot.Sync(in.DensityRatio);
+  snapshot.Sync(in.Soundspeed);
+  snapshot.Sync(in.TotalPressure);
+  snapshot.Sync(in.TAT_c);
+  snapshot.Sync(in.Vt);
+  snapshot.Sync(in.Vc);
+  snapshot.Sync(in.qbar);
+  snapshot.Sync(in.alpha);
+  snapshot.Sync(in.beta);
+  snapshot.Sync(in.H_agl);
+  snapshot.Sync(in.AeroUVW);
+  snapshot.Sync(in.AeroPQR);
+  snapshot.Sync(in.PQRi);
+  snapshot.Sync(in.ThrottleCmd);
+  snapshot.Sync(in.MixtureCmd);
+  snapshot.Sync(in.ThrottlePos);
+  snapshot.Sync(in.MixturePos);
+  snapshot.Sync(in.PropAdvance);
+  snapshot.Sync(in.PropFeather);
+  snapshot.Sync(in.OperationMode);
+  snapshot.Sync(in.TotalDeltaT);
+  snapshot.Sync(ActiveEngine);
+  snapshot.Sync(vForces);
+  snapshot.Sync(vMoments);
+  snapshot.Sync(vTankXYZ);
+  snapshot.Sync(vXYZtank_arm);
+  snapshot.Sync(tankJ);
+  snapshot.Sync(refuel);
+  snapshot.Sync(dump);
+  snapshot.Sync(FuelFreeze);
+  snapshot.Sync(TotalFuelQuantity);
+  snapshot.Sync(TotalOxidizerQuantity);
+  snapshot.Sync(DumpRate);
+  snapshot.Sync(RefuelRate);
+
+  snapshot.Check(Engines.size());
+  for (auto& engine: Engines)
+    engine->SyncState(snapshot);
+
+  snapshot.Check(Tanks.size());
+  for (auto& tank: Tanks)
+    tank->SyncState(snapshot);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -113,6 +113,7 @@ public:
                      "Resume" command to be given.
       @return false if no error */
   bool Run(bool Holding) override;
+  void SyncState(FGSnapshot& snapshot) override;
 
   bool InitModel(void) override;
 
@@ -154,6 +155,7 @@ public:
 
   std::string GetPropulsionStrings(const std::string& delimiter) const;
   std::string GetPropulsionValues(const std::string& delimiter) const;
+  void GetPropulsionValues(std::ostream& out, const std::string& delimiter) const;
   std::string GetPropulsionTankReport();
 
   const FGColumnVector3& GetForces(void) const {return vForces; }
@@ -199,9 +201,13 @@ private:
   double TotalOxidizerQuantity;
   double DumpRate;
   double RefuelRate;
+  // Scratch feed lists of ConsumeFuel(), kept between calls so that their
+  // storage is reused.
+  std::vector<int> FeedListFuel, FeedListOxi;
   void ConsumeFuel(FGEngine* engine);
 
   bool ReadingEngine;
+  bool PropertiesBound;
 
   void bind();
   void Debug(int from) override;
@@ -40,6 +40,7 @@ INCLUDES
 
 #include "input_output/FGPropertyManager.h"
 #include "models/FGSurface.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -111,6 +112,21 @@ void FGSurface::bind(FGPropertyManager* PropertyManager)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGSurface::SyncState(FGSnapshot& snapshot)
+{
+  snapshot.Sync(eSurfaceType);
+  snapshot.Sync(staticFFactor);
+  snapshot.Sync(rollingFFactor);
+  snapshot.Sync(maximumForce);
+  snapshot.Sync(bumpiness);
+  snapshot.Sync(isSolid);
+  snapshot.Sync(staticFCoeff);
+  snapshot.Sync(dynamicFCoeff);
+  snapshot.Sync(pos);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 double FGSurface::GetBumpHeight()
 {
   if (bumpiness < 0.001) return 0.0f;
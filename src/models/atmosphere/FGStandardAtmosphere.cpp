@@ -49,6 +49,7 @@ INCLUDES
 
 #include "FGFDMExec.h"
 #include "FGStandardAtmosphere.h"
+#include "input_output/FGSnapshot.h"
 
 namespace JSBSim {
 
@@ -697,6 +698,20 @@ void FGStandardAtmosphere::bind(void)
                        &FGStandardAtmosphere::SetVaporMassFractionPPM);
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGStandardAtmosphere::SyncState(FGSnapshot& snapshot)
+{
+  FGAtmosphere::SyncState(snapshot);
+  snapshot.Sync(TemperatureBias);
+  snapshot.Sync(TemperatureDeltaGradient);
+  snapshot.Sync(GradientFadeoutAltitude);
+  snapshot.Sync(VaporMassFraction);
+  snapshot.Sync(SaturatedVaporPressure);
+  snapshot.Sync(LapseRates);
+  snapshot.Sync(PressureBreakpoints);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -104,6 +104,7 @@ public:
   virtual ~FGStandardAtmosphere();
 
   bool InitModel(void) override;
+  void SyncState(FGSnapshot& snapshot) override;
 
   //  *************************************************************************
   /// @name Temperature access functions.
@@ -46,6 +46,7 @@ INCLUDES
 #include "FGWinds.h"
 #include "FGFDMExec.h"
 #include "math/FGTable.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -132,6 +133,12 @@ bool FGWinds::InitModel(void)
   oneMinusCosineGust.gustProfile.Running = false;
   oneMinusCosineGust.gustProfile.elapsedTime = 0.0;
 
+  xi_u_km1 = nu_u_km1 = 0.0;
+  xi_v_km1 = xi_v_km2 = nu_v_km1 = nu_v_km2 = 0.0;
+  xi_w_km1 = xi_w_km2 = nu_w_km1 = nu_w_km2 = 0.0;
+  xi_p_km1 = nu_p_km1 = 0.0;
+  xi_q_km1 = xi_r_km1 = 0.0;
+
   return true;
 }
 
@@ -279,16 +286,6 @@ void FGWinds::Turbulence(double h)
       sig_u = sig_w = POE_Table->GetValue(probability_of_exceedence_index, h);
     }
 
-    // keep values from last timesteps
-    // TODO maybe use deque?
-    static double
-      xi_u_km1 = 0, nu_u_km1 = 0,
-      xi_v_km1 = 0, xi_v_km2 = 0, nu_v_km1 = 0, nu_v_km2 = 0,
-      xi_w_km1 = 0, xi_w_km2 = 0, nu_w_km1 = 0, nu_w_km2 = 0,
-      xi_p_km1 = 0, nu_p_km1 = 0,
-      xi_q_km1 = 0, xi_r_km1 = 0;
-
-
     double
       T_V = in.totalDeltaT, // for compatibility of nomenclature
       sig_p = 1.9/sqrt(L_w*b_w)*sig_w, // Yeager1998, eq. (8)
@@ -566,6 +563,91 @@ void FGWinds::bind(void)
 
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGWinds::SyncState(FGSnapshot& snapshot)
+{
+  FGModel::SyncState(snapshot);
+  snapshot.Sync(in.V);
+  snapshot.Sync(in.wingspan);
+  snapshot.Sync(in.DistanceAGL);
+  snapshot.Sync(in.AltitudeASL);
+  snapshot.Sync(in.longitude);
+  snapshot.Sync(in.latitude);
+  snapshot.Sync(in.planetRadius);
+  snapshot.Sync(in.Tl2b);
+  snapshot.Sync(in.Tw2b);
+  snapshot.Sync(in.totalDeltaT);
+  snapshot.Sync(turbType);
+  snapshot.Sync(MagnitudedAccelDt);
+  snapshot.Sync(MagnitudeAccel);
+  snapshot.Sync(Magnitude);
+  snapshot.Sync(TurbDirection);
+  snapshot.Sync(TurbGain);
+  snapshot.Sync(TurbRate);
+  snapshot.Sync(Rhythmicity);
+  snapshot.Sync(wind_from_clockwise);
+  snapshot.Sync(spike);
+  snapshot.Sync(target_time);
+  snapshot.Sync(strength);
+  snapshot.Sync(vTurbulenceGrad);
+  snapshot.Sync(vBodyTurbGrad);
+  snapshot.Sync(vTurbPQR);
+
+  snapshot.Sync(oneMinusCosineGust.vWind);
+  snapshot.Sync(oneMinusCosineGust.vWindTransformed);
+  snapshot.Sync(oneMinusCosineGust.magnitude);
+  snapshot.Sync(oneMinusCosineGust.gustFrame);
+  snapshot.Sync(oneMinusCosineGust.gustProfile.Running);
+  snapshot.Sync(oneMinusCosineGust.gustProfile.elapsedTime);
+  snapshot.Sync(oneMinusCosineGust.gustProfile.startupDuration);
+  snapshot.Sync(oneMinusCosineGust.gustProfile.steadyDuration);
+  snapshot.Sync(oneMinusCosineGust.gustProfile.endDuration);
+
+  // The number of cells is set by a property so it can change during a run.
+  size_t nCells = UpDownBurstCells.size();
+  snapshot.Sync(nCells);
+  if (nCells != UpDownBurstCells.size())
+    NumberOfUpDownburstCells(static_cast<int>(nCells));
+  for (auto cell: UpDownBurstCells) {
+    snapshot.Sync(cell->ringLatitude);
+    snapshot.Sync(cell->ringLongitude);
+    snapshot.Sync(cell->ringAltitude);
+    snapshot.Sync(cell->ringRadius);
+    snapshot.Sync(cell->ringCoreRadius);
+    snapshot.Sync(cell->circulation);
+    snapshot.Sync(cell->oneMCosineProfile.Running);
+    snapshot.Sync(cell->oneMCosineProfile.elapsedTime);
+    snapshot.Sync(cell->oneMCosineProfile.startupDuration);
+    snapshot.Sync(cell->oneMCosineProfile.steadyDuration);
+    snapshot.Sync(cell->oneMCosineProfile.endDuration);
+  }
+
+  snapshot.Sync(windspeed_at_20ft);
+  snapshot.Sync(probability_of_exceedence_index);
+  snapshot.Sync(xi_u_km1);
+  snapshot.Sync(nu_u_km1);
+  snapshot.Sync(xi_v_km1);
+  snapshot.Sync(xi_v_km2);
+  snapshot.Sync(nu_v_km1);
+  snapshot.Sync(nu_v_km2);
+  snapshot.Sync(xi_w_km1);
+  snapshot.Sync(xi_w_km2);
+  snapshot.Sync(nu_w_km1);
+  snapshot.Sync(nu_w_km2);
+  snapshot.Sync(xi_p_km1);
+  snapshot.Sync(nu_p_km1);
+  snapshot.Sync(xi_q_km1);
+  snapshot.Sync(xi_r_km1);
+  snapshot.Sync(psiw);
+  snapshot.Sync(vTotalWindNED);
+  snapshot.Sync(vWindNED);
+  snapshot.Sync(vGustNED);
+  snapshot.Sync(vCosineGust);
+  snapshot.Sync(vBurstGust);
+  snapshot.Sync(vTurbulenceNED);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
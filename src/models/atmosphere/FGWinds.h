@@ -179,6 +179,7 @@ public:
       @return false if no error */
   bool Run(bool Holding) override;
   bool InitModel(void) override;
+  void SyncState(FGSnapshot& snapshot) override;
   enum tType {ttNone, ttStandard, ttCulp, ttMilspec, ttTustin} turbType;
 
   // TOTAL WIND access functions (wind + gust + turbulence)
@@ -385,6 +386,12 @@ private:
   double windspeed_at_20ft; ///< in ft/s
   int probability_of_exceedence_index; ///< this is bound as the severity property
   FGTable *POE_Table; ///< probability of exceedence table
+  // values of the filters from the last time steps
+  double xi_u_km1, nu_u_km1;
+  double xi_v_km1, xi_v_km2, nu_v_km1, nu_v_km2;
+  double xi_w_km1, xi_w_km2, nu_w_km1, nu_w_km2;
+  double xi_p_km1, nu_p_km1;
+  double xi_q_km1, xi_r_km1;
 
   double psiw;
   FGColumnVector3 vTotalWindNED;
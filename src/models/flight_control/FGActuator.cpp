@@ -41,6 +41,7 @@ INCLUDES
 #include "input_output/FGXMLElement.h"
 #include "math/FGParameterValue.h"
 #include "models/FGFCS.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -311,6 +312,26 @@ void FGActuator::InitializeLagCoefficients()
   cb = (2.00 - dt * lagVal) / denom;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGActuator::SyncState(FGSnapshot& snapshot)
+{
+  FGFCSComponent::SyncState(snapshot);
+  snapshot.Sync(lagVal);
+  snapshot.Sync(ca);
+  snapshot.Sync(cb);
+  snapshot.Sync(PreviousOutput);
+  snapshot.Sync(PreviousHystOutput);
+  snapshot.Sync(PreviousRateLimOutput);
+  snapshot.Sync(PreviousLagInput);
+  snapshot.Sync(PreviousLagOutput);
+  snapshot.Sync(fail_zero);
+  snapshot.Sync(fail_hardover);
+  snapshot.Sync(fail_stuck);
+  snapshot.Sync(initialized);
+  snapshot.Sync(saturated);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
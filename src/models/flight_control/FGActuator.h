@@ -137,6 +137,7 @@ public:
       limiting, etc. functions. */
   bool Run (void) override;
   void ResetPastStates(void) override;
+  void SyncState(FGSnapshot& snapshot) override;
 
   // these may need to have the bool argument replaced with a double
   /** This function fails the actuator to zero. The motion to zero
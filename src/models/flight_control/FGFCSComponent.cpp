@@ -40,6 +40,7 @@ INCLUDES
 #include "FGFCSComponent.h"
 #include "models/FGFCS.h"
 #include "math/FGParameterValue.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -324,6 +325,16 @@ void FGFCSComponent::bind(Element* el, FGPropertyManager* PropertyManager)
   }
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFCSComponent::SyncState(FGSnapshot& snapshot)
+{
+  snapshot.Sync(Input);
+  snapshot.Sync(Output);
+  snapshot.Sync(output_array);
+  snapshot.Sync(index);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -48,6 +48,7 @@ namespace JSBSim {
 
 class FGFCS;
 class Element;
+class FGSnapshot;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
@@ -97,6 +98,11 @@ public:
   virtual double GetOutputPct(void) const { return 0; }
   virtual void ResetPastStates(void);
 
+  /** Saves or restores the state of the component (see
+      FGFDMExec::SaveSnapshot). The derived classes must call the method of
+      their base class. */
+  virtual void SyncState(FGSnapshot& snapshot);
+
 protected:
   FGFCS* fcs;
   std::vector <FGPropertyNode_ptr> OutputNodes;
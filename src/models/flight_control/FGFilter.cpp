@@ -40,6 +40,7 @@ INCLUDES
 #include "FGFilter.h"
 #include "models/FGFCS.h"
 #include "math/FGParameterValue.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -191,6 +192,23 @@ bool FGFilter::Run(void)
   return true;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFilter::SyncState(FGSnapshot& snapshot)
+{
+  FGFCSComponent::SyncState(snapshot);
+  snapshot.Sync(Initialize);
+  snapshot.Sync(ca);
+  snapshot.Sync(cb);
+  snapshot.Sync(cc);
+  snapshot.Sync(cd);
+  snapshot.Sync(ce);
+  snapshot.Sync(PreviousInput1);
+  snapshot.Sync(PreviousInput2);
+  snapshot.Sync(PreviousOutput1);
+  snapshot.Sync(PreviousOutput2);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
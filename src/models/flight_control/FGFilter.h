@@ -221,6 +221,7 @@ public:
   bool Run (void) override;
 
   void ResetPastStates(void) override;
+  void SyncState(FGSnapshot& snapshot) override;
 
 private:
   bool DynamicFilter;
@@ -40,6 +40,7 @@ INCLUDES
 #include "FGLinearActuator.h"
 #include "models/FGFCS.h"
 #include "math/FGParameterValue.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -217,6 +218,23 @@ bool FGLinearActuator::Run(void )
   return true;
 }
 
+// %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGLinearActuator::SyncState(FGSnapshot& snapshot)
+{
+  FGFCSComponent::SyncState(snapshot);
+  snapshot.Sync(set);
+  snapshot.Sync(reset);
+  snapshot.Sync(direction);
+  snapshot.Sync(countSpin);
+  snapshot.Sync(versus);
+  snapshot.Sync(bias);
+  snapshot.Sync(inputLast);
+  snapshot.Sync(inputMem);
+  snapshot.Sync(previousLagInput);
+  snapshot.Sync(previousLagOutput);
+}
+
 // %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -41,6 +41,7 @@ INCLUDES
 #include "simgear/magvar/coremag.hxx"
 #include "models/FGFCS.h"
 #include "models/FGMassBalance.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -147,6 +148,19 @@ bool FGMagnetometer::Run(void )
   return true;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGMagnetometer::SyncState(FGSnapshot& snapshot)
+{
+  FGSensor::SyncState(snapshot);
+  snapshot.Sync(vMag);
+  snapshot.Sync(field);
+  snapshot.Sync(usedLat);
+  snapshot.Sync(usedLon);
+  snapshot.Sync(usedAlt);
+  snapshot.Sync(counter);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -38,6 +38,7 @@ INCLUDES
 #include "FGPID.h"
 #include "models/FGFCS.h"
 #include "math/FGParameterValue.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -211,6 +212,16 @@ bool FGPID::Run(void )
   return true;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPID::SyncState(FGSnapshot& snapshot)
+{
+  FGFCSComponent::SyncState(snapshot);
+  snapshot.Sync(I_out_total);
+  snapshot.Sync(Input_prev);
+  snapshot.Sync(Input_prev2);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
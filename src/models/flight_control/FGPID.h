@@ -130,6 +130,7 @@ public:
 
   bool Run (void) override;
   void ResetPastStates(void) override;
+  void SyncState(FGSnapshot& snapshot) override;
 
     /// These define the indices use to select the various integrators.
   enum eIntegrateType {eNone = 0, eRectEuler, eTrapezoidal, eAdamsBashforth2,
@@ -40,6 +40,7 @@ INCLUDES
 #include "FGSensor.h"
 #include "models/FGFCS.h"
 #include "input_output/FGXMLElement.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -278,6 +279,20 @@ void FGSensor::bind(Element* el, FGPropertyManager* PropertyManager)
 
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSensor::SyncState(FGSnapshot& snapshot)
+{
+  FGFCSComponent::SyncState(snapshot);
+  snapshot.Sync(drift);
+  snapshot.Sync(PreviousOutput);
+  snapshot.Sync(PreviousInput);
+  snapshot.Sync(quantized);
+  snapshot.Sync(fail_low);
+  snapshot.Sync(fail_high);
+  snapshot.Sync(fail_stuck);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
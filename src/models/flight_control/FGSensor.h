@@ -141,6 +141,7 @@ public:
 
   bool Run (void) override;
   void ResetPastStates(void) override;
+  void SyncState(FGSnapshot& snapshot) override;
 
 protected:
   enum eNoiseType {ePercent=0, eAbsolute} NoiseType;
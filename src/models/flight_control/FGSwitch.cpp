@@ -64,6 +64,7 @@ INCLUDES
 #include "FGSwitch.h"
 #include "models/FGFCS.h"
 #include "math/FGCondition.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -169,6 +170,14 @@ void FGSwitch::VerifyProperties(void)
   }
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSwitch::SyncState(FGSnapshot& snapshot)
+{
+  FGFCSComponent::SyncState(snapshot);
+  snapshot.Sync(initialized);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -142,6 +142,7 @@ public:
   /** Executes the switch logic.
       @return true - always*/
   bool Run(void) override;
+  void SyncState(FGSnapshot& snapshot) override;
 
 private:
 
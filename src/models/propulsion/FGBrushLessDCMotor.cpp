@@ -53,6 +53,7 @@ INCLUDES
 #include "FGBrushLessDCMotor.h"
 #include "FGPropeller.h"
 #include "input_output/FGXMLElement.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -170,14 +171,19 @@ string FGBrushLessDCMotor::GetEngineLabels(const string& delimiter)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-string FGBrushLessDCMotor::GetEngineValues(const string& delimiter)
+void FGBrushLessDCMotor::GetEngineValues(ostream& out, const string& delimiter)
 {
-  std::ostringstream buf;
+  out << HP << delimiter;
+  Thruster->GetThrusterValues(EngineNumber, out, delimiter);
+}
 
-  buf << HP << delimiter
-     << Thruster->GetThrusterValues(EngineNumber, delimiter);
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-  return buf.str();
+void FGBrushLessDCMotor::SyncState(FGSnapshot& snapshot)
+{
+  FGEngine::SyncState(snapshot);
+  snapshot.Sync(HP);
+  snapshot.Sync(Current);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
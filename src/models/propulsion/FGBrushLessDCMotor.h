@@ -87,10 +87,11 @@ public:
   ~FGBrushLessDCMotor();
 
   void Calculate(void);
+  void SyncState(FGSnapshot& snapshot) override;
   double GetPowerAvailable(void) {return (HP * hptoftlbssec);}
   double CalcFuelNeed(void) { return 0.; }
   std::string GetEngineLabels(const std::string& delimiter);
-  std::string GetEngineValues(const std::string& delimiter);
+  void GetEngineValues(std::ostream& out, const std::string& delimiter);
 
 private:
   double ZeroTorqueCurrent; // Zero torque current [A]
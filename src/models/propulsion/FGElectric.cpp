@@ -46,6 +46,7 @@ INCLUDES
 #include "FGElectric.h"
 #include "FGPropeller.h"
 #include "input_output/FGXMLElement.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -126,14 +127,19 @@ string FGElectric::GetEngineLabels(const string& delimiter)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-string FGElectric::GetEngineValues(const string& delimiter)
+void FGElectric::GetEngineValues(ostream& out, const string& delimiter)
 {
-  std::ostringstream buf;
+  out << HP << delimiter;
+  Thruster->GetThrusterValues(EngineNumber, out, delimiter);
+}
 
-  buf << HP << delimiter
-     << Thruster->GetThrusterValues(EngineNumber, delimiter);
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-  return buf.str();
+void FGElectric::SyncState(FGSnapshot& snapshot)
+{
+  FGEngine::SyncState(snapshot);
+  snapshot.Sync(RPM);
+  snapshot.Sync(HP);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
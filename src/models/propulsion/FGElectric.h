@@ -73,10 +73,11 @@ public:
   ~FGElectric();
 
   void Calculate(void);
+  void SyncState(FGSnapshot& snapshot) override;
   double GetPowerAvailable(void) {return (HP * hptoftlbssec);}
   double getRPM(void) {return RPM;}
   std::string GetEngineLabels(const std::string& delimiter);
-  std::string GetEngineValues(const std::string& delimiter);
+  void GetEngineValues(std::ostream& out, const std::string& delimiter);
 
 private:
 
@@ -43,6 +43,7 @@ INCLUDES
 #include "FGNozzle.h"
 #include "FGRotor.h"
 #include "input_output/FGXMLElement.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -241,6 +242,26 @@ bool FGEngine::Load(FGFDMExec *exec, Element *engine_element)
   return true;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGEngine::SyncState(FGSnapshot& snapshot)
+{
+  SyncFunctions(snapshot);
+  snapshot.Sync(FuelExpended);
+  snapshot.Sync(FuelFlowRate);
+  snapshot.Sync(PctPower);
+  snapshot.Sync(Starter);
+  snapshot.Sync(Starved);
+  snapshot.Sync(Running);
+  snapshot.Sync(Cranking);
+  snapshot.Sync(FuelFreeze);
+  snapshot.Sync(FuelFlow_gph);
+  snapshot.Sync(FuelFlow_pph);
+  snapshot.Sync(FuelUsedLbs);
+  snapshot.Sync(FuelDensity);
+  Thruster->SyncState(snapshot);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -168,6 +168,11 @@ public:
   /** Resets the Engine parameters to the initial conditions */
   virtual void ResetToIC(void);
 
+  /** Saves or restores the state of the engine and of its thruster (see
+      FGFDMExec::SaveSnapshot). The derived classes must call the method of
+      their base class. */
+  virtual void SyncState(FGSnapshot& snapshot);
+
   /** Calculates the thrust of the engine, and other engine functions. */
   virtual void Calculate(void) = 0;
 
@@ -193,7 +198,7 @@ public:
   size_t GetNumSourceTanks() const {return SourceTanks.size();}
 
   virtual std::string GetEngineLabels(const std::string& delimiter) = 0;
-  virtual std::string GetEngineValues(const std::string& delimiter) = 0;
+  virtual void GetEngineValues(std::ostream& out, const std::string& delimiter) = 0;
 
   struct Inputs& in;
   void LoadThrusterInputs();
@@ -42,6 +42,7 @@ moments due to the difference between the point of application and the cg.
 #include "FGForce.h"
 #include "FGFDMExec.h"
 #include "models/FGAuxiliary.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -154,6 +155,20 @@ void FGForce::SetAnglesToBody(double broll, double bpitch, double byaw)
   }
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGForce::SyncState(FGSnapshot& snapshot)
+{
+  snapshot.Sync(vFn);
+  snapshot.Sync(vMn);
+  snapshot.Sync(vOrient);
+  snapshot.Sync(vXYZn);
+  snapshot.Sync(vActingXYZn);
+  snapshot.Sync(mT);
+  snapshot.Sync(vFb);
+  snapshot.Sync(vM);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
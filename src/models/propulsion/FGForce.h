@@ -68,6 +68,7 @@ FORWARD DECLARATIONS
 namespace JSBSim {
 
 class FGFDMExec;
+class FGSnapshot;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
@@ -231,6 +232,10 @@ public:
 
   virtual const FGColumnVector3& GetBodyForces(void);
 
+  /** Saves or restores the state of the force (see FGFDMExec::SaveSnapshot).
+      The derived classes must call the method of their base class. */
+  virtual void SyncState(FGSnapshot& snapshot);
+
   inline double GetBodyXForce(void) const { return vFb(eX); }
   inline double GetBodyYForce(void) const { return vFb(eY); }
   inline double GetBodyZForce(void) const { return vFb(eZ); }
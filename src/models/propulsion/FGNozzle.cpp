@@ -99,13 +99,9 @@ string FGNozzle::GetThrusterLabels(int id, const string& delimeter)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-string FGNozzle::GetThrusterValues(int id, const string& delimeter)
+void FGNozzle::GetThrusterValues(int id, ostream& out, const string& delimeter)
 {
-  std::ostringstream buf;
-
-  buf << Thrust;
-
-  return buf.str();
+  out << Thrust;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
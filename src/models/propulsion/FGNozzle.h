@@ -84,7 +84,7 @@ public:
 
   double Calculate(double vacThrust);
   std::string GetThrusterLabels(int id, const std::string& delimeter);
-  std::string GetThrusterValues(int id, const std::string& delimeter);
+  void GetThrusterValues(int id, std::ostream& out, const std::string& delimeter);
 
 private:
 //  double PE;
@@ -47,6 +47,7 @@ INCLUDES
 #include "FGPiston.h"
 #include "FGPropeller.h"
 #include "input_output/FGXMLElement.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -984,15 +985,59 @@ string FGPiston::GetEngineLabels(const string& delimiter)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-string FGPiston::GetEngineValues(const string& delimiter)
+void FGPiston::GetEngineValues(ostream& out, const string& delimiter)
 {
-  std::ostringstream buf;
+  out << (HP * hptoftlbssec) << delimiter << HP << delimiter
+      << equivalence_ratio << delimiter << ManifoldPressure_inHg << delimiter;
+  Thruster->GetThrusterValues(EngineNumber, out, delimiter);
+}
 
-  buf << (HP * hptoftlbssec) << delimiter << HP << delimiter
-      << equivalence_ratio << delimiter << ManifoldPressure_inHg << delimiter
-      << Thruster->GetThrusterValues(EngineNumber, delimiter);
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-  return buf.str();
+void FGPiston::SyncState(FGSnapshot& snapshot)
+{
+  FGEngine::SyncState(snapshot);
+  snapshot.Sync(crank_counter);
+  snapshot.Sync(IndicatedHorsePower);
+  snapshot.Sync(PMEP);
+  snapshot.Sync(FMEP);
+  snapshot.Sync(FMEPDynamic);
+  snapshot.Sync(FMEPStatic);
+  snapshot.Sync(StaticFriction_HP);
+  snapshot.Sync(StarterGain);
+  snapshot.Sync(Z_airbox);
+  snapshot.Sync(Ram_Air_Factor);
+  snapshot.Sync(BoostSpeed);
+  snapshot.Sync(BoostLossFactor);
+  snapshot.Sync(MAP);
+  snapshot.Sync(TMAP);
+  snapshot.Sync(ISFC);
+  snapshot.Sync(p_amb);
+  snapshot.Sync(p_ram);
+  snapshot.Sync(T_amb);
+  snapshot.Sync(RPM);
+  snapshot.Sync(IAS);
+  snapshot.Sync(Cooling_Factor);
+  snapshot.Sync(Magneto_Left);
+  snapshot.Sync(Magneto_Right);
+  snapshot.Sync(Magnetos);
+  snapshot.Sync(rho_air);
+  snapshot.Sync(volumetric_efficiency);
+  snapshot.Sync(volumetric_efficiency_reduced);
+  snapshot.Sync(m_dot_air);
+  snapshot.Sync(v_dot_air);
+  snapshot.Sync(equivalence_ratio);
+  snapshot.Sync(m_dot_fuel);
+  snapshot.Sync(HP);
+  snapshot.Sync(BoostLossHP);
+  snapshot.Sync(combustion_efficiency);
+  snapshot.Sync(ExhaustGasTemp_degK);
+  snapshot.Sync(EGT_degC);
+  snapshot.Sync(ManifoldPressure_inHg);
+  snapshot.Sync(CylinderHeadTemp_degK);
+  snapshot.Sync(OilPressure_psi);
+  snapshot.Sync(OilTemp_degK);
+  snapshot.Sync(MeanPistonSpeed_fps);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
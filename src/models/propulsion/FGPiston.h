@@ -229,9 +229,10 @@ public:
   ~FGPiston();
 
   std::string GetEngineLabels(const std::string& delimiter);
-  std::string GetEngineValues(const std::string& delimiter);
+  void GetEngineValues(std::ostream& out, const std::string& delimiter);
 
   void Calculate(void);
+  void SyncState(FGSnapshot& snapshot) override;
   double GetPowerAvailable(void) const {return (HP * hptoftlbssec);}
   double CalcFuelNeed(void);
 
@@ -41,6 +41,7 @@ INCLUDES
 #include "FGFDMExec.h"
 #include "FGPropeller.h"
 #include "input_output/FGXMLElement.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -398,20 +399,38 @@ string FGPropeller::GetThrusterLabels(int id, const string& delimeter)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-string FGPropeller::GetThrusterValues(int id, const string& delimeter)
+void FGPropeller::GetThrusterValues(int id, ostream& out, const string& delimeter)
 {
-  std::ostringstream buf;
-
   FGColumnVector3 vPFactor = GetPFactor();
-  buf << vTorque(eX) << delimeter
+  out << vTorque(eX) << delimeter
       << vPFactor(ePitch) << delimeter
       << vPFactor(eYaw) << delimeter
       << Thrust << delimeter;
   if (IsVPitch())
-    buf << Pitch << delimeter;
-  buf << RPM;
+    out << Pitch << delimeter;
+  out << RPM;
+}
 
-  return buf.str();
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropeller::SyncState(FGSnapshot& snapshot)
+{
+  FGThruster::SyncState(snapshot);
+  snapshot.Sync(J);
+  snapshot.Sync(RPM);
+  snapshot.Sync(Pitch);
+  snapshot.Sync(Advance);
+  snapshot.Sync(ExcessTorque);
+  snapshot.Sync(HelicalTipMach);
+  snapshot.Sync(Vinduced);
+  snapshot.Sync(vTorque);
+  snapshot.Sync(CtFactor);
+  snapshot.Sync(CpFactor);
+  snapshot.Sync(ConstantSpeed);
+  snapshot.Sync(Reversed);
+  snapshot.Sync(Reverse_coef);
+  snapshot.Sync(Feathered);
+  snapshot.Sync(Sense);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
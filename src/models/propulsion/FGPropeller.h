@@ -277,12 +277,13 @@ public:
       would be slowed.
       @return the thrust in pounds */
   double Calculate(double EnginePower);
+  void SyncState(FGSnapshot& snapshot) override;
   /// Retrieves the P-Factor constant
   FGColumnVector3 GetPFactor(void) const;
   /// Generate the labels for the thruster standard CSV output
   std::string GetThrusterLabels(int id, const std::string& delimeter);
   /// Generate the values for the thruster standard CSV output
-  std::string GetThrusterValues(int id, const std::string& delimeter);
+  void GetThrusterValues(int id, std::ostream& out, const std::string& delimeter);
   /** Set the propeller reverse pitch.
       @param c the reverse pitch command in percent (0.0 - 1.0)
   */
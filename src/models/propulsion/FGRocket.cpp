@@ -42,6 +42,7 @@ INCLUDES
 #include "FGRocket.h"
 #include "FGThruster.h"
 #include "input_output/FGXMLElement.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -320,17 +321,15 @@ string FGRocket::GetEngineLabels(const string& delimiter)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-string FGRocket::GetEngineValues(const string& delimiter)
+void FGRocket::GetEngineValues(ostream& out, const string& delimiter)
 {
-  std::ostringstream buf;
-
-  buf << It << delimiter 
-      << ItVac << delimiter 
-      << GetMoments().Dump(delimiter) << delimiter
-      << Thruster->GetBodyForces().Dump(delimiter) << delimiter
-      << Thruster->GetThrusterValues(EngineNumber, delimiter);
-
-  return buf.str();
+  out << It << delimiter
+      << ItVac << delimiter;
+  GetMoments().Dump(out, delimiter);
+  out << delimiter;
+  Thruster->GetBodyForces().Dump(out, delimiter);
+  out << delimiter;
+  Thruster->GetThrusterValues(EngineNumber, out, delimiter);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -370,6 +369,29 @@ void FGRocket::bindmodel(FGPropertyManager* PropertyManager)
   }
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGRocket::SyncState(FGSnapshot& snapshot)
+{
+  FGEngine::SyncState(snapshot);
+  snapshot.Sync(Isp);
+  snapshot.Sync(It);
+  snapshot.Sync(ItVac);
+  snapshot.Sync(MxR);
+  snapshot.Sync(BurnTime);
+  snapshot.Sync(ThrustVariation);
+  snapshot.Sync(TotalIspVariation);
+  snapshot.Sync(VacThrust);
+  snapshot.Sync(previousFuelNeedPerTank);
+  snapshot.Sync(previousOxiNeedPerTank);
+  snapshot.Sync(OxidizerExpended);
+  snapshot.Sync(TotalPropellantExpended);
+  snapshot.Sync(OxidizerFlowRate);
+  snapshot.Sync(PropellantFlowRate);
+  snapshot.Sync(Flameout);
+  snapshot.Sync(BuildupTime);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
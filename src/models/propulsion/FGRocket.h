@@ -136,6 +136,7 @@ public:
 
   /** Determines the thrust.*/
   void Calculate(void);
+  void SyncState(FGSnapshot& snapshot) override;
 
   /** The fuel need is calculated based on power levels and flow rate for that
       power level. It is also turned from a rate into an actual amount (pounds)
@@ -176,7 +177,7 @@ public:
   void SetIsp(double isp) {Isp = isp;}
 
   std::string GetEngineLabels(const std::string& delimiter);
-  std::string GetEngineValues(const std::string& delimiter);
+  void GetEngineValues(std::ostream& out, const std::string& delimiter);
 
   /** Sets the thrust variation for a solid rocket engine. 
       Solid propellant rocket motor thrust characteristics are typically
@@ -50,6 +50,7 @@ INCLUDES
 #include "models/FGMassBalance.h"
 #include "models/FGPropulsion.h" // to get the GearRatio from a linked rotor
 #include "input_output/FGXMLElement.h"
+#include "input_output/FGSnapshot.h"
 
 using std::cerr;
 using std::cout;
@@ -798,15 +799,42 @@ string FGRotor::GetThrusterLabels(int id, const string& delimeter)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-string FGRotor::GetThrusterValues(int id, const string& delimeter)
+void FGRotor::GetThrusterValues(int id, ostream& out, const string& delimeter)
 {
+  out << RPM;
+}
 
-  ostringstream buf;
-
-  buf << RPM;
-
-  return buf.str();
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGRotor::SyncState(FGSnapshot& snapshot)
+{
+  FGThruster::SyncState(snapshot);
+  snapshot.Sync(rho);
+  snapshot.Sync(GroundEffectScaleNorm);
+  snapshot.Sync(RPM);
+  snapshot.Sync(Omega);
+  snapshot.Sync(a0);
+  snapshot.Sync(a_1);
+  snapshot.Sync(b_1);
+  snapshot.Sync(a_dw);
+  snapshot.Sync(a1s);
+  snapshot.Sync(b1s);
+  snapshot.Sync(H_drag);
+  snapshot.Sync(J_side);
+  snapshot.Sync(Torque);
+  snapshot.Sync(C_T);
+  snapshot.Sync(lambda);
+  snapshot.Sync(mu);
+  snapshot.Sync(nu);
+  snapshot.Sync(v_induced);
+  snapshot.Sync(theta_downwash);
+  snapshot.Sync(phi_downwash);
+  snapshot.Sync(CollectiveCtrl);
+  snapshot.Sync(LateralCtrl);
+  snapshot.Sync(LongitudinalCtrl);
+  snapshot.Sync(EngineRPM);
+  damp_hagl.SyncState(snapshot);
+  if (Transmission) Transmission->SyncState(snapshot);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -252,6 +252,7 @@ public:
 
   /// Returns the scalar thrust of the rotor, and adjusts the RPM value.
   double Calculate(double EnginePower);
+  void SyncState(FGSnapshot& snapshot) override;
 
 
   /// Retrieves the RPMs of the rotor.
@@ -312,7 +313,7 @@ public:
 
   // Stubs. Only main rotor RPM is returned
   std::string GetThrusterLabels(int id, const std::string& delimeter);
-  std::string GetThrusterValues(int id, const std::string& delimeter);
+  void GetThrusterValues(int id, std::ostream& out, const std::string& delimeter);
 
 private:
 
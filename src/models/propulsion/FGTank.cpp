@@ -39,6 +39,7 @@ INCLUDES
 #include "FGTank.h"
 #include "FGFDMExec.h"
 #include "input_output/FGXMLElement.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -501,6 +502,31 @@ void FGTank::bind(FGPropertyManager* PropertyManager)
 
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTank::SyncState(FGSnapshot& snapshot)
+{
+  snapshot.Sync(vXYZ);
+  snapshot.Sync(Capacity);
+  snapshot.Sync(UnusableVol);
+  snapshot.Sync(Radius);
+  snapshot.Sync(InnerRadius);
+  snapshot.Sync(Length);
+  snapshot.Sync(Volume);
+  snapshot.Sync(Density);
+  snapshot.Sync(Ixx);
+  snapshot.Sync(Iyy);
+  snapshot.Sync(Izz);
+  snapshot.Sync(PctFull);
+  snapshot.Sync(Contents);
+  snapshot.Sync(Area);
+  snapshot.Sync(Temperature);
+  snapshot.Sync(Standpipe);
+  snapshot.Sync(ExternalFlow);
+  snapshot.Sync(Selected);
+  snapshot.Sync(Priority);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -245,6 +245,9 @@ public:
   /** Resets the tank parameters to the initial conditions */
   void ResetToIC(void);
 
+  /// Saves or restores the state of the tank (see FGFDMExec::SaveSnapshot).
+  void SyncState(FGSnapshot& snapshot);
+
   /** If the tank is set to supply fuel, this function returns true.
       @return true if this tank is set to a non-zero priority.*/
   bool GetSelected(void) const {return Selected;}
@@ -42,6 +42,7 @@ INCLUDES
 #include "input_output/FGPropertyManager.h"
 #include "FGThruster.h"
 #include "input_output/FGXMLElement.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -145,13 +146,31 @@ string FGThruster::GetThrusterLabels(int id, const string& delimeter)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-string FGThruster::GetThrusterValues(int id, const string& delimeter)
+void FGThruster::GetThrusterValues(int id, ostream& out, const string& delimeter)
 {
-  std::ostringstream buf;
+  out << Thrust;
+}
 
-  buf << Thrust;
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-  return buf.str();
+void FGThruster::SyncState(FGSnapshot& snapshot)
+{
+  FGForce::SyncState(snapshot);
+  snapshot.Sync(in.TotalDeltaT);
+  snapshot.Sync(in.H_agl);
+  snapshot.Sync(in.PQRi);
+  snapshot.Sync(in.AeroPQR);
+  snapshot.Sync(in.AeroUVW);
+  snapshot.Sync(in.Density);
+  snapshot.Sync(in.Pressure);
+  snapshot.Sync(in.Soundspeed);
+  snapshot.Sync(in.Alpha);
+  snapshot.Sync(in.Beta);
+  snapshot.Sync(in.Vt);
+  snapshot.Sync(Thrust);
+  snapshot.Sync(PowerRequired);
+  snapshot.Sync(ThrustCoeff);
+  snapshot.Sync(ReverserAngle);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
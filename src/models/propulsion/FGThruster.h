@@ -102,9 +102,10 @@ public:
   virtual double GetEngineRPM(void) const { return 0.0; };
   double GetGearRatio(void) {return GearRatio; }
   virtual std::string GetThrusterLabels(int id, const std::string& delimeter);
-  virtual std::string GetThrusterValues(int id, const std::string& delimeter);
+  virtual void GetThrusterValues(int id, std::ostream& out, const std::string& delimeter);
 
   virtual void ResetToIC(void);
+  void SyncState(FGSnapshot& snapshot) override;
 
   struct Inputs {
     double TotalDeltaT;
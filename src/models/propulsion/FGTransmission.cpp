@@ -41,6 +41,7 @@ INCLUDES
 
 
 #include "FGTransmission.h"
+#include "input_output/FGSnapshot.h"
 
 using std::string;
 using std::cout;
@@ -155,6 +156,18 @@ bool FGTransmission::BindModel(int num, FGPropertyManager* PropertyManager)
   return true;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTransmission::SyncState(FGSnapshot& snapshot)
+{
+  snapshot.Sync(FreeWheelTransmission);
+  snapshot.Sync(ClutchCtrlNorm);
+  snapshot.Sync(BrakeCtrlNorm);
+  snapshot.Sync(EngineRPM);
+  snapshot.Sync(ThrusterRPM);
+  FreeWheelLag.SyncState(snapshot);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
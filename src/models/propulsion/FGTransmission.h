@@ -119,6 +119,9 @@ public:
 
   void Calculate(double EnginePower, double ThrusterTorque, double dt);
 
+  /// Saves or restores the state of the transmission.
+  void SyncState(FGSnapshot& snapshot);
+
   void   SetMaxBrakePower(double x) {MaxBrakePower=x;}
   double GetMaxBrakePower() const {return MaxBrakePower;}
   void   SetEngineFriction(double x) {EngineFriction=x;}
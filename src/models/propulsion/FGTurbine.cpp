@@ -48,6 +48,7 @@ INCLUDES
 #include "FGTurbine.h"
 #include "FGThruster.h"
 #include "input_output/FGXMLElement.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -543,15 +544,11 @@ string FGTurbine::GetEngineLabels(const string& delimiter)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-string FGTurbine::GetEngineValues(const string& delimiter)
+void FGTurbine::GetEngineValues(ostream& out, const string& delimiter)
 {
-  std::ostringstream buf;
-
-  buf << N1 << delimiter
-      << N2 << delimiter
-      << Thruster->GetThrusterValues(EngineNumber, delimiter);
-
-  return buf.str();
+  out << N1 << delimiter
+      << N2 << delimiter;
+  Thruster->GetThrusterValues(EngineNumber, out, delimiter);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -603,7 +600,10 @@ void FGTurbine::bindmodel(FGPropertyManager* PropertyManager)
 
 int FGTurbine::InitRunning(void)
 {
-  FDMExec->SuspendIntegration();
+  // Resuming an integration suspended by the caller would reset the time step
+  // to zero.
+  bool suspended = FDMExec->IntegrationSuspended();
+  if (!suspended) FDMExec->SuspendIntegration();
   Cutoff=false;
   Running=true;
   N1_factor = MaxN1 - IdleN1;
@@ -611,10 +611,48 @@ int FGTurbine::InitRunning(void)
   N2 = IdleN2 + ThrottlePos * N2_factor;
   N1 = IdleN1 + ThrottlePos * N1_factor;
   Calculate();
-  FDMExec->ResumeIntegration();
+  if (!suspended) FDMExec->ResumeIntegration();
   return phase=tpRun;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTurbine::SyncState(FGSnapshot& snapshot)
+{
+  FGEngine::SyncState(snapshot);
+  snapshot.Sync(phase);
+  snapshot.Sync(N1);
+  snapshot.Sync(N2);
+  snapshot.Sync(N2norm);
+  snapshot.Sync(MaxN1);
+  snapshot.Sync(MaxN2);
+  snapshot.Sync(ThrottlePos);
+  snapshot.Sync(AugmentCmd);
+  snapshot.Sync(Stalled);
+  snapshot.Sync(Seized);
+  snapshot.Sync(Overtemp);
+  snapshot.Sync(Fire);
+  snapshot.Sync(Injection);
+  snapshot.Sync(Augmentation);
+  snapshot.Sync(Reversed);
+  snapshot.Sync(Cutoff);
+  snapshot.Sync(disableWindmill);
+  snapshot.Sync(Ignition);
+  snapshot.Sync(AugMethod);
+  snapshot.Sync(EGT_degC);
+  snapshot.Sync(EPR);
+  snapshot.Sync(OilPressure_psi);
+  snapshot.Sync(OilTemp_degK);
+  snapshot.Sync(BleedDemand);
+  snapshot.Sync(InletPosition);
+  snapshot.Sync(NozzlePosition);
+  snapshot.Sync(correctedTSFC);
+  snapshot.Sync(InjectionTimer);
+  snapshot.Sync(InjWaterNorm);
+  snapshot.Sync(InjN1increment);
+  snapshot.Sync(InjN2increment);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
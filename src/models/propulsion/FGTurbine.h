@@ -182,6 +182,7 @@ public:
   enum phaseType { tpOff, tpRun, tpSpinUp, tpStart, tpStall, tpSeize, tpTrim };
 
   void Calculate(void);
+  void SyncState(FGSnapshot& snapshot) override;
   double CalcFuelNeed(void);
   double GetPowerAvailable(void);
   /** A lag filter.
@@ -238,7 +239,7 @@ public:
   void ResetToIC(void);
 
   std::string GetEngineLabels(const std::string& delimiter);
-  std::string GetEngineValues(const std::string& delimiter);
+  void GetEngineValues(std::ostream& out, const std::string& delimiter);
 
 private:
 
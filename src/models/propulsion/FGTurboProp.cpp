@@ -50,6 +50,7 @@ INCLUDES
 #include "FGRotor.h"
 #include "math/FGFunction.h"
 #include "input_output/FGXMLElement.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -503,15 +504,11 @@ string FGTurboProp::GetEngineLabels(const string& delimiter)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-string FGTurboProp::GetEngineValues(const string& delimiter)
+void FGTurboProp::GetEngineValues(ostream& out, const string& delimiter)
 {
-  std::ostringstream buf;
-
-  buf << N1 << delimiter
-      << HP << delimiter
-      << Thruster->GetThrusterValues(EngineNumber,delimiter);
-
-  return buf.str();
+  out << N1 << delimiter
+      << HP << delimiter;
+  Thruster->GetThrusterValues(EngineNumber, out, delimiter);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -549,6 +546,31 @@ void FGTurboProp::bindmodel(FGPropertyManager* PropertyManager)
   PropertyManager->Tie( property_name.c_str(), &CombustionEfficiency);
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTurboProp::SyncState(FGSnapshot& snapshot)
+{
+  FGEngine::SyncState(snapshot);
+  snapshot.Sync(phase);
+  snapshot.Sync(N1);
+  snapshot.Sync(ThrottlePos);
+  snapshot.Sync(Reversed);
+  snapshot.Sync(Cutoff);
+  snapshot.Sync(OilPressure_psi);
+  snapshot.Sync(OilTemp_degK);
+  snapshot.Sync(Ielu_intervent);
+  snapshot.Sync(OldThrottle);
+  snapshot.Sync(RPM);
+  snapshot.Sync(CombustionEfficiency);
+  snapshot.Sync(HP);
+  snapshot.Sync(StartTime);
+  snapshot.Sync(Eng_ITT_degC);
+  snapshot.Sync(Eng_Temperature);
+  snapshot.Sync(EngStarting);
+  snapshot.Sync(GeneratorPower);
+  snapshot.Sync(Condition);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -101,6 +101,7 @@ public:
   enum phaseType { tpOff, tpRun, tpSpinUp, tpStart, tpTrim };
 
   void Calculate(void);
+  void SyncState(FGSnapshot& snapshot) override;
   double CalcFuelNeed(void);
 
   double GetPowerAvailable(void) const { return (HP * hptoftlbssec); }
@@ -134,7 +135,7 @@ public:
   inline void SetCondition(bool c) { Condition=c; }
   int InitRunning(void);
   std::string GetEngineLabels(const std::string& delimiter);
-  std::string GetEngineValues(const std::string& delimiter);
+  void GetEngineValues(std::ostream& out, const std::string& delimiter);
 
 private:
 
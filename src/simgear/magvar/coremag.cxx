@@ -158,15 +158,17 @@ static double htnm_wmm2005[13][13]=
 
 static const int nmax = 12;
 
-static double P[13][13];
-static double DP[13][13];
-static double gnm[13][13];
-static double hnm[13][13];
-static double sm[13];
-static double cm[13];
-
-static double root[13];
-static double roots[13][13][2];
+// Scratch arrays of calc_magvar(). They are thread local so that several
+// simulations can compute the magnetic field concurrently.
+static thread_local double P[13][13];
+static thread_local double DP[13][13];
+static thread_local double gnm[13][13];
+static thread_local double hnm[13][13];
+static thread_local double sm[13];
+static thread_local double cm[13];
+
+static thread_local double root[13];
+static thread_local double roots[13][13][2];
 
 /* Convert date to Julian day    1950-2049 */
 unsigned long int yymmdd_to_julian_days( int yy, int mm, int dd )
@@ -199,7 +201,7 @@ double calc_magvar( double lat, double lon, double h, long dat, double* field )
     double yearfrac,sr,r,theta,c,s,psi,fn,fn_0,B_r,B_theta,B_phi,X,Y,Z;
     double sinpsi, cospsi, inv_s;
 
-    static int been_here = 0;
+    static thread_local int been_here = 0;
 
     double sinlat = sin(lat);
     double coslat = cos(lat);
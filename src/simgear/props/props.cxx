@@ -619,6 +619,7 @@ SGPropertyNode::set_bool (bool val)
       return false;
     }
   } else {
+    if (_local_val.bool_val != val) ++_version;
     _local_val.bool_val = val;
     fireValueChanged();
     return true;
@@ -636,6 +637,7 @@ SGPropertyNode::set_int (int val)
       return false;
     }
   } else {
+    if (_local_val.int_val != val) ++_version;
     _local_val.int_val = val;
     fireValueChanged();
     return true;
@@ -653,6 +655,7 @@ SGPropertyNode::set_long (long val)
       return false;
     }
   } else {
+    if (_local_val.long_val != val) ++_version;
     _local_val.long_val = val;
     fireValueChanged();
     return true;
@@ -670,6 +673,7 @@ SGPropertyNode::set_float (float val)
       return false;
     }
   } else {
+    if (memcmp(&_local_val.float_val, &val, sizeof(val)) != 0) ++_version;
     _local_val.float_val = val;
     fireValueChanged();
     return true;
@@ -687,6 +691,7 @@ SGPropertyNode::set_double (double val)
       return false;
     }
   } else {
+    if (memcmp(&_local_val.double_val, &val, sizeof(val)) != 0) ++_version;
     _local_val.double_val = val;
     fireValueChanged();
     return true;
@@ -706,6 +711,7 @@ SGPropertyNode::set_string (const char * val)
   } else {
     delete [] _local_val.string_val;
     _local_val.string_val = copy_string(val);
+    ++_version;
     fireValueChanged();
     return true;
   }
@@ -749,6 +755,8 @@ SGPropertyNode::clearValue ()
     }
     _tied = false;
     _type = props::NONE;
+    _direct = nullptr;
+    ++_version;
 }
 
 
@@ -874,6 +882,7 @@ SGPropertyNode::SGPropertyNode (const SGPropertyNode &node)
   }
   if (_tied || _type == props::EXTENDED) {
     _value.val = node._value.val->clone();
+    update_direct();
     return;
   }
   switch (_type) {
@@ -899,6 +908,7 @@ SGPropertyNode::SGPropertyNode (const SGPropertyNode &node)
   default:
     break;
   }
+  update_direct();
 }
 
 
@@ -1437,8 +1447,30 @@ SGPropertyNode::getFloatValue () const
   }
 }
 
+/**
+ * Locate the storage of a readable double value. Any other node is read
+ * through get_double_value(). The location is updated by the methods that
+ * change the type, the attributes or the binding of the node so that
+ * getDoubleValue() only reads the node and can be called concurrently.
+ */
+void
+SGPropertyNode::update_direct ()
+{
+  _direct = nullptr;
+
+  if (_type != props::DOUBLE || (_attr & (READ|TRACE_READ)) != READ)
+    return;
+
+  if (!_tied)
+    _direct = &_local_val.double_val;
+  else {
+    auto ptr = dynamic_cast<const SGRawValuePointer<double>*>(_value.val);
+    if (ptr) _direct = ptr->getPointer();
+  }
+}
+
 double 
-SGPropertyNode::getDoubleValue () const
+SGPropertyNode::get_double_value () const
 {
 				// Shortcut for common case
   if (_attr == (READ|WRITE) && _type == props::DOUBLE)
@@ -1699,6 +1731,7 @@ SGPropertyNode::setDoubleValue (double value)
     clearValue();
     _local_val.double_val = value;
     _type = props::DOUBLE;
+    update_direct();
   }
 
   switch (_type) {
@@ -2026,6 +2059,8 @@ SGPropertyNode::untie ()
   }
 
   _tied = false;
+  update_direct();
+  ++_version;
   return true;
 }
 
@@ -456,6 +456,11 @@ public:
     return new SGRawValuePointer(_ptr);
   }
 
+  /**
+   * Get the pointer to the variable.
+   */
+  T * getPointer () const { return _ptr; }
+
 private:
   T * _ptr;
 };
@@ -1139,6 +1144,7 @@ public:
    */
   void setAttribute (Attribute attr, bool state) {
     (state ? _attr |= attr : _attr &= ~attr);
+    update_direct();
   }
 
 
@@ -1151,7 +1157,7 @@ public:
   /**
    * Set all of the mode attributes for the property node.
    */
-  void setAttributes (int attr) { _attr = attr; }
+  void setAttributes (int attr) { _attr = attr; update_direct(); }
   
 
   //
@@ -1191,8 +1197,15 @@ public:
 
   /**
    * Get a double value for this node.
+   *
+   * When the node holds a readable double that is either stored locally or
+   * tied to a pointer, the value is loaded directly from where it is stored
+   * without going through the raw value.
    */
-  double getDoubleValue () const;
+  double getDoubleValue () const
+  {
+    return _direct ? *_direct : get_double_value();
+  }
 
 
   /**
@@ -1357,6 +1370,21 @@ public:
    */
   bool isTied () const { return _tied; }
 
+  /**
+   * Test whether the value is stored in this node, i.e. whether the node is
+   * neither tied nor an alias. Only then does getVersion() track the changes
+   * of its value.
+   */
+  bool hasLocalValue () const
+  { return !_tied && _type != simgear::props::ALIAS; }
+
+  /**
+   * Get a counter that is incremented each time the value stored in this
+   * node changes. Writing the value that is already stored does not increment
+   * the counter.
+   */
+  unsigned long getVersion () const { return _version; }
+
     /**
      * Bind this node to an external source.
      */
@@ -1793,6 +1821,8 @@ private:
    * Trace a write access.
    */
   void trace_write () const;
+  double get_double_value () const;
+  void update_direct ();
 
   int _index;
   std::string _name;
@@ -1804,6 +1834,9 @@ private:
   simgear::props::Type _type;
   bool _tied;
   int _attr;
+  unsigned long _version = 0;
+  // Location of the value read by getDoubleValue() (see update_direct()).
+  const double* _direct = nullptr;
 
   // The right kind of pointer...
   union {
@@ -1981,6 +2014,7 @@ bool SGPropertyNode::tie(const SGRawValue<T> &rawValue, bool useDefault)
         _type = EXTENDED;
     _tied = true;
     _value.val = rawValue.clone();
+    update_direct();
     if (useDefault) {
         int save_attributes = getAttributes();
         setAttribute( WRITE, true );
@@ -0,0 +1,212 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       bin2csv.cpp
+ Author:       Dawn Aerospace
+ Date started: October 2026
+ Purpose:      JSBSim binary output -> CSV conversion tool
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+
+bin2csv
+-------
+
+Input:
+
+A file written by the BINARY output type of JSBSim (see FGBinaryRecord.h for
+the description of the format).
+
+Output:
+
+The records are written in comma-separated value (CSV) format with the same
+header and precision as the CSV output of JSBSim so that the result can be fed
+to prep_plot. Floats are written with the 9 digits needed to restore them
+exactly. The output goes to standard out unless an output file name is
+given.
+
+Compiling:
+
+g++ bin2csv.cpp -o bin2csv
+
+Usage:
+
+bin2csv <filename.bin> [<filename.csv>] [--units]
+
+The --units option appends the unit of each column to its name in the header,
+e.g. "position/h-sl-ft (ft)".
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+struct Column {
+  char type;
+  string name;
+  string unit;
+};
+
+// The numbers are stored in little endian order whatever the platform.
+static uint64_t ReadLittleEndian(const unsigned char* data, size_t size)
+{
+  uint64_t value = 0;
+  for (size_t i=0; i<size; ++i)
+    value |= static_cast<uint64_t>(data[i]) << (8*i);
+  return value;
+}
+
+static double ReadValue(const unsigned char* data, char type)
+{
+  if (type == 'f') {
+    uint32_t bits = static_cast<uint32_t>(ReadLittleEndian(data, 4));
+    float value;
+    memcpy(&value, &bits, 4);
+    return value;
+  }
+
+  uint64_t bits = ReadLittleEndian(data, 8);
+  double value;
+  memcpy(&value, &bits, 8);
+  return value;
+}
+
+static bool ReadString(const vector<unsigned char>& header, size_t& pos,
+                       string& s)
+{
+  if (pos + 2 > header.size()) return false;
+  size_t length = ReadLittleEndian(&header[pos], 2);
+  pos += 2;
+  if (pos + length > header.size()) return false;
+  s.assign(reinterpret_cast<const char*>(&header[pos]), length);
+  pos += length;
+  return true;
+}
+
+int main(int argc, char** argv)
+{
+  string input, output;
+  bool units = false;
+
+  for (int i=1; i<argc; ++i) {
+    string arg = argv[i];
+    if (arg == "--units")
+      units = true;
+    else if (input.empty())
+      input = arg;
+    else
+      output = arg;
+  }
+
+  if (input.empty()) {
+    cerr << "Usage: bin2csv <filename.bin> [<filename.csv>] [--units]" << endl;
+    return 1;
+  }
+
+  ifstream infile(input.c_str(), ios::in | ios::binary);
+  if (!infile) {
+    cerr << "Unable to open the file " << input << endl;
+    return 1;
+  }
+
+  unsigned char prefix[24];
+  if (!infile.read(reinterpret_cast<char*>(prefix), 24)
+      || memcmp(prefix, "JSBSBIN", 8) != 0) {
+    cerr << input << " is not a JSBSim binary output file" << endl;
+    return 1;
+  }
+
+  uint32_t version = ReadLittleEndian(&prefix[8], 4);
+  uint32_t headerSize = ReadLittleEndian(&prefix[12], 4);
+  uint32_t recordSize = ReadLittleEndian(&prefix[16], 4);
+  uint32_t numColumns = ReadLittleEndian(&prefix[20], 4);
+
+  if (version != 1) {
+    cerr << "Unsupported version " << version << " of the binary format" << endl;
+    return 1;
+  }
+
+  vector<unsigned char> header(headerSize);
+  memcpy(header.data(), prefix, 24);
+  if (!infile.read(reinterpret_cast<char*>(&header[24]), headerSize-24)) {
+    cerr << "The header of " << input << " is truncated" << endl;
+    return 1;
+  }
+
+  vector<Column> columns(numColumns);
+  size_t pos = 24;
+  for (auto& column: columns) {
+    if (pos >= header.size()) {
+      cerr << "The header of " << input << " is corrupted" << endl;
+      return 1;
+    }
+    column.type = header[pos++];
+    if (!ReadString(header, pos, column.name)
+        || !ReadString(header, pos, column.unit)) {
+      cerr << "The header of " << input << " is corrupted" << endl;
+      return 1;
+    }
+  }
+
+  ofstream outfile;
+  if (!output.empty()) {
+    outfile.open(output.c_str());
+    if (!outfile) {
+      cerr << "Unable to open the file " << output << endl;
+      return 1;
+    }
+  }
+  ostream& out = output.empty() ? cout : outfile;
+
+  for (size_t i=0; i<columns.size(); ++i) {
+    if (i > 0) out << ",";
+    out << columns[i].name;
+    if (units && !columns[i].unit.empty())
+      out << " (" << columns[i].unit << ")";
+  }
+  out << endl;
+
+  vector<unsigned char> record(recordSize);
+  while (infile.read(reinterpret_cast<char*>(record.data()), recordSize)) {
+    size_t offset = 0;
+    for (size_t i=0; i<columns.size(); ++i) {
+      // Same precisions as FGOutputTextFile: 10 digits for the time and 18
+      // digits for the properties.
+      if (i > 0) {
+        out << ",";
+        out.precision(columns[i].type == 'f' ? 9 : 18);
+      }
+      else
+        out.precision(10);
+      out << ReadValue(&record[offset], columns[i].type);
+      offset += columns[i].type == 'f' ? 4 : 8;
+    }
+    out << "\n";
+  }
+
+  return 0;
+}
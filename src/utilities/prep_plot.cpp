@@ -36,6 +36,11 @@ A data file in comma-separated value (CSV) format, with time in the first
 column. The data file is expected to be all numeric. That is, NaN will
 mess it up, I think.
 
+Files written by the COLUMNAR output type of JSBSim are also accepted. The
+records within the range given by --start and --end are extracted to a CSV
+file named after the input file (e.g. flight.col.csv) which is then plotted by
+gnuplot. Only the pages of the chunks within that range are read.
+
 Multiple files (currently up to 10) can be input to prep_plot provided
 the names of the files are all the same except for a digit. The digit
 is substituted for on the command line to prep_plot using the "#" character.
@@ -58,7 +63,7 @@ that is part of Ghostscript.
 
 Compiling:
 
-g++ prep_plot.cpp plotXMLVisitor.cpp ../simgear/xml/easyxml.cxx -I ../ -L ../simgear/xml/ -lExpat -o prep_plot.exe
+g++ prep_plot.cpp plotXMLVisitor.cpp ../simgear/xml/easyxml.cxx ../input_output/FGColumnarReader.cpp ../input_output/FGColumnarCodec.cpp -I ../ -L ../simgear/xml/ -lExpat -o prep_plot.exe
 
 These compiler options may produce a faster executable if your machines supports it:
 -O9 -march=nocona 
@@ -99,6 +104,7 @@ INCLUDES
 #include <cstdio>
 #include <cmath>
 #include "input_output/string_utilities.h"
+#include "input_output/FGColumnarReader.h"
 #include "plotXMLVisitor.h"
 
 using namespace std;
@@ -123,6 +129,8 @@ bool MakeArbitraryPlot(
   string Title,
   stringstream& plot);
 void PrintNames(const vector <string>&);
+bool ReadNames(const string&, string_array&);
+string ExtractColumnar(const string&, const string&, const string&);
 string itostr(int number)
 {
   stringstream ss;  // create a stringstream
@@ -132,12 +140,11 @@ string itostr(int number)
 
 int main(int argc, char **argv)
 {
-  string in_string, var_name, input_arg, supplied_title="";
+  string var_name, input_arg, supplied_title="";
   string outfile="";
   string_array plotspecfiles;
   string_array files;
   int ctr=1, next_comma=0, len=0, start=0, file_ctr=0;
-  ifstream infile2;
   char num[8];
   bool comprehensive=false;
   bool pdf=false;
@@ -179,13 +186,11 @@ int main(int argc, char **argv)
       new_filename=filename;
       sprintf(num,"%d",file_ctr);
       new_filename.replace(new_filename.find("#"),1,num);
-      infile2.open(new_filename.c_str());
-      if (!infile2.is_open()) {
+      string_array file_names;
+      if (!ReadNames(new_filename, file_names)) {
         break;
       } else {
-        getline(infile2, in_string, '\n');
-        NamesArray.push_back(split(in_string, ','));
-        infile2.close();
+        NamesArray.push_back(file_names);
         files.push_back(new_filename);
         file_ctr++;
       }
@@ -195,13 +200,11 @@ int main(int argc, char **argv)
     files.push_back(filename);
   }
 
-  ifstream infile(files[0].c_str());
-  if (!infile.is_open()) {
-    cerr << "Could not open file: " << files[0] << endl;
+  string_array names;
+  if (files.empty() || !ReadNames(files[0], names)) {
+    cerr << "Could not open file: " << filename << endl;
     exit(-1);
   }
-  getline(infile, in_string, '\n');
-  string_array names = split(in_string, ',');
   unsigned int num_names=names.size();
   
   // Read command line args
@@ -289,6 +292,12 @@ int main(int argc, char **argv)
     }
   }
 
+  // gnuplot only reads text files: extract the columnar files to CSV.
+  for (auto& file: files) {
+    string csv = ExtractColumnar(file, start_time, end_time);
+    if (!csv.empty()) file = csv;
+  }
+
   plot_range="";
   if (start_time.size() > 0 || end_time.size() > 0)
     plot_range = "["+start_time+":"+end_time+"]";
@@ -759,3 +768,81 @@ void PrintNames(const vector <string>& names)
     cout << "  " << i+1 << ":  " << names[i] << endl;
   }
 }
+
+// ############################################################################
+
+bool ReadNames(const string& filename, string_array& names)
+{
+  JSBSim::FGColumnarReader reader;
+  ifstream infile(filename.c_str(), ios::in | ios::binary);
+  char magic[8];
+
+  if (!infile.is_open()) return false;
+
+  if (infile.read(magic, 8) && string(magic, 8) == string("JSBSCOL", 8)) {
+    infile.close();
+    if (!reader.Open(filename)) return false;
+    names.clear();
+    for (unsigned int i=0; i<reader.GetNumColumns(); i++)
+      names.push_back(reader.GetColumnName(i));
+    return true;
+  }
+
+  string in_string;
+  infile.clear();
+  infile.seekg(0);
+  getline(infile, in_string, '\n');
+  names = split(in_string, ',');
+  return true;
+}
+
+// ############################################################################
+
+// Extracts the records of a columnar file between the times start and end to
+// a CSV file. Returns the name of the CSV file or an empty string if the file
+// is not a columnar file.
+string ExtractColumnar(const string& filename, const string& start,
+                       const string& end)
+{
+  ifstream infile(filename.c_str(), ios::in | ios::binary);
+  char magic[8];
+  if (!infile.read(magic, 8) || string(magic, 8) != string("JSBSCOL", 8))
+    return "";
+  infile.close();
+
+  JSBSim::FGColumnarReader reader;
+  if (!reader.Open(filename)) exit(-1);
+
+  double t0 = start.empty() ? -HUGE_VAL : atof(start.c_str());
+  double t1 = end.empty() ? HUGE_VAL : atof(end.c_str());
+  vector < vector <double> > columns(reader.GetNumColumns());
+
+  for (unsigned int i=0; i<columns.size(); i++) {
+    if (!reader.ReadColumn(i, columns[i], t0, t1)) exit(-1);
+  }
+
+  string csv = filename + ".csv";
+  ofstream outfile(csv.c_str());
+  if (!outfile.is_open()) {
+    cerr << "Could not open file: " << csv << endl;
+    exit(-1);
+  }
+
+  for (unsigned int i=0; i<columns.size(); i++) {
+    if (i > 0) outfile << ",";
+    outfile << reader.GetColumnName(i);
+  }
+  outfile << endl;
+
+  // Same precisions as the CSV output of JSBSim.
+  for (unsigned int r=0; r<columns[0].size(); r++) {
+    outfile.precision(10);
+    outfile << columns[0][r];
+    outfile.precision(18);
+    for (unsigned int i=1; i<columns.size(); i++)
+      outfile << "," << columns[i][r];
+    outfile << "\n";
+  }
+
+  return csv;
+}
@@ -0,0 +1,106 @@
+# TestBinaryOutput.py
+#
+# Check the BINARY output type and its Python reader.
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import xml.etree.ElementTree as et
+import numpy as np
+import pandas as pd
+import jsbsim
+from JSBSim_utils import JSBSimTestCase, CreateFDM, ExecuteUntil, RunTest
+
+
+class TestBinaryOutput(JSBSimTestCase):
+    properties = ['position/h-sl-ft', 'aero/alpha-deg',
+                  'propulsion/engine/thrust-lbs', 'velocities/vc-kts',
+                  'fcs/elevator-pos-norm', 'propulsion/set-running',
+                  'accelerations/Nz']
+    units = {'accelerations/Nz': 'g'}
+
+    def add_output(self, root, name, output_type, **attrib):
+        output_tag = et.SubElement(root, 'output')
+        output_tag.attrib['name'] = name
+        output_tag.attrib['type'] = output_type
+        output_tag.attrib['rate'] = '10'
+        output_tag.attrib.update(attrib)
+        for prop in self.properties:
+            property_tag = et.SubElement(output_tag, 'property')
+            property_tag.text = prop
+            if output_type == 'BINARY' and prop in self.units:
+                property_tag.attrib['unit'] = self.units[prop]
+
+    def run_script(self, **attrib):
+        script_path = self.sandbox.path_to_jsbsim_file('scripts', 'c1722.xml')
+        tree = et.parse(script_path)
+        self.add_output(tree.getroot(), 'test.csv', 'CSV')
+        self.add_output(tree.getroot(), 'test.bin', 'BINARY', **attrib)
+        tree.write('c1722_0.xml')
+
+        fdm = CreateFDM(self.sandbox)
+        fdm.load_script('c1722_0.xml')
+        fdm.run_ic()
+        ExecuteUntil(fdm, 10.)
+        # Close the output files.
+        del fdm
+
+        # Copy the memory mapped data so that the file can be removed with the
+        # sandbox.
+        data = np.array(jsbsim.read_binary_output('test.bin'))
+        return pd.read_csv('test.csv', float_precision='round_trip'), data
+
+    def test_double(self):
+        ref, data = self.run_script()
+
+        self.assertEqual(len(data), len(ref))
+        self.assertEqual(data.dtype.names[0], 'Time')
+        np.testing.assert_allclose(data['Time'], ref['Time'], rtol=1E-9)
+
+        for prop in self.properties:
+            name = '/fdm/jsbsim/' + prop
+            self.assertEqual(data.dtype[name], np.dtype('<f8'))
+            # The CSV output has enough digits to store the doubles exactly.
+            np.testing.assert_array_equal(data[name], ref[name])
+
+    def test_float(self):
+        ref, data = self.run_script(format='float')
+
+        self.assertEqual(len(data), len(ref))
+        self.assertEqual(data.dtype['Time'], np.dtype('<f8'))
+
+        for prop in self.properties:
+            name = '/fdm/jsbsim/' + prop
+            self.assertEqual(data.dtype[name], np.dtype('<f4'))
+            np.testing.assert_array_equal(data[name],
+                                          ref[name].to_numpy(np.float32))
+
+    def test_units(self):
+        _, data = self.run_script()
+
+        units = {name: data.dtype.fields[name][0].metadata['unit']
+                 for name in data.dtype.names}
+        self.assertEqual(units['Time'], 'sec')
+        self.assertEqual(units['/fdm/jsbsim/position/h-sl-ft'], 'ft')
+        self.assertEqual(units['/fdm/jsbsim/aero/alpha-deg'], 'deg')
+        self.assertEqual(units['/fdm/jsbsim/propulsion/engine/thrust-lbs'],
+                         'lbs')
+        self.assertEqual(units['/fdm/jsbsim/velocities/vc-kts'], 'kts')
+        self.assertEqual(units['/fdm/jsbsim/fcs/elevator-pos-norm'], 'norm')
+        # The suffixes that are not units are not reported as units.
+        self.assertEqual(units['/fdm/jsbsim/propulsion/set-running'], '')
+        # The unit given by the output directive supersedes the name.
+        self.assertEqual(units['/fdm/jsbsim/accelerations/Nz'], 'g')
+
+RunTest(TestBinaryOutput)
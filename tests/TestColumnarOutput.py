@@ -0,0 +1,120 @@
+# TestColumnarOutput.py
+#
+# Check the COLUMNAR output type and its Python reader.
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import xml.etree.ElementTree as et
+import numpy as np
+import pandas as pd
+import jsbsim
+from JSBSim_utils import JSBSimTestCase, CreateFDM, ExecuteUntil, RunTest
+
+
+class TestColumnarOutput(JSBSimTestCase):
+    properties = ['position/h-sl-ft', 'aero/alpha-deg',
+                  'propulsion/engine/thrust-lbs', 'velocities/vc-kts']
+
+    def add_output(self, root, name, output_type, **attrib):
+        output_tag = et.SubElement(root, 'output')
+        output_tag.attrib['name'] = name
+        output_tag.attrib['type'] = output_type
+        output_tag.attrib['rate'] = '10'
+        output_tag.attrib.update(attrib)
+        for prop in self.properties:
+            property_tag = et.SubElement(output_tag, 'property')
+            property_tag.text = prop
+
+    def run_script(self, **attrib):
+        script_path = self.sandbox.path_to_jsbsim_file('scripts', 'c1722.xml')
+        tree = et.parse(script_path)
+        self.add_output(tree.getroot(), 'test.csv', 'CSV')
+        # Small chunks to check the reads that straddle several chunks.
+        self.add_output(tree.getroot(), 'test.col', 'COLUMNAR', chunk='16',
+                        **attrib)
+        tree.write('c1722_0.xml')
+
+        fdm = CreateFDM(self.sandbox)
+        fdm.load_script('c1722_0.xml')
+        fdm.run_ic()
+        ExecuteUntil(fdm, 10.)
+        # Close the output files.
+        del fdm
+
+        return pd.read_csv('test.csv', float_precision='round_trip')
+
+    def check_columns(self, ref):
+        with jsbsim.ColumnarReader('test.col') as log:
+            self.assertTrue(log.indexed)
+            self.assertEqual(log.num_records, len(ref))
+            self.assertEqual(log.names[0], 'Time')
+            np.testing.assert_allclose(log.read('Time'), ref['Time'],
+                                       rtol=1E-9)
+
+            for prop in self.properties:
+                name = '/fdm/jsbsim/' + prop
+                # The compression is lossless.
+                np.testing.assert_array_equal(log.read(name), ref[name])
+
+    def test_compressions(self):
+        for compression in ('xor', 'delta', 'none'):
+            ref = self.run_script(compression=compression)
+            self.check_columns(ref)
+
+    def test_time_window(self):
+        ref = self.run_script()
+        name = '/fdm/jsbsim/position/h-sl-ft'
+
+        with jsbsim.ColumnarReader('test.col') as log:
+            self.assertGreater(len(log._chunks), 3)
+            t = log.read('Time')
+            start, end = t[20], t[50]
+            window = (t >= start) & (t <= end)
+            np.testing.assert_array_equal(log.read('Time', start, end),
+                                          t[window])
+            np.testing.assert_array_equal(log.read(name, start, end),
+                                          ref[name][window])
+            self.assertEqual(len(log.read(name, t[-1]+1.0)), 0)
+
+    def test_units(self):
+        self.run_script()
+
+        with jsbsim.ColumnarReader('test.col') as log:
+            units = dict(zip(log.names, log.units))
+        self.assertEqual(units['Time'], 'sec')
+        self.assertEqual(units['/fdm/jsbsim/position/h-sl-ft'], 'ft')
+        self.assertEqual(units['/fdm/jsbsim/aero/alpha-deg'], 'deg')
+        self.assertEqual(units['/fdm/jsbsim/velocities/vc-kts'], 'kts')
+
+    def test_unclosed_file(self):
+        self.run_script()
+
+        # Remove the index as if the simulation had crashed and truncate the
+        # last chunk.
+        with open('test.col', 'rb') as f:
+            data = f.read()
+        with jsbsim.ColumnarReader('test.col') as log:
+            ref = log.read(1)
+            last_chunk = log._chunks[-1][0]
+        with open('test.col', 'wb') as f:
+            f.write(data[:last_chunk+40])
+
+        with jsbsim.ColumnarReader('test.col') as log:
+            self.assertFalse(log.indexed)
+            values = log.read(1)
+        self.assertLess(len(values), len(ref))
+        np.testing.assert_array_equal(values, ref[:len(values)])
+
+RunTest(TestColumnarOutput)
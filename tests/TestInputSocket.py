@@ -19,7 +19,7 @@
 # this program; if not, see <http://www.gnu.org/licenses/>
 #
 
-import telnetlib, socket, time
+import telnetlib, socket, struct, time
 import xml.etree.ElementTree as et
 from JSBSim_utils import JSBSimTestCase, CopyAircraftDef, RunTest
 
@@ -76,7 +76,19 @@ class TestInputSocket(JSBSimTestCase):
                     tn.sendCommand("help").split("\n")[2:-2],
                 )
             ),
-            ["get", "help", "hold", "info", "iterate", "quit", "resume", "set"],
+            [
+                "frame",
+                "get",
+                "help",
+                "hold",
+                "info",
+                "iterate",
+                "quit",
+                "resume",
+                "set",
+                "subscribe",
+                "unsubscribe",
+            ],
         )
 
     def test_no_input(self):
@@ -169,6 +181,74 @@ class TestInputSocket(JSBSimTestCase):
             tn.getPropertyValue("simulation/sim-time-sec"), t, delta=1e-5
         )
 
+    def test_subscription(self):
+        tree = et.parse(self.script_path)
+        input_tag = et.SubElement(tree.getroot(), "input")
+        input_tag.attrib["port"] = "1139"
+        tree.write("c1722_2.xml")
+
+        fdm = self.create_fdm()
+        fdm.load_script("c1722_2.xml")
+        fdm.run_ic()
+        fdm.hold()
+
+        tn = TelnetInterface(fdm, 1139)
+        self.sanityCheck(tn)
+
+        msg = tn.sendCommand("subscribe set fcs/throttle-cmd-norm fcs/elevator-cmd-norm")
+        self.assertEqual(msg.split("\n")[0].strip(), "Subscribed 2 properties")
+        msg = tn.sendCommand(
+            "subscribe get fcs/throttle-cmd-norm fcs/elevator-cmd-norm simulation/sim-time-sec"
+        )
+        self.assertEqual(msg.split("\n")[0].strip(), "Subscribed 3 properties")
+
+        # An invalid subscription leaves the current subscription unchanged.
+        msg = tn.sendCommand("subscribe get fcs/throttle-cmd-norm dummy")
+        self.assertEqual(msg.split("\n")[0].strip(), "Unknown property: dummy")
+
+        # Text frames
+        msg = tn.sendCommand("frame 0.25 -0.125")
+        values = [float(v) for v in msg.split()]
+        self.assertEqual(values, [0.25, -0.125, fdm.get_sim_time()])
+        self.assertEqual(fdm["fcs/throttle-cmd-norm"], 0.25)
+        self.assertEqual(fdm["fcs/elevator-cmd-norm"], -0.125)
+
+        # Invalid frames are rejected as a whole.
+        msg = tn.sendCommand("frame 0.5 x")
+        self.assertEqual(msg.split("\n")[0].strip(), "Invalid number: x")
+        msg = tn.sendCommand("frame 0.5")
+        self.assertEqual(msg.split("\n")[0].strip(), "Expected 2 values")
+        self.assertEqual(fdm["fcs/throttle-cmd-norm"], 0.25)
+
+        # Binary frames can be interleaved with text commands and split over
+        # several packets.
+        sock = tn.tn.get_socket()
+        frame = b"JSBF" + struct.pack("<2d", 0.5, 0.1)
+        sock.sendall(frame + b"get fcs/throttle-cmd-norm\n" + frame[:10])
+        fdm.run()
+        time.sleep(0.2)
+        sock.sendall(frame[10:])
+        for _ in range(10):
+            fdm.run()
+        time.sleep(0.5)
+        reply = tn.tn.read_very_eager()
+        size = 4 + 3 * 8
+        self.assertEqual(reply[:4], b"JSBF")
+        self.assertEqual(
+            struct.unpack("<3d", reply[4:size]), (0.5, 0.1, fdm.get_sim_time())
+        )
+        self.assertEqual(reply[-size:][:4], b"JSBF")
+        self.assertEqual(
+            struct.unpack("<2d", reply[-size + 4 : -8]), (0.5, 0.1)
+        )
+        self.assertIn(b"fcs/throttle-cmd-norm = ", reply[size:-size])
+        self.assertEqual(fdm["fcs/elevator-cmd-norm"], 0.1)
+
+        # The subscriptions are dropped by "unsubscribe".
+        tn.sendCommand("unsubscribe")
+        msg = tn.sendCommand("frame 0.5 0.0")
+        self.assertEqual(msg.split("\n")[0].strip(), "Expected 0 values")
+
     def test_script_input(self):
         tree = et.parse(self.script_path)
         input_tag = et.SubElement(tree.getroot(), "input")
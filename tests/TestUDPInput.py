@@ -0,0 +1,102 @@
+# TestUDPInput.py
+#
+# Check the binary packets of the UDP input.
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import socket, struct, time
+import xml.etree.ElementTree as et
+from JSBSim_utils import JSBSimTestCase, RunTest
+
+
+class TestUDPInput(JSBSimTestCase):
+    def setUp(self):
+        JSBSimTestCase.setUp(self)
+        self.sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+
+    def tearDown(self):
+        self.sock.close()
+        JSBSimTestCase.tearDown(self)
+
+    def load_script(self, port, byteorder):
+        script_path = self.sandbox.path_to_jsbsim_file("scripts", "c1722.xml")
+        tree = et.parse(script_path)
+        input_tag = et.SubElement(tree.getroot(), "input")
+        input_tag.attrib.update(
+            {
+                "type": "UDP",
+                "port": str(port),
+                "rate": "120",
+                "format": "binary",
+                "byteorder": byteorder,
+            }
+        )
+        et.SubElement(input_tag, "sequence", type="uint16")
+        et.SubElement(input_tag, "timestamp")
+        for prop, field_type in (
+            ("fcs/aileron-cmd-norm", "float"),
+            ("fcs/elevator-cmd-norm", "double"),
+            ("fcs/rudder-cmd-norm", "int16"),
+        ):
+            property_tag = et.SubElement(input_tag, "property", type=field_type)
+            property_tag.text = prop
+        tree.write("c1722_0.xml")
+
+        fdm = self.create_fdm()
+        fdm.load_script("c1722_0.xml")
+        fdm.run_ic()
+        return fdm
+
+    def send(self, fdm, port, packet):
+        self.sock.sendto(packet, ("localhost", port))
+        time.sleep(0.1)  # Wait for the datagram to be delivered.
+        fdm.run()
+
+    def test_binary_packets(self):
+        port = 5140
+        fdm = self.load_script(port, "big")
+        layout = ">Hdfdh"
+
+        self.send(fdm, port, struct.pack(layout, 65534, 0.1, 0.25, -0.5, 2))
+        self.assertEqual(fdm["fcs/aileron-cmd-norm"], 0.25)
+        self.assertEqual(fdm["fcs/elevator-cmd-norm"], -0.5)
+        self.assertEqual(fdm["fcs/rudder-cmd-norm"], 2.0)
+
+        # Out of order, stale and malformed packets are rejected.
+        self.send(fdm, port, struct.pack(layout, 65533, 0.2, 0.5, 0.5, 1))
+        self.send(fdm, port, struct.pack(layout, 2, 0.05, 0.5, 0.5, 1))
+        self.send(fdm, port, struct.pack(layout, 3, 0.2, 0.5, 0.5, 1)[:-1])
+        self.assertEqual(fdm["fcs/aileron-cmd-norm"], 0.25)
+        self.assertEqual(fdm["simulation/input/rejected-packets"], 3)
+
+        # The sequence numbers wrap around and the gaps are counted.
+        self.send(fdm, port, struct.pack(layout, 1, 0.3, 0.5, 0.125, -4))
+        self.assertEqual(fdm["fcs/aileron-cmd-norm"], 0.5)
+        self.assertEqual(fdm["fcs/elevator-cmd-norm"], 0.125)
+        self.assertEqual(fdm["fcs/rudder-cmd-norm"], -4.0)
+        self.assertEqual(fdm["simulation/input/lost-packets"], 2)
+
+    def test_little_endian(self):
+        port = 5141
+        fdm = self.load_script(port, "little")
+
+        self.send(fdm, port, struct.pack("<Hdfdh", 7, 1.0, -0.75, 0.375, -3))
+        self.assertEqual(fdm["fcs/aileron-cmd-norm"], -0.75)
+        self.assertEqual(fdm["fcs/elevator-cmd-norm"], 0.375)
+        self.assertEqual(fdm["fcs/rudder-cmd-norm"], -3.0)
+        self.assertEqual(fdm["simulation/input/rejected-packets"], 0)
+
+
+RunTest(TestUDPInput)
@@ -0,0 +1,78 @@
+#define JSBSIM_ALLOCATION_HOOK
+
+#include <cstdio>
+#include <string>
+
+#include <cxxtest/TestSuite.h>
+
+#include <FGAllocationCounter.h>
+#include <FGFDMExec.h>
+#include <initialization/FGInitialCondition.h>
+#include <models/FGPropagate.h>
+#include "TestUtilities.h"
+
+using namespace JSBSim;
+
+class FGAllocationCounterTest : public CxxTest::TestSuite
+{
+public:
+  void testCounter() {
+    unsigned long count = FGAllocationCounter::GetCount();
+    // Unlike new expressions, explicit calls to operator new cannot be
+    // optimized away by the compiler.
+    void* x = ::operator new(sizeof(double));
+    TS_ASSERT_EQUALS(FGAllocationCounter::GetCount(), count+1);
+    ::operator delete(x);
+    TS_ASSERT_EQUALS(FGAllocationCounter::GetCount(), count+1);
+  }
+
+  void testC172x() {
+    CheckSteadyState("c172x");
+  }
+
+  void testShuttle() {
+    CheckSteadyState("Shuttle");
+  }
+
+  // The derivatives of the Adams-Bashforth integrators are kept in fixed size
+  // histories.
+  void testAdamsBashforth5() {
+    CheckSteadyState("c172x", FGPropagate::eAdamsBashforth5);
+  }
+
+private:
+  // Checks that, once initialized, the model runs without allocating memory.
+  // The integrators of the model are used unless integrator is given.
+  void CheckSteadyState(const std::string& model, int integrator = -1) {
+    // The output file of the model, if any, is removed by the test.
+    std::string output = "allocation_" + model + ".csv";
+
+    {
+      auto fdmex = CreateExec();
+      TS_ASSERT(fdmex->LoadModel(model));
+      fdmex->SetOutputFileName(0, output);
+      if (integrator >= 0) {
+        auto pm = fdmex->GetPropertyManager();
+        for (auto name: {"rate/rotational", "rate/translational",
+                         "position/rotational", "position/translational"})
+          pm->GetNode(std::string("simulation/integrator/")+name)->setIntValue(integrator);
+      }
+      TS_ASSERT(fdmex->GetIC()->Load(SGPath("reset00")));
+      TS_ASSERT(fdmex->RunIC());
+
+      // Let the first frames build the caches.
+      for (int i=0; i<10; ++i)
+        fdmex->Run();
+
+      fdmex->SetCountAllocations(true);
+      for (int i=0; i<200; ++i) {
+        fdmex->Run();
+        TS_ASSERT_EQUALS(fdmex->GetAllocations(), 0);
+        for (unsigned int m=0; m<FGFDMExec::eNumStandardModels; ++m)
+          TS_ASSERT_EQUALS(fdmex->GetModelAllocations(m), 0);
+      }
+    }
+
+    remove(output.c_str());
+  }
+};
@@ -0,0 +1,79 @@
+#include <cmath>
+#include <string>
+
+#include <cxxtest/TestSuite.h>
+
+#include <FGBatchRunner.h>
+#include <input_output/FGXMLElement.h>
+#include <input_output/FGXMLFileRead.h>
+#include "TestUtilities.h"
+
+using namespace JSBSim;
+
+// Batch of 6 runs of the script c1724 with a dispersed heading.
+const char* batch_spec =
+  "<batch runs=\"6\" seed=\"3\">\n"
+  "  <script file=\"scripts/c1724.xml\"/>\n"
+  "  <dispersion property=\"ic/psi-true-deg\" type=\"uniform\"> 10.0 </dispersion>\n"
+  "  <summary file=\"batch.csv\">\n"
+  "    <property> attitude/psi-deg </property>\n"
+  "    <property function=\"max\"> forces/fbz-gear-lbs </property>\n"
+  "  </summary>\n"
+  "</batch>\n";
+
+class FGBatchRunnerTest : public CxxTest::TestSuite
+{
+public:
+  void testDocumentClone() {
+    FGXMLFileRead XMLFileRead;
+    Element* document = XMLFileRead.LoadXMLDocument(SGPath(JSBSIM_TEST_ROOT_DIR)/"scripts/c1724.xml");
+    TS_ASSERT(document);
+
+    Element_ptr copy = document->Clone();
+    TS_ASSERT(copy.ptr() != document);
+    TS_ASSERT_EQUALS(copy->GetName(), document->GetName());
+    TS_ASSERT_EQUALS(copy->GetNumElements(), document->GetNumElements());
+    TS_ASSERT_EQUALS(copy->GetAttributeValue("name"), "C172-01A takeoff run");
+
+    Element* run = copy->FindElement("run");
+    TS_ASSERT(run->GetParent() == copy.ptr());
+    TS_ASSERT_EQUALS(run->GetNumElements("event"), 2);
+    TS_ASSERT_EQUALS(run->FindElement("event")->FindElementValue("condition"),
+                     document->FindElement("run")->FindElement("event")->FindElementValue("condition"));
+  }
+
+  void testRuns() {
+    auto summary = SplitLines(RunOnThreads<FGBatchRunner>(batch_spec,
+                                                          "batch.csv"));
+
+    // Header and one line per run.
+    TS_ASSERT_EQUALS(summary.size(), 7);
+    TS_ASSERT_EQUALS(summary[0], "run,seed,ic/psi-true-deg,final(attitude/psi-deg),max(forces/fbz-gear-lbs),time,success");
+
+    for (unsigned int run=0; run<6; ++run) {
+      auto fields = SplitFields(summary[run+1]);
+      TS_ASSERT_EQUALS(fields.size(), 7);
+      TS_ASSERT_EQUALS(fields[0], std::to_string(run));
+      TS_ASSERT_EQUALS(fields[1], std::to_string(run+3));
+      TS_ASSERT_EQUALS(fields[6], "1");
+      // The dispersed heading is within the amplitude and it changes the
+      // results of the runs.
+      TS_ASSERT(fabs(std::stod(fields[2])) <= 10.0);
+      if (run > 0) {
+        auto previous = SplitFields(summary[run]);
+        TS_ASSERT_DIFFERS(fields[2], previous[2]);
+        TS_ASSERT_DIFFERS(fields[3], previous[3]);
+      }
+    }
+  }
+
+  void testInvalidSpecification() {
+    TS_ASSERT(LoadSpecification<FGBatchRunner>(batch_spec));
+    TS_ASSERT(!LoadSpecification<FGBatchRunner>(
+      "<batch runs=\"2\">\n"
+      "  <script file=\"scripts/c1724.xml\"/>\n"
+      "  <dispersion property=\"ic/psi-true-deg\" type=\"lognormal\"> 1.0 </dispersion>\n"
+      "  <summary file=\"batch_invalid.csv\"/>\n"
+      "</batch>\n"));
+  }
+};
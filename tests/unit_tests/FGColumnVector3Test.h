@@ -622,6 +622,14 @@ public:
     os << v1;
     TS_ASSERT_EQUALS(os.str(), std::string("1 , 0 , -2"));
 
+    // The stream version must leave the precision of the stream unchanged
+    JSBSim::FGColumnVector3 v2(1./3., 0., 2.);
+    os.str("");
+    os.precision(3);
+    v2.Dump(os, ",");
+    TS_ASSERT_EQUALS(os.str(), v2.Dump(","));
+    TS_ASSERT_EQUALS(os.precision(), 3);
+
     // Verify that the operands are not modified
     TS_ASSERT_EQUALS(v1(1), 1.0);
     TS_ASSERT_EQUALS(v1(2), 0.0);
@@ -0,0 +1,232 @@
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <vector>
+
+#include <cxxtest/TestSuite.h>
+
+#include <input_output/FGColumnarCodec.h>
+#include <input_output/FGColumnarReader.h>
+
+using namespace JSBSim;
+
+const FGColumnarCodec::eEncoding encodings[] = {FGColumnarCodec::eRaw,
+                                                FGColumnarCodec::eXor,
+                                                FGColumnarCodec::eDelta};
+
+// Checks that the values are restored bit for bit (so that NaN and -0.0 are
+// also checked).
+void CheckRoundTrip(const std::vector<double>& values)
+{
+  for (auto encoding: encodings) {
+    std::vector<char> block(FGColumnarCodec::GetMaxSize(values.size()));
+    size_t size = FGColumnarCodec::Encode(values.data(), values.size(),
+                                          encoding, block.data());
+    TS_ASSERT(size <= block.size());
+
+    std::vector<double> decoded(values.size());
+    TS_ASSERT(FGColumnarCodec::Decode(block.data(), size, values.size(),
+                                      encoding, decoded.data()));
+    TS_ASSERT_EQUALS(memcmp(decoded.data(), values.data(),
+                            values.size()*sizeof(double)), 0);
+  }
+}
+
+// Writes a columnar file with the columns Time and x = 2*Time.
+void WriteFile(const char* filename, size_t rows, size_t chunkSize, bool index)
+{
+  std::vector<char> file(FGColumnarCodec::FileMagic,
+                         FGColumnarCodec::FileMagic+8);
+  auto Append = [&file](uint64_t value, size_t size) {
+    char bytes[8];
+    FGColumnarCodec::Store(bytes, value);
+    file.insert(file.end(), bytes, bytes+size);
+  };
+  auto AppendDouble = [&file](double value) {
+    char bytes[8];
+    FGColumnarCodec::Store(bytes, value);
+    file.insert(file.end(), bytes, bytes+8);
+  };
+
+  Append(FGColumnarCodec::Version, 4);
+  Append(2, 4);
+  Append(chunkSize, 4);
+  Append(48, 4);
+  for (auto name: {"Time", "x"}) {
+    file.push_back(name[0] == 'T' ? 'd' : 'x');
+    Append(strlen(name), 2);
+    file.insert(file.end(), name, name+strlen(name));
+    Append(0, 2);
+  }
+  while (file.size() < 48) file.push_back('\0');
+
+  std::vector<uint64_t> offsets;
+  for (size_t first=0; first<rows; first+=chunkSize) {
+    size_t n = std::min(chunkSize, rows-first);
+    std::vector<double> t(n), x(n);
+    for (size_t i=0; i<n; ++i) {
+      t[i] = 0.1*(first+i);
+      x[i] = 2.0*t[i];
+    }
+    std::vector<char> bt(FGColumnarCodec::GetMaxSize(n)), bx(bt.size());
+    bt.resize(FGColumnarCodec::Encode(t.data(), n, FGColumnarCodec::eDelta,
+                                      bt.data()));
+    bx.resize(FGColumnarCodec::Encode(x.data(), n, FGColumnarCodec::eXor,
+                                      bx.data()));
+
+    offsets.push_back(file.size());
+    file.insert(file.end(), FGColumnarCodec::ChunkMagic,
+                FGColumnarCodec::ChunkMagic+4);
+    Append(n, 4);
+    AppendDouble(t.front());
+    AppendDouble(t.back());
+    Append(bt.size(), 8);
+    Append(bx.size(), 8);
+    file.insert(file.end(), bt.begin(), bt.end());
+    file.insert(file.end(), bx.begin(), bx.end());
+  }
+
+  if (index) {
+    uint64_t indexOffset = file.size();
+    file.insert(file.end(), FGColumnarCodec::IndexMagic,
+                FGColumnarCodec::IndexMagic+8);
+    Append(offsets.size(), 8);
+    for (size_t i=0; i<offsets.size(); ++i) {
+      size_t first = i*chunkSize;
+      size_t n = std::min(chunkSize, rows-first);
+      Append(offsets[i], 8);
+      Append(n, 8);
+      AppendDouble(0.1*first);
+      AppendDouble(0.1*(first+n-1));
+    }
+    Append(indexOffset, 8);
+    file.insert(file.end(), FGColumnarCodec::EndMagic,
+                FGColumnarCodec::EndMagic+8);
+  }
+
+  std::ofstream out(filename, std::ios::binary);
+  out.write(file.data(), file.size());
+}
+
+class FGColumnarCodecTest : public CxxTest::TestSuite
+{
+public:
+  void testSpecialValues() {
+    const double inf = std::numeric_limits<double>::infinity();
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const double denorm = std::numeric_limits<double>::denorm_min();
+    CheckRoundTrip({0.0, -0.0, 1.0, -1.0, inf, -inf, nan, denorm, -denorm,
+                    std::numeric_limits<double>::max(),
+                    std::numeric_limits<double>::lowest(), 0.0});
+  }
+
+  void testSignals() {
+    std::vector<double> constant(100, 3.25), ramp(100), sine(100);
+    for (size_t i=0; i<100; ++i) {
+      ramp[i] = 1E-3*i;
+      sine[i] = sin(0.1*i);
+    }
+    CheckRoundTrip(constant);
+    CheckRoundTrip(ramp);
+    CheckRoundTrip(sine);
+    CheckRoundTrip({});
+  }
+
+  void testCompression() {
+    std::vector<double> constant(100, 3.25), ramp(100);
+    for (size_t i=0; i<100; ++i) ramp[i] = 0.008333333333*i;
+    std::vector<char> block(FGColumnarCodec::GetMaxSize(100));
+
+    // A constant signal only needs one control byte per value after the first
+    // value (whose 6 trailing bytes are zeros).
+    TS_ASSERT_EQUALS(FGColumnarCodec::Encode(constant.data(), 100,
+                                             FGColumnarCodec::eXor,
+                                             block.data()), 100+2);
+    TS_ASSERT(FGColumnarCodec::Encode(ramp.data(), 100,
+                                      FGColumnarCodec::eDelta, block.data())
+              < 800/2);
+  }
+
+  void testCorruptedBlock() {
+    std::vector<double> values{1.0, 2.0, 3.0}, decoded(3);
+    std::vector<char> block(FGColumnarCodec::GetMaxSize(3));
+
+    for (auto encoding: encodings) {
+      size_t size = FGColumnarCodec::Encode(values.data(), 3, encoding,
+                                            block.data());
+      TS_ASSERT(!FGColumnarCodec::Decode(block.data(), size-1, 3, encoding,
+                                         decoded.data()));
+    }
+
+    // Invalid control byte
+    block[0] = static_cast<char>(0x55);
+    TS_ASSERT(!FGColumnarCodec::Decode(block.data(), block.size(), 3,
+                                       FGColumnarCodec::eXor, decoded.data()));
+  }
+
+  void testReader() {
+    const char* filename = "columnar_test.col";
+    WriteFile(filename, 1000, 64, true);
+
+    FGColumnarReader reader;
+    TS_ASSERT(reader.Open(filename));
+    TS_ASSERT(reader.IsIndexed());
+    TS_ASSERT_EQUALS(reader.GetNumColumns(), 2);
+    TS_ASSERT_EQUALS(reader.GetColumnName(1), "x");
+    TS_ASSERT_EQUALS(reader.GetColumnIndex("x"), 1);
+    TS_ASSERT_EQUALS(reader.GetColumnIndex("y"), -1);
+    TS_ASSERT_EQUALS(reader.GetNumRecords(), 1000);
+    TS_ASSERT_EQUALS(reader.GetNumChunks(), 16);
+    TS_ASSERT_DELTA(reader.GetEndTime(), 99.9, 1E-9);
+
+    std::vector<double> time, x;
+    TS_ASSERT(reader.ReadColumn(0, time));
+    TS_ASSERT_EQUALS(time.size(), 1000);
+
+    // The window straddles several chunks.
+    TS_ASSERT(reader.ReadColumn(0, time, 10.05, 20.05));
+    TS_ASSERT(reader.ReadColumn(1, x, 10.05, 20.05));
+    TS_ASSERT_EQUALS(time.size(), 100);
+    TS_ASSERT_EQUALS(x.size(), 100);
+    TS_ASSERT_EQUALS(time.front(), 0.1*101);
+    for (size_t i=0; i<x.size(); ++i)
+      TS_ASSERT_EQUALS(x[i], 2.0*time[i]);
+
+    TS_ASSERT(reader.ReadColumn(1, x, 200.0));
+    TS_ASSERT(x.empty());
+    TS_ASSERT(!reader.ReadColumn(2, x));
+    reader.Close();
+    remove(filename);
+  }
+
+  void testUnindexedFile() {
+    const char* filename = "columnar_test.col";
+    WriteFile(filename, 1000, 64, false);
+
+    FGColumnarReader reader;
+    TS_ASSERT(reader.Open(filename));
+    TS_ASSERT(!reader.IsIndexed());
+    TS_ASSERT_EQUALS(reader.GetNumRecords(), 1000);
+
+    std::vector<double> x;
+    TS_ASSERT(reader.ReadColumn(1, x, 49.95, 59.95));
+    TS_ASSERT_EQUALS(x.size(), 100);
+    reader.Close();
+    remove(filename);
+  }
+
+  void testNotColumnar() {
+    const char* filename = "columnar_test.col";
+    {
+      std::ofstream out(filename);
+      out << "Time,x" << std::endl << "0.0,1.0" << std::endl;
+    }
+
+    FGColumnarReader reader;
+    TS_ASSERT(!reader.Open(filename));
+    TS_ASSERT(!reader.IsOpen());
+    remove(filename);
+  }
+};
@@ -0,0 +1,94 @@
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include <cxxtest/TestSuite.h>
+
+#include <FGFDMExec.h>
+#include <initialization/FGEnvelopeLinearization.h>
+#include <input_output/FGGainScheduleReader.h>
+#include "TestUtilities.h"
+
+using namespace JSBSim;
+
+// 2x2 grid of the c172.
+const char* envelope_spec =
+  "<envelope>\n"
+  "  <script file=\"scripts/c1722.xml\"/>\n"
+  "  <axis property=\"ic/h-sl-ft\"> 3000 6000 </axis>\n"
+  "  <axis property=\"ic/vt-kts\">\n"
+  "    95\n"
+  "    110\n"
+  "  </axis>\n"
+  "  <set name=\"propulsion/set-running\" value=\"-1\"/>\n"
+  "  <output file=\"envelope.lin\"/>\n"
+  "</envelope>\n";
+
+// Writes data to the file file_name.
+void WriteFile(const std::string& file_name, const std::string& data)
+{
+  std::ofstream file(file_name, std::ios::binary);
+  file.write(data.data(), data.size());
+}
+
+class FGEnvelopeLinearizationTest : public CxxTest::TestSuite
+{
+public:
+  void testGrid() {
+    // The neighbors from which the trims start do not depend on the threads.
+    std::string data = RunOnThreads<FGEnvelopeLinearization>(envelope_spec,
+                                                             "envelope.lin");
+    WriteFile("envelope.lin", data);
+
+    FGGainScheduleReader reader;
+    TS_ASSERT(reader.Open("envelope.lin"));
+    TS_ASSERT_EQUALS(reader.GetAircraftName(), "c172x");
+    TS_ASSERT_EQUALS(reader.GetNumAxes(), 2);
+    TS_ASSERT_EQUALS(reader.GetAxisProperty(1), "ic/vt-kts");
+    TS_ASSERT_EQUALS(reader.GetAxisValues(1).size(), 2);
+    TS_ASSERT_EQUALS(reader.GetAxisValues(1)[1], 110.0);
+    TS_ASSERT_EQUALS(reader.GetNumPoints(), 4);
+    for (unsigned int i=0; i<4; ++i)
+      TS_ASSERT(reader.IsSolved(i));
+    TS_ASSERT_EQUALS(reader.GetPointNumber({1, 0}), 2);
+    TS_ASSERT_EQUALS(reader.GetPointIndices(3)[0], 1);
+    TS_ASSERT_EQUALS(reader.GetPointIndices(3)[1], 1);
+    TS_ASSERT_THROWS(reader.GetPointNumber({2, 0}), std::out_of_range&);
+
+    size_t nx = reader.GetStateNames().size();
+    TS_ASSERT_EQUALS(nx, 13);
+    TS_ASSERT_EQUALS(reader.GetInputNames().size(), 4);
+    TS_ASSERT_EQUALS(reader.GetStateUnits().size(), nx);
+
+    FGGainScheduleReader::Point slow, fast;
+    TS_ASSERT(reader.ReadPoint(reader.GetPointNumber({0, 0}), slow));
+    TS_ASSERT(reader.ReadPoint(reader.GetPointNumber({0, 1}), fast));
+    TS_ASSERT_EQUALS(slow.nx, nx);
+    TS_ASSERT_EQUALS(slow.controls.size(), 3); // alpha, throttle, pitch trim
+    TS_ASSERT_EQUALS(slow.A.size(), nx*nx);
+    TS_ASSERT_EQUALS(slow.B.size(), nx*slow.nu);
+    TS_ASSERT_EQUALS(slow.D.size(), slow.ny*slow.nu);
+
+    // The faster the aircraft flies, the lower its angle of attack.
+    const double ktstofps = 1.68781;
+    TS_ASSERT_DELTA(slow.x0[0], 95.0*ktstofps, 1E-3);
+    TS_ASSERT_DELTA(fast.x0[0], 110.0*ktstofps, 1E-3);
+    TS_ASSERT_LESS_THAN(fast.controls[0], slow.controls[0]);
+
+    // A file without its index is rejected.
+    WriteFile("envelope.lin", data.substr(0, data.size()-8));
+    TS_ASSERT(!reader.Open("envelope.lin"));
+
+    remove("envelope.lin");
+  }
+
+  void testInvalidSpecification() {
+    TS_ASSERT(LoadSpecification<FGEnvelopeLinearization>(envelope_spec));
+    TS_ASSERT(!LoadSpecification<FGEnvelopeLinearization>(
+      "<envelope trim=\"pullup\">\n"
+      "  <script file=\"scripts/c1722.xml\"/>\n"
+      "  <axis property=\"ic/h-sl-ft\"> 3000 </axis>\n"
+      "  <output file=\"envelope.lin\"/>\n"
+      "</envelope>\n"));
+  }
+};
@@ -0,0 +1,70 @@
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cxxtest/TestSuite.h>
+
+#include <FGFDMExec.h>
+#include "TestUtilities.h"
+
+using namespace JSBSim;
+
+const char* scripts[] = {"c1722", "c1723", "c1724"};
+
+// Runs the first frames of a script and returns the values of the recorded
+// properties at each frame.
+std::vector<double> RunScript(const std::string& script, int id)
+{
+  std::vector<double> values;
+  // Each instance writes to its own file.
+  std::string output = "threads_" + std::to_string(id) + ".csv";
+
+  {
+    auto fdmex = LoadScript(script, output);
+    if (fdmex) values = RunFrames(fdmex.get(), 1500);
+  }
+
+  remove(output.c_str());
+  return values;
+}
+
+class FGFDMExecThreadsTest : public CxxTest::TestSuite
+{
+public:
+  void testConcurrentScripts() {
+    const unsigned int nthreads = 8;
+    std::vector<std::vector<double>> serial;
+
+    for (unsigned int i=0; i<3; ++i)
+      serial.push_back(RunScript(scripts[i], i));
+
+    std::vector<std::vector<double>> results(nthreads);
+    std::vector<std::thread> threads;
+    for (unsigned int i=0; i<nthreads; ++i)
+      threads.emplace_back([&results, i]() {
+        results[i] = RunScript(scripts[i % 3], 100+i);
+      });
+    for (auto& thread: threads)
+      thread.join();
+
+    // The results must be the same bit for bit whether the scripts run
+    // serially or concurrently.
+    for (unsigned int i=0; i<nthreads; ++i)
+      AssertSameRecording(results[i], serial[i % 3]);
+  }
+
+  void testDebugLevelPerThread() {
+    FGJSBBase::debug_lvl = 1;
+
+    short level = -1;
+    std::thread thread([&level]() {
+      level = FGJSBBase::debug_lvl;
+      FGJSBBase::debug_lvl = 0;
+    });
+    thread.join();
+
+    TS_ASSERT_EQUALS(level, 1);
+    TS_ASSERT_EQUALS(FGJSBBase::debug_lvl, 1);
+  }
+};
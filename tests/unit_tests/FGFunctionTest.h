@@ -0,0 +1,392 @@
+#include <cmath>
+
+#include <cxxtest/TestSuite.h>
+#include <FGFDMExec.h>
+#include <math/FGFunction.h>
+#include "TestUtilities.h"
+
+using namespace JSBSim;
+
+
+class FGFunctionTest : public CxxTest::TestSuite
+{
+public:
+  void testVariadicOperations() {
+    FGFDMExec fdmex;
+    auto pm = fdmex.GetPropertyManager();
+    auto x = pm->GetNode("x", true);
+    auto y = pm->GetNode("y", true);
+    const double values[] {-2.5, -1.0, 0.0, 0.1, 1.0, 3.7};
+
+    Element_ptr elm = readFromXML("<function>"
+                                  "  <sum>"
+                                  "    <product><p>x</p><v>0.3</v><p>y</p></product>"
+                                  "    <difference><p>x</p><p>-y</p><v>1.1</v></difference>"
+                                  "    <min><p>x</p><p>y</p><v>0.5</v></min>"
+                                  "    <max><p>x</p><p>y</p><v>-0.5</v></max>"
+                                  "    <avg><p>x</p><p>y</p><v>0.7</v></avg>"
+                                  "  </sum>"
+                                  "</function>");
+    FGFunction f(&fdmex, elm);
+
+    for (double vx: values) {
+      for (double vy: values) {
+        x->setDoubleValue(vx);
+        y->setDoubleValue(vy);
+        double expected = 0.0;
+        expected += vx*0.3*vy;
+        expected += vx-(-vy)-1.1;
+        expected += std::min(std::min(vx, vy), 0.5);
+        expected += std::max(std::max(vx, vy), -0.5);
+        expected += (vx+vy+0.7)/3;
+        TS_ASSERT_EQUALS(f.GetValue(), expected);
+      }
+    }
+  }
+
+  void testBinaryOperations() {
+    FGFDMExec fdmex;
+    auto pm = fdmex.GetPropertyManager();
+    auto x = pm->GetNode("x", true);
+    auto y = pm->GetNode("y", true);
+    const double values[] {-2.5, -1.0, 0.0, 0.1, 1.0, 3.7};
+    const std::string ops[] {"quotient", "pow", "fmod", "atan2", "lt", "le",
+                             "gt", "ge", "eq", "nq"};
+
+    for (const auto& op: ops) {
+      Element_ptr elm = readFromXML("<function><" + op + "><p>x</p><p>y</p></"
+                                    + op + "></function>");
+      FGFunction f(&fdmex, elm);
+
+      for (double vx: values) {
+        for (double vy: values) {
+          x->setDoubleValue(vx);
+          y->setDoubleValue(vy);
+          double expected;
+          if (op == "quotient") expected = vy != 0.0 ? vx/vy : HUGE_VAL;
+          else if (op == "pow") expected = pow(vx, vy);
+          else if (op == "fmod") expected = vy != 0.0 ? fmod(vx, vy) : HUGE_VAL;
+          else if (op == "atan2") expected = atan2(vx, vy);
+          else if (op == "lt") expected = vx < vy ? 1.0 : 0.0;
+          else if (op == "le") expected = vx <= vy ? 1.0 : 0.0;
+          else if (op == "gt") expected = vx > vy ? 1.0 : 0.0;
+          else if (op == "ge") expected = vx >= vy ? 1.0 : 0.0;
+          else if (op == "eq") expected = vx == vy ? 1.0 : 0.0;
+          else expected = vx != vy ? 1.0 : 0.0;
+
+          double result = f.GetValue();
+          if (std::isnan(expected))
+            TS_ASSERT(std::isnan(result));
+          else
+            TS_ASSERT_EQUALS(result, expected);
+        }
+      }
+    }
+  }
+
+  void testUnaryOperations() {
+    FGFDMExec fdmex;
+    auto pm = fdmex.GetPropertyManager();
+    auto x = pm->GetNode("x", true);
+    const double values[] {-2.5, -0.3, 0.0, 0.1, 0.9, 3.7};
+    const std::string ops[] {"toradians", "todegrees", "sqrt", "log2", "ln",
+                             "log10", "sign", "exp", "abs", "sin", "cos", "tan",
+                             "asin", "acos", "atan", "floor", "ceil",
+                             "fraction", "integer"};
+
+    for (const auto& op: ops) {
+      Element_ptr elm = readFromXML("<function><" + op + "><p>x</p></" + op
+                                    + "></function>");
+      FGFunction f(&fdmex, elm);
+
+      for (double vx: values) {
+        x->setDoubleValue(vx);
+        double expected, scratch;
+        if (op == "toradians") expected = vx*M_PI/180.;
+        else if (op == "todegrees") expected = vx*180./M_PI;
+        else if (op == "sqrt") expected = vx >= 0.0 ? sqrt(vx) : -HUGE_VAL;
+        else if (op == "log2") expected = vx > 0.0 ? log10(vx)/log10(2.0) : -HUGE_VAL;
+        else if (op == "ln") expected = vx > 0.0 ? log(vx) : -HUGE_VAL;
+        else if (op == "log10") expected = vx > 0.0 ? log10(vx) : -HUGE_VAL;
+        else if (op == "sign") expected = vx < 0.0 ? -1.0 : 1.0;
+        else if (op == "exp") expected = exp(vx);
+        else if (op == "abs") expected = fabs(vx);
+        else if (op == "sin") expected = sin(vx);
+        else if (op == "cos") expected = cos(vx);
+        else if (op == "tan") expected = tan(vx);
+        else if (op == "asin") expected = asin(vx);
+        else if (op == "acos") expected = acos(vx);
+        else if (op == "atan") expected = atan(vx);
+        else if (op == "floor") expected = floor(vx);
+        else if (op == "ceil") expected = ceil(vx);
+        else if (op == "fraction") expected = modf(vx, &scratch);
+        else modf(vx, &expected);
+
+        double result = f.GetValue();
+        if (std::isnan(expected))
+          TS_ASSERT(std::isnan(result));
+        else if (op == "log2" && vx > 0.0)
+          TS_ASSERT_DELTA(result, expected, 1E-15);
+        else
+          TS_ASSERT_EQUALS(result, expected);
+      }
+    }
+  }
+
+  void testMod() {
+    FGFDMExec fdmex;
+    auto pm = fdmex.GetPropertyManager();
+    auto x = pm->GetNode("x", true);
+    Element_ptr elm = readFromXML("<function>"
+                                  "  <mod><p>x</p><v>3</v></mod>"
+                                  "</function>");
+    FGFunction f(&fdmex, elm);
+
+    x->setDoubleValue(7.9);
+    TS_ASSERT_EQUALS(f.GetValue(), 1.0);
+    x->setDoubleValue(-7.9);
+    TS_ASSERT_EQUALS(f.GetValue(), -1.0);
+  }
+
+  void testLateBoundProperty() {
+    FGFDMExec fdmex;
+    auto pm = fdmex.GetPropertyManager();
+    auto x = pm->GetNode("x", true);
+    Element_ptr elm = readFromXML("<function>"
+                                  "  <product><p>x</p><p>-y</p></product>"
+                                  "</function>");
+    FGFunction f(&fdmex, elm);
+
+    auto y = pm->GetNode("y", true);
+    x->setDoubleValue(2.0);
+    y->setDoubleValue(3.0);
+    TS_ASSERT_EQUALS(f.GetValue(), -6.0);
+    y->setDoubleValue(-0.5);
+    TS_ASSERT_EQUALS(f.GetValue(), 1.0);
+  }
+
+  void testNonCompiledOperations() {
+    FGFDMExec fdmex;
+    auto pm = fdmex.GetPropertyManager();
+    auto x = pm->GetNode("x", true);
+    auto y = pm->GetNode("y", true);
+    Element_ptr elm = readFromXML("<function>"
+                                  "  <sum>"
+                                  "    <ifthen>"
+                                  "      <gt><p>x</p><v>0.0</v></gt>"
+                                  "      <p>y</p>"
+                                  "      <product><v>2.0</v><p>y</p></product>"
+                                  "    </ifthen>"
+                                  "    <table>"
+                                  "      <independentVar>x</independentVar>"
+                                  "      <tableData>"
+                                  "        -1.0 -10.0\n"
+                                  "         1.0  10.0\n"
+                                  "      </tableData>"
+                                  "    </table>"
+                                  "  </sum>"
+                                  "</function>");
+    FGFunction f(&fdmex, elm);
+
+    x->setDoubleValue(0.5);
+    y->setDoubleValue(3.0);
+    TS_ASSERT_EQUALS(f.GetValue(), 8.0);
+    x->setDoubleValue(-0.5);
+    TS_ASSERT_EQUALS(f.GetValue(), 1.0);
+  }
+
+  void testCopyToAndCache() {
+    FGFDMExec fdmex;
+    auto pm = fdmex.GetPropertyManager();
+    auto x = pm->GetNode("x", true);
+    auto z = pm->GetNode("z", true);
+    Element_ptr elm = readFromXML("<function copyto=\"z\">"
+                                  "  <product><p>x</p><v>2.0</v></product>"
+                                  "</function>");
+    FGFunction f(&fdmex, elm);
+
+    x->setDoubleValue(1.5);
+    TS_ASSERT_EQUALS(f.GetValue(), 3.0);
+    TS_ASSERT_EQUALS(z->getDoubleValue(), 3.0);
+
+    f.cacheValue(true);
+    x->setDoubleValue(2.0);
+    TS_ASSERT_EQUALS(f.GetValue(), 3.0);
+    f.cacheValue(false);
+    TS_ASSERT_EQUALS(f.GetValue(), 4.0);
+    TS_ASSERT_EQUALS(z->getDoubleValue(), 4.0);
+  }
+
+  void testConstantFolding() {
+    FGFDMExec fdmex;
+    auto pm = fdmex.GetPropertyManager();
+    auto x = pm->GetNode("x", true);
+    const double values[] {-2.5, -1.0, 0.0, 0.1, 1.0, 3.7};
+
+    Element_ptr elm = readFromXML("<function>"
+                                  "  <sum>"
+                                  "    <product><v>0.3</v><pi/><p>x</p><v>0.7</v></product>"
+                                  "    <difference><v>1.1</v><v>0.2</v><p>x</p></difference>"
+                                  "    <min><v>0.5</v><v>-0.5</v><p>x</p></min>"
+                                  "    <max><v>0.5</v><v>-0.5</v><p>x</p></max>"
+                                  "  </sum>"
+                                  "</function>");
+    FGFunction f(&fdmex, elm);
+
+    for (double vx: values) {
+      x->setDoubleValue(vx);
+      double expected = 0.0;
+      expected += 0.3*M_PI*vx*0.7;
+      expected += 1.1-0.2-vx;
+      expected += std::min(-0.5, vx);
+      expected += std::max(0.5, vx);
+      TS_ASSERT_EQUALS(f.GetValue(), expected);
+    }
+  }
+
+  void testSharedExpressions() {
+    FGFDMExec fdmex;
+    auto pm = fdmex.GetPropertyManager();
+    auto x = pm->GetNode("x", true);
+    auto y = pm->GetNode("y", true);
+    auto z = pm->GetNode("z", true);
+    auto shared = fdmex.GetSharedExpressions();
+
+    Element_ptr elm1 = readFromXML("<function>"
+                                   "  <product><p>x</p><p>y</p><p>z</p></product>"
+                                   "</function>");
+    Element_ptr elm2 = readFromXML("<function>"
+                                   "  <sum>"
+                                   "    <v>1.0</v>"
+                                   "    <product><p>x</p><p>y</p><v>2.0</v></product>"
+                                   "  </sum>"
+                                   "</function>");
+    FGFunction f1(&fdmex, elm1);
+    FGFunction f2(&fdmex, elm2);
+
+    shared->Share();
+    TS_ASSERT_EQUALS(shared->GetNumShared(), 1);
+
+    x->setDoubleValue(1.5);
+    y->setDoubleValue(-0.3);
+    z->setDoubleValue(0.7);
+    TS_ASSERT_EQUALS(f1.GetValue(), 1.5*-0.3*0.7);
+    TS_ASSERT_EQUALS(f2.GetValue(), 1.0+1.5*-0.3*2.0);
+
+    // Outside of a pass, the shared expressions are evaluated each time.
+    x->setDoubleValue(2.0);
+    TS_ASSERT_EQUALS(f1.GetValue(), 2.0*-0.3*0.7);
+    TS_ASSERT_EQUALS(f2.GetValue(), 1.0+2.0*-0.3*2.0);
+
+    // Within a pass, the shared expressions are evaluated only once.
+    x->setDoubleValue(2.5);
+    shared->BeginPass();
+    TS_ASSERT_EQUALS(f1.GetValue(), 2.5*-0.3*0.7);
+    x->setDoubleValue(3.0);
+    TS_ASSERT_EQUALS(f2.GetValue(), 1.0+2.5*-0.3*2.0);
+    shared->EndPass();
+
+    // Properties that are modified during a pass must invalidate the values
+    // computed so far.
+    shared->BeginPass();
+    TS_ASSERT_EQUALS(f1.GetValue(), 3.0*-0.3*0.7);
+    x->setDoubleValue(3.5);
+    shared->Invalidate();
+    TS_ASSERT_EQUALS(f2.GetValue(), 1.0+3.5*-0.3*2.0);
+    shared->EndPass();
+  }
+
+  void testInputs() {
+    FGFDMExec fdmex;
+    auto pm = fdmex.GetPropertyManager();
+    auto x = pm->GetNode("x", true);
+    auto y = pm->GetNode("y", true);
+    Element_ptr elm = readFromXML("<function>"
+                                  "  <sum>"
+                                  "    <product><p>x</p><p>y</p></product>"
+                                  "    <p>x</p>"
+                                  "    <v>1.0</v>"
+                                  "  </sum>"
+                                  "</function>");
+    FGFunction f(&fdmex, elm);
+    std::vector<FGPropertyNode*> inputs;
+
+    TS_ASSERT(f.GetInputs(inputs));
+    TS_ASSERT_EQUALS(inputs.size(), 3);
+    TS_ASSERT_EQUALS(inputs[0], x);
+    TS_ASSERT_EQUALS(inputs[1], y);
+    TS_ASSERT_EQUALS(inputs[2], x);
+
+    Element_ptr elm2 = readFromXML("<function>"
+                                   "  <product><p>x</p><random/></product>"
+                                   "</function>");
+    FGFunction f2(&fdmex, elm2);
+    inputs.clear();
+    TS_ASSERT(!f2.GetInputs(inputs));
+  }
+
+  void testMemoization() {
+    FGFDMExec fdmex;
+    auto pm = fdmex.GetPropertyManager();
+    auto x = pm->GetNode("x", true);
+    auto y = pm->GetNode("y", true);
+    double value = 0.0;
+    Element_ptr elm = readFromXML("<function>"
+                                  "  <sum><p>x</p><p>y</p></sum>"
+                                  "</function>");
+    FGFunction f(&fdmex, elm);
+
+    x->setDoubleValue(1.0);
+    y->setDoubleValue(2.0);
+    TS_ASSERT_EQUALS(f.GetValue(), 3.0);
+    TS_ASSERT_EQUALS(f.GetValue(), 3.0);
+    y->setDoubleValue(-2.0);
+    TS_ASSERT_EQUALS(f.GetValue(), -1.0);
+    x->setDoubleValue(0.5);
+    TS_ASSERT_EQUALS(f.GetValue(), -1.5);
+
+    // A function which input is tied is evaluated each time.
+    Element_ptr elm2 = readFromXML("<function>"
+                                   "  <product><p>x</p><p>z</p></product>"
+                                   "</function>");
+    pm->Tie("z", &value);
+    FGFunction f2(&fdmex, elm2);
+
+    value = 2.0;
+    TS_ASSERT_EQUALS(f2.GetValue(), 1.0);
+    value = 4.0;
+    TS_ASSERT_EQUALS(f2.GetValue(), 2.0);
+    x->setDoubleValue(1.0);
+    TS_ASSERT_EQUALS(f2.GetValue(), 4.0);
+    pm->Untie("z");
+  }
+
+  void testMemoizationOfLateTiedInput() {
+    FGFDMExec fdmex;
+    auto pm = fdmex.GetPropertyManager();
+    auto x = pm->GetNode("x", true);
+    auto y = pm->GetNode("y", true);
+    double value = 0.0;
+    Element_ptr elm = readFromXML("<function>"
+                                  "  <sum><p>x</p><p>y</p></sum>"
+                                  "</function>");
+    FGFunction f(&fdmex, elm);
+
+    x->setDoubleValue(1.0);
+    y->setDoubleValue(2.0);
+    TS_ASSERT_EQUALS(f.GetValue(), 3.0);
+
+    // The input y is tied after the function has turned its memoization on:
+    // the changes of the tied value must not be missed.
+    pm->Tie("y", &value);
+    value = 4.0;
+    TS_ASSERT_EQUALS(f.GetValue(), 5.0);
+    value = -1.0;
+    TS_ASSERT_EQUALS(f.GetValue(), 0.0);
+    value = 3.0;
+    TS_ASSERT_EQUALS(f.GetValue(), 4.0);
+    x->setDoubleValue(2.0);
+    TS_ASSERT_EQUALS(f.GetValue(), 5.0);
+    pm->Untie("y");
+  }
+};
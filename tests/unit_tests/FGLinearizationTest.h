@@ -0,0 +1,78 @@
+#include <memory>
+#include <vector>
+
+#include <cxxtest/TestSuite.h>
+
+#include <FGFDMExec.h>
+#include <initialization/FGInitialCondition.h>
+#include <initialization/FGLinearization.h>
+#include "TestUtilities.h"
+
+using namespace JSBSim;
+
+// Runs the script c1722 until the aircraft is trimmed with its engine running.
+std::unique_ptr<FGFDMExec> TrimmedC172(void)
+{
+  auto fdmex = CreateExec();
+  fdmex->SetOutputFileName(0, "linearization_c1722.csv");
+  if (!fdmex->LoadScript(SGPath("scripts/c1722.xml"))) return nullptr;
+  if (!fdmex->RunIC()) return nullptr;
+
+  while (fdmex->GetSimTime() < 1.0 && fdmex->Run());
+  return fdmex;
+}
+
+bool SameMatrices(const FGLinearization& lin1, const FGLinearization& lin2)
+{
+  return lin1.GetSystemMatrix() == lin2.GetSystemMatrix()
+    && lin1.GetInputMatrix() == lin2.GetInputMatrix()
+    && lin1.GetOutputMatrix() == lin2.GetOutputMatrix()
+    && lin1.GetFeedforwardMatrix() == lin2.GetFeedforwardMatrix();
+}
+
+class FGLinearizationTest : public CxxTest::TestSuite
+{
+public:
+  void testSerial() {
+    auto fdmex = TrimmedC172();
+    TS_ASSERT(fdmex);
+    std::vector<char> trimmed = fdmex->SaveSnapshot();
+
+    FGLinearization lin(fdmex.get());
+    size_t nx = lin.GetStateNames().size();
+    size_t nu = lin.GetInputNames().size();
+    TS_ASSERT_EQUALS(nx, 13); // The propeller RPM is a state
+    TS_ASSERT_EQUALS(nu, 4);
+    TS_ASSERT_EQUALS(lin.GetSystemMatrix().size(), nx);
+    TS_ASSERT_EQUALS(lin.GetSystemMatrix()[0].size(), nx);
+    TS_ASSERT_EQUALS(lin.GetInputMatrix().size(), nx);
+    TS_ASSERT_EQUALS(lin.GetInputMatrix()[0].size(), nu);
+    TS_ASSERT_EQUALS(lin.GetOutputMatrix().size(), nx);
+    TS_ASSERT_EQUALS(lin.GetFeedforwardMatrix()[0].size(), nu);
+
+    // The outputs are the states.
+    const auto& C = lin.GetOutputMatrix();
+    TS_ASSERT_DELTA(C[0][0], 1.0, 1E-6);
+    TS_ASSERT_DELTA(C[1][1], 1.0, 1E-6);
+    TS_ASSERT_DELTA(C[0][1], 0.0, 1E-6);
+
+    // Each perturbation starts from the same state so the linearization of
+    // the same state gives the same result.
+    TS_ASSERT(fdmex->RestoreSnapshot(trimmed));
+    FGLinearization lin2(fdmex.get());
+    TS_ASSERT(SameMatrices(lin, lin2));
+    remove("linearization_c1722.csv");
+  }
+
+  void testParallel() {
+    auto fdmex = TrimmedC172();
+    TS_ASSERT(fdmex);
+    std::vector<char> trimmed = fdmex->SaveSnapshot();
+
+    FGLinearization lin(fdmex.get());
+    TS_ASSERT(fdmex->RestoreSnapshot(trimmed));
+    FGLinearization lin3(fdmex.get(), 3);
+    TS_ASSERT(SameMatrices(lin, lin3));
+    remove("linearization_c1722.csv");
+  }
+};
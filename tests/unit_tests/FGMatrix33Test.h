@@ -342,6 +342,12 @@ public:
       }
     TS_ASSERT_EQUALS(m.Dump(", "), os.str());
 
+    std::ostringstream os2;
+    os2.precision(3);
+    m.Dump(os2, ", ");
+    TS_ASSERT_EQUALS(os2.str(), os.str());
+    TS_ASSERT_EQUALS(os2.precision(), 3);
+
     os.clear();
     os.str("");
     for (int i=1; i<=3; i++) {
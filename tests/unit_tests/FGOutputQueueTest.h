@@ -0,0 +1,121 @@
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <cxxtest/TestSuite.h>
+
+#include <input_output/FGOutputQueue.h>
+
+using namespace JSBSim;
+
+// Writer that records the values it receives and that can be held so that the
+// queue fills up.
+class GatedWriter
+{
+public:
+  void operator()(const char* record) {
+    Started = true;
+    std::unique_lock<std::mutex> lock(Mutex);
+    Gate.wait(lock, [this]{ return Open; });
+    Values.push_back(*reinterpret_cast<const int*>(record));
+  }
+
+  void Release(void) {
+    {
+      std::lock_guard<std::mutex> lock(Mutex);
+      Open = true;
+    }
+    Gate.notify_all();
+  }
+
+  // Waits until the writer thread is holding the first record.
+  void WaitStarted(void) { while (!Started) std::this_thread::yield(); }
+
+  std::vector<int> Values;
+  std::atomic<bool> Started{false};
+
+private:
+  std::mutex Mutex;
+  std::condition_variable Gate;
+  bool Open = false;
+};
+
+class FGOutputQueueTest : public CxxTest::TestSuite
+{
+public:
+  void testPolicyNames() {
+    FGOutputQueue::ePolicy policy;
+    TS_ASSERT(FGOutputQueue::GetPolicy("block", policy));
+    TS_ASSERT_EQUALS(policy, FGOutputQueue::pBlock);
+    TS_ASSERT(FGOutputQueue::GetPolicy("drop-oldest", policy));
+    TS_ASSERT_EQUALS(policy, FGOutputQueue::pDropOldest);
+    TS_ASSERT(FGOutputQueue::GetPolicy("drop-newest", policy));
+    TS_ASSERT_EQUALS(policy, FGOutputQueue::pDropNewest);
+    TS_ASSERT(!FGOutputQueue::GetPolicy("drop", policy));
+  }
+
+  void testBlock() {
+    std::vector<int> values;
+    FGOutputQueue queue(sizeof(int), 2, FGOutputQueue::pBlock,
+                        [&values](const char* record) {
+                          values.push_back(*reinterpret_cast<const int*>(record));
+                        });
+
+    for (int i=0; i<1000; ++i)
+      queue.Push(reinterpret_cast<const char*>(&i));
+    queue.Flush();
+
+    TS_ASSERT_EQUALS(queue.GetDropped(), 0);
+    TS_ASSERT_EQUALS(queue.GetWritten(), 1000);
+    TS_ASSERT_EQUALS(values.size(), 1000);
+    for (int i=0; i<1000; ++i)
+      TS_ASSERT_EQUALS(values[i], i);
+  }
+
+  void testDropOldest() {
+    GatedWriter writer;
+    {
+      FGOutputQueue queue(sizeof(int), 2, FGOutputQueue::pDropOldest,
+                          std::ref(writer));
+      Fill(queue, writer);
+      TS_ASSERT_EQUALS(queue.GetDropped(), 2);
+      writer.Release();
+    }
+
+    // The queue is destroyed after the remaining records have been written.
+    CheckValues(writer.Values, {0, 3, 4});
+  }
+
+  void testDropNewest() {
+    GatedWriter writer;
+    FGOutputQueue queue(sizeof(int), 2, FGOutputQueue::pDropNewest,
+                        std::ref(writer));
+    Fill(queue, writer);
+    TS_ASSERT_EQUALS(queue.GetDropped(), 2);
+    writer.Release();
+    queue.Flush();
+
+    CheckValues(writer.Values, {0, 1, 2});
+    TS_ASSERT_EQUALS(queue.GetWritten(), 3);
+  }
+
+private:
+  void CheckValues(const std::vector<int>& values,
+                   const std::vector<int>& expected) {
+    TS_ASSERT_EQUALS(values.size(), expected.size());
+    for (unsigned int i=0; i<values.size() && i<expected.size(); ++i)
+      TS_ASSERT_EQUALS(values[i], expected[i]);
+  }
+
+  // Pushes 5 records while the writer is holding the first one so that 2
+  // records overflow the queue.
+  void Fill(FGOutputQueue& queue, GatedWriter& writer) {
+    int i = 0;
+    queue.Push(reinterpret_cast<const char*>(&i));
+    writer.WaitStarted();
+    for (i=1; i<5; ++i)
+      queue.Push(reinterpret_cast<const char*>(&i));
+  }
+};
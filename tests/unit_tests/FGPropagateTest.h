@@ -0,0 +1,56 @@
+#include <cxxtest/TestSuite.h>
+
+#include <models/FGPropagate.h>
+
+using namespace JSBSim;
+
+class FGPropagateTest : public CxxTest::TestSuite
+{
+public:
+  void testHistoryCapacity() {
+    // The history holds the derivatives of the highest order integrator and
+    // they are stored in place.
+    TS_ASSERT_EQUALS(FGPropagate::History<double>::size(), 5);
+    TS_ASSERT_LESS_THAN_EQUALS(5*sizeof(FGColumnVector3),
+                               sizeof(FGPropagate::History<FGColumnVector3>));
+  }
+
+  void testHistoryAssign() {
+    FGPropagate::History<FGColumnVector3> history;
+    const FGColumnVector3 v(1.0, 2.0, 3.0);
+
+    history.assign(v);
+    for (unsigned int i=0; i<history.size(); ++i)
+      TS_ASSERT_EQUALS(history[i], v);
+
+    FGPropagate::History<FGQuaternion> qhistory;
+    qhistory.assign(FGQuaternion());
+    for (unsigned int i=0; i<qhistory.size(); ++i) {
+      TS_ASSERT_EQUALS(qhistory[i](1), 1.0);
+      TS_ASSERT_EQUALS(qhistory[i](2), 0.0);
+      TS_ASSERT_EQUALS(qhistory[i](3), 0.0);
+      TS_ASSERT_EQUALS(qhistory[i](4), 0.0);
+    }
+  }
+
+  void testHistoryPush() {
+    FGPropagate::History<double> history;
+    history.assign(0.0);
+
+    // The most recent value comes first and the oldest ones are dropped once
+    // the history is full, including when the head wraps around.
+    for (int n=1; n<=12; ++n) {
+      history.push_front(n);
+      TS_ASSERT_EQUALS(history[0], n);
+      for (unsigned int i=1; i<history.size(); ++i)
+        TS_ASSERT_EQUALS(history[i], n > int(i) ? n-int(i) : 0.0);
+    }
+
+    // assign() resets the whole history.
+    history.assign(-1.0);
+    history.push_front(5.0);
+    TS_ASSERT_EQUALS(history[0], 5.0);
+    for (unsigned int i=1; i<history.size(); ++i)
+      TS_ASSERT_EQUALS(history[i], -1.0);
+  }
+};
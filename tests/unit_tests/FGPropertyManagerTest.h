@@ -16,4 +16,113 @@ public:
     TS_ASSERT_EQUALS(root->GetName(), "");
     TS_ASSERT_EQUALS(root->GetFullyQualifiedName(), "/");
   }
+
+  void testVersion() {
+    auto pm = std::make_shared<FGPropertyManager>();
+    auto node = pm->GetNode("x", true);
+    double value = 0.0;
+
+    TS_ASSERT(node->hasLocalValue());
+    node->setDoubleValue(1.0);
+    unsigned long version = node->getVersion();
+
+    // Writing the same value does not change the version.
+    node->setDoubleValue(1.0);
+    TS_ASSERT_EQUALS(node->getVersion(), version);
+    node->setDoubleValue(2.0);
+    TS_ASSERT_DIFFERS(node->getVersion(), version);
+    version = node->getVersion();
+    node->setDoubleValue(-0.0);
+    node->setDoubleValue(0.0);
+    TS_ASSERT_EQUALS(node->getVersion(), version+2);
+
+    // Tied properties have no local value: their version cannot be trusted.
+    pm->Tie("x", &value);
+    TS_ASSERT(!node->hasLocalValue());
+    TS_ASSERT_DIFFERS(node->getVersion(), version+2);
+    pm->Untie("x");
+    TS_ASSERT(node->hasLocalValue());
+  }
+
+  void testDoubleValue() {
+    auto pm = std::make_shared<FGPropertyManager>();
+    auto node = pm->GetNode("x", true);
+    double value = 1.0;
+
+    node->setDoubleValue(2.0);
+    TS_ASSERT_EQUALS(node->getDoubleValue(), 2.0);
+
+    pm->Tie("x", &value);
+    TS_ASSERT_EQUALS(node->getDoubleValue(), 1.0);
+    value = 3.0;
+    TS_ASSERT_EQUALS(node->getDoubleValue(), 3.0);
+
+    // Unreadable properties return the default value.
+    node->setAttribute(SGPropertyNode::READ, false);
+    TS_ASSERT_EQUALS(node->getDoubleValue(), 0.0);
+    node->setAttribute(SGPropertyNode::READ, true);
+    TS_ASSERT_EQUALS(node->getDoubleValue(), 3.0);
+
+    // The value is preserved when the property is untied.
+    pm->Untie("x");
+    value = 4.0;
+    TS_ASSERT_EQUALS(node->getDoubleValue(), 3.0);
+    node->setDoubleValue(5.0);
+    TS_ASSERT_EQUALS(node->getDoubleValue(), 5.0);
+    TS_ASSERT_EQUALS(value, 4.0);
+
+    // Properties of other types are converted.
+    auto flag = pm->GetNode("flag", true);
+    flag->setBoolValue(true);
+    TS_ASSERT_EQUALS(flag->getDoubleValue(), 1.0);
+  }
+
+  void testHandles() {
+    auto pm = std::make_shared<FGPropertyManager>();
+    auto x = pm->GetNode("a/x", true);
+    auto y = pm->GetNode("a/y", true);
+
+    TS_ASSERT_EQUALS(pm->GetHandle("a/z"), FGPropertyManager::InvalidHandle);
+
+    auto hx = pm->GetHandle("a/x");
+    auto hy = pm->GetHandle("/a/y");
+    TS_ASSERT_DIFFERS(hx, hy);
+    TS_ASSERT_EQUALS(pm->GetHandle("a/x"), hx);
+    TS_ASSERT_EQUALS(pm->GetHandle("/a/x"), hx);
+    TS_ASSERT_EQUALS(pm->GetNode(hx), x);
+    TS_ASSERT_EQUALS(pm->GetNode(hy), y);
+
+    x->setDoubleValue(1.0);
+    TS_ASSERT_EQUALS(pm->GetDouble(hx), 1.0);
+    pm->SetDouble(hy, -2.0);
+    TS_ASSERT_EQUALS(y->getDoubleValue(), -2.0);
+
+    // Properties can be created on demand.
+    auto hz = pm->GetHandle("a/z", true);
+    TS_ASSERT_DIFFERS(hz, FGPropertyManager::InvalidHandle);
+    TS_ASSERT(pm->HasNode("a/z"));
+
+    const FGPropertyManager::PropertyHandle h[] {hz, hx, hy};
+    const double values[] {3.0, 4.0, 5.0};
+    double results[3];
+    pm->SetDoubles(h, values, 3);
+    pm->GetDoubles(h, results, 3);
+    TS_ASSERT_EQUALS(results[0], 3.0);
+    TS_ASSERT_EQUALS(results[1], 4.0);
+    TS_ASSERT_EQUALS(results[2], 5.0);
+    TS_ASSERT_EQUALS(x->getDoubleValue(), 4.0);
+
+    // Invalid handles are rejected without modifying any property.
+    const auto invalid = FGPropertyManager::InvalidHandle;
+    const FGPropertyManager::PropertyHandle hbad[] {hx, hz+1};
+    TS_ASSERT(pm->IsValidHandle(hz));
+    TS_ASSERT(!pm->IsValidHandle(hz+1));
+    TS_ASSERT(!pm->IsValidHandle(invalid));
+    TS_ASSERT(!pm->GetNode(invalid));
+    TS_ASSERT_THROWS(pm->GetDouble(invalid), BaseException&);
+    TS_ASSERT_THROWS(pm->SetDouble(hz+1, 0.0), BaseException&);
+    TS_ASSERT_THROWS(pm->GetDoubles(hbad, results, 2), BaseException&);
+    TS_ASSERT_THROWS(pm->SetDoubles(hbad, values, 2), BaseException&);
+    TS_ASSERT_EQUALS(x->getDoubleValue(), 4.0);
+  }
 };
@@ -0,0 +1,160 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cxxtest/TestSuite.h>
+
+#include <FGFDMExec.h>
+#include <input_output/FGSnapshot.h>
+#include <math/FGColumnVector3.h>
+#include "TestUtilities.h"
+
+using namespace JSBSim;
+
+// Loads a script with its output written to snapshot_<script>.csv.
+std::unique_ptr<FGFDMExec> LoadScript(const std::string& script)
+{
+  return LoadScript(script, "snapshot_" + script + ".csv");
+}
+
+class FGSnapshotTest : public CxxTest::TestSuite
+{
+public:
+  void testSyncValues() {
+    double x = 1.5;
+    int n = -3;
+    bool flag = true;
+    double array[2] = {2.0, 3.0};
+    std::vector<int> v = {4, 5, 6};
+    std::string s = "snapshot";
+    FGColumnVector3 vec(7.0, 8.0, 9.0);
+
+    FGSnapshot saved;
+    saved.Sync(x);
+    saved.Sync(n);
+    saved.Sync(flag);
+    saved.Sync(array);
+    saved.Sync(v);
+    saved.Sync(s);
+    saved.Sync(vec);
+
+    x = 0.0; n = 0; flag = false; array[0] = array[1] = 0.0;
+    v.clear(); s.clear(); vec.InitMatrix();
+
+    const std::vector<char>& blob = saved.GetData();
+    FGSnapshot restored(blob.data(), blob.size());
+    TS_ASSERT(!restored.IsSaving());
+    restored.Sync(x);
+    restored.Sync(n);
+    restored.Sync(flag);
+    restored.Sync(array);
+    restored.Sync(v);
+    restored.Sync(s);
+    restored.Sync(vec);
+    TS_ASSERT(restored.AtEnd());
+
+    TS_ASSERT_EQUALS(x, 1.5);
+    TS_ASSERT_EQUALS(n, -3);
+    TS_ASSERT(flag);
+    TS_ASSERT_EQUALS(array[0], 2.0);
+    TS_ASSERT_EQUALS(array[1], 3.0);
+    TS_ASSERT_EQUALS(v.size(), 3);
+    TS_ASSERT_EQUALS(v[2], 6);
+    TS_ASSERT_EQUALS(s, "snapshot");
+    TS_ASSERT_EQUALS(vec(3), 9.0);
+
+    FGSnapshot truncated(blob.data(), 4);
+    TS_ASSERT_THROWS(truncated.Sync(x), BaseException&);
+
+    FGSnapshot checked(blob.data(), blob.size());
+    TS_ASSERT_THROWS(checked.Check(2), BaseException&);
+  }
+
+  void testRestoreSameInstance() {
+    auto fdmex = LoadScript("c1723");
+    TS_ASSERT(fdmex);
+
+    RunFrames(fdmex.get(), 500);
+    std::vector<char> blob = fdmex->SaveSnapshot();
+    TS_ASSERT(!blob.empty());
+
+    std::vector<double> ref = RunFrames(fdmex.get(), 500);
+    TS_ASSERT(fdmex->RestoreSnapshot(blob));
+    std::vector<double> values = RunFrames(fdmex.get(), 500);
+
+    // The run continued from the snapshot is the same bit for bit.
+    AssertSameRecording(values, ref);
+    remove("snapshot_c1723.csv");
+  }
+
+  void testRestoreOtherInstance() {
+    // The script c1722 trims the aircraft and starts its engine.
+    auto fdmex = LoadScript("c1722");
+    TS_ASSERT(fdmex);
+
+    RunFrames(fdmex.get(), 800);
+    std::vector<char> blob = fdmex->SaveSnapshot();
+    std::vector<double> ref = RunFrames(fdmex.get(), 800);
+    fdmex.reset();
+
+    fdmex = LoadScript("c1722");
+    TS_ASSERT(fdmex);
+    TS_ASSERT(fdmex->RestoreSnapshot(blob));
+    TS_ASSERT_EQUALS(fdmex->GetFrame(), 800);
+    std::vector<double> values = RunFrames(fdmex.get(), 800);
+
+    AssertSameRecording(values, ref);
+    remove("snapshot_c1722.csv");
+  }
+
+  void testCachedReload() {
+    auto fdmex = LoadScript("c1722");
+    TS_ASSERT(fdmex);
+    TS_ASSERT(!fdmex->GetDocumentCache());
+    RunFrames(fdmex.get(), 800);
+
+    // The first reload creates the document cache.
+    auto copy = fdmex->CachedReload();
+    TS_ASSERT(copy);
+    TS_ASSERT(fdmex->GetDocumentCache());
+    TS_ASSERT_EQUALS(copy->GetSimTime(), fdmex->GetSimTime());
+
+    // The copy has its own property tree.
+    TS_ASSERT_DIFFERS(copy->GetPropertyManager()->GetNode(),
+                      fdmex->GetPropertyManager()->GetNode());
+    double alt = fdmex->GetPropertyValue("position/h-sl-ft");
+    copy->SetPropertyValue("position/h-sl-ft", alt+1000.0);
+    TS_ASSERT_EQUALS(fdmex->GetPropertyValue("position/h-sl-ft"), alt);
+
+    copy = fdmex->CachedReload();
+    TS_ASSERT(copy);
+    std::vector<double> ref = RunFrames(fdmex.get(), 800);
+    std::vector<double> values = RunFrames(copy.get(), 800);
+
+    AssertSameRecording(values, ref);
+    remove("snapshot_c1722.csv");
+  }
+
+  void testRestoreFailure() {
+    auto fdmex = LoadScript("c1723");
+    TS_ASSERT(fdmex);
+    RunFrames(fdmex.get(), 10);
+    std::vector<char> blob = fdmex->SaveSnapshot();
+    double time = fdmex->GetSimTime();
+
+    // A truncated blob is rejected.
+    std::vector<char> truncated(blob.begin(), blob.begin()+blob.size()/2);
+    TS_ASSERT(!fdmex->RestoreSnapshot(truncated));
+
+    // A snapshot of another aircraft is rejected.
+    auto other = LoadScript("ball_orbit");
+    TS_ASSERT(other);
+    TS_ASSERT(!other->RestoreSnapshot(blob));
+    TS_ASSERT(!fdmex->RestoreSnapshot(other->SaveSnapshot()));
+
+    TS_ASSERT(fdmex->RestoreSnapshot(blob));
+    TS_ASSERT_EQUALS(fdmex->GetSimTime(), time);
+    remove("snapshot_c1723.csv");
+    remove("snapshot_ball_orbit.csv");
+  }
+};
@@ -1,5 +1,6 @@
 #include <sstream>
 #include <limits>
+#include <vector>
 
 #include <cxxtest/TestSuite.h>
 #include <math/FGTable.h>
@@ -101,6 +102,45 @@ public:
     TS_ASSERT_EQUALS(t2.GetValue(2.47), 1.5);  // Saturated value
   }
 
+  void testGetValueLargeTable() {
+    FGTable t(100);
+    for (unsigned int i=0; i<100; ++i)
+      t << 0.1*i*i << 3.0*i - 0.5;
+
+    // The result must not depend on the breakpoints found by the previous
+    // lookups: compare with a fresh copy of the table for sweeps in both
+    // directions and for jumps across the table.
+    for (double key=-1.0; key <= 1000.0; key += 0.37) {
+      FGTable fresh(t);
+      TS_ASSERT_EQUALS(t.GetValue(key), fresh.GetValue(key));
+    }
+    for (double key=1000.0; key >= -1.0; key -= 0.41) {
+      FGTable fresh(t);
+      TS_ASSERT_EQUALS(t.GetValue(key), fresh.GetValue(key));
+    }
+    for (unsigned int i=0; i<100; ++i) {
+      double key = 0.1*((i*37)%100)*((i*37)%100);
+      FGTable fresh(t);
+      TS_ASSERT_EQUALS(t.GetValue(key), fresh.GetValue(key));
+      TS_ASSERT_EQUALS(t.GetValue(key), 3.0*((i*37)%100) - 0.5);
+      TS_ASSERT_EQUALS(t.GetValue(key+0.05), fresh.GetValue(key+0.05));
+    }
+  }
+
+  void testGetValues() {
+    FGTable t(50);
+    for (unsigned int i=0; i<50; ++i)
+      t << 0.1*i*i << 3.0*i - 0.5;
+
+    std::vector<double> keys, results(103);
+    for (unsigned int i=0; i<103; ++i)
+      keys.push_back(-3.0 + 2.5*i - 0.013*i*i);
+
+    t.GetValues(keys.data(), results.data(), keys.size());
+    for (unsigned int i=0; i<keys.size(); ++i)
+      TS_ASSERT_EQUALS(results[i], t.GetValue(keys[i]));
+  }
+
   void testLookupProperty() {
     auto pm = make_shared<FGPropertyManager>();
     auto node = pm->GetNode("x", true);
@@ -121,6 +161,30 @@ public:
     TS_ASSERT_EQUALS(t.GetValue(),  1.5);
   }
 
+  void testLookupPropertyTied() {
+    auto pm = make_shared<FGPropertyManager>();
+    auto node = pm->GetNode("x", true);
+    double value = 1.5;
+    FGTable t(2);
+    t << 1.0 << -1.0
+      << 2.0 << 1.5;
+    t.SetRowIndexProperty(node);
+    pm->Tie("x", &value);
+
+    std::vector<FGPropertyNode*> inputs;
+    TS_ASSERT(t.GetInputs(inputs));
+    TS_ASSERT_EQUALS(inputs.size(), 1);
+    TS_ASSERT_EQUALS(inputs[0], node);
+
+    TS_ASSERT_EQUALS(t.GetValue(), 0.25);
+    TS_ASSERT_EQUALS(t.GetValue(), 0.25);
+    value = 2.0;
+    TS_ASSERT_EQUALS(t.GetValue(), 1.5);
+    value = 1.0;
+    TS_ASSERT_EQUALS(t.GetValue(), -1.0);
+    pm->Untie("x");
+  }
+
   void testLoadInternalFromXML() {
     auto pm = make_shared<FGPropertyManager>();
     // FGTable expects <table> to be the child of another XML element, hence the
@@ -574,6 +638,68 @@ public:
     TS_ASSERT_EQUALS(t_2x2.GetValue(5.0, 2.0), 0.5);
   }
 
+  void testGetValueLargeTable() {
+    FGTable t(40, 30);
+    for (unsigned int c=0; c<30; ++c)
+      t << 0.5*c*c - 10.0;
+    for (unsigned int r=0; r<40; ++r) {
+      t << 0.2*r*r - 5.0;
+      for (unsigned int c=0; c<30; ++c)
+        t << (r+1.0)*(c-14.5);
+    }
+
+    // The result must not depend on the breakpoints found by the previous
+    // lookups: compare with a fresh copy of the table.
+    double colKey = -12.0;
+    for (double rowKey=-6.0; rowKey <= 320.0; rowKey += 0.53) {
+      FGTable fresh(t);
+      TS_ASSERT_EQUALS(t.GetValue(rowKey, colKey), fresh.GetValue(rowKey, colKey));
+      colKey += 1.7;
+    }
+    for (double rowKey=320.0; rowKey >= -6.0; rowKey -= 0.49) {
+      FGTable fresh(t);
+      TS_ASSERT_EQUALS(t.GetValue(rowKey, colKey), fresh.GetValue(rowKey, colKey));
+      colKey -= 1.9;
+    }
+    for (unsigned int i=0; i<40; ++i) {
+      unsigned int r = (i*17)%40, c = (i*13)%30;
+      double rowKey = 0.2*r*r - 5.0, colKey = 0.5*c*c - 10.0;
+      FGTable fresh(t);
+      TS_ASSERT_EQUALS(t.GetValue(rowKey, colKey), (r+1.0)*(c-14.5));
+      TS_ASSERT_EQUALS(t.GetValue(rowKey+0.1, colKey-0.1),
+                       fresh.GetValue(rowKey+0.1, colKey-0.1));
+    }
+  }
+
+  void testGetValues() {
+    FGTable t(20, 10);
+    for (unsigned int c=0; c<10; ++c)
+      t << 0.5*c*c - 10.0;
+    for (unsigned int r=0; r<20; ++r) {
+      t << 0.2*r*r - 5.0;
+      for (unsigned int c=0; c<10; ++c)
+        t << (r+1.0)*(c-4.5);
+    }
+
+    std::vector<double> rowKeys, colKeys, results(103);
+    for (unsigned int i=0; i<103; ++i) {
+      rowKeys.push_back(-6.0 + 0.8*i - 0.004*i*i);
+      colKeys.push_back(35.0 - 0.9*i + 0.01*i*i);
+    }
+
+    t.GetValues(rowKeys.data(), colKeys.data(), results.data(), rowKeys.size());
+    for (unsigned int i=0; i<rowKeys.size(); ++i)
+      TS_ASSERT_EQUALS(results[i], t.GetValue(rowKeys[i], colKeys[i]));
+
+    // Single row table
+    FGTable t_1x3(1, 3);
+    t_1x3 << 0.0 << 1.0 << 2.0
+          << 1.0 << 3.0 << -1.0 << 2.0;
+    t_1x3.GetValues(rowKeys.data(), colKeys.data(), results.data(), 7);
+    for (unsigned int i=0; i<7; ++i)
+      TS_ASSERT_EQUALS(results[i], t_1x3.GetValue(rowKeys[i], colKeys[i]));
+  }
+
   void testLookupProperty() {
     auto pm = make_shared<FGPropertyManager>();
     auto row = pm->GetNode("x", true);
@@ -1364,6 +1490,42 @@ public:
     // `ref` was destroyed.
     TS_ASSERT_EQUALS(output->getDoubleValue(), 0.3125);
   }
+
+  void testGetValues() {
+    auto pm = make_shared<FGPropertyManager>();
+    // FGTable expects <table> to be the child of another XML element, hence the
+    // <dummy> element.
+    Element_ptr elm = readFromXML("<dummy>"
+                                  "  <table>"
+                                  "    <independentVar lookup=\"row\">x</independentVar>"
+                                  "    <independentVar lookup=\"column\">y</independentVar>"
+                                  "    <independentVar lookup=\"table\">z</independentVar>"
+                                  "    <tableData breakPoint=\"-1.0\">"
+                                  "            0.0  1.0\n"
+                                  "      2.0   3.0 -2.0\n"
+                                  "      4.0  -1.0  0.5\n"
+                                  "    </tableData>"
+                                  "    <tableData breakPoint=\"0.5\">"
+                                  "            0.5  1.5  2.5\n"
+                                  "      2.5   3.5 -2.5  1.0\n"
+                                  "    </tableData>"
+                                  "  </table>"
+                                  "</dummy>");
+    Element* el_table = elm->FindElement("table");
+    FGTable t(pm, el_table);
+
+    std::vector<double> rowKeys, colKeys, tableKeys, results(11);
+    for (unsigned int i=0; i<11; ++i) {
+      rowKeys.push_back(1.5 + 0.3*i);
+      colKeys.push_back(2.7 - 0.25*i);
+      tableKeys.push_back(-1.2 + 0.2*i);
+    }
+
+    t.GetValues(rowKeys.data(), colKeys.data(), tableKeys.data(), results.data(),
+                rowKeys.size());
+    for (unsigned int i=0; i<rowKeys.size(); ++i)
+      TS_ASSERT_EQUALS(results[i], t.GetValue(rowKeys[i], colKeys[i], tableKeys[i]));
+  }
 };
 
 
@@ -1526,6 +1688,14 @@ public:
     TS_ASSERT_THROWS(t << 1.0, BaseException&);
   }
 
+  void test1DTooManyElements() {
+    FGTable t(2);
+    t << 1.0 << -1.0
+      << 2.0 << 1.5;
+    TS_ASSERT_THROWS(t << 3.0, BaseException&);
+    TS_ASSERT_EQUALS(t.GetValue(1.5), 0.25);
+  }
+
   void test1DMissingLookupAxis() {
     auto pm = make_shared<FGPropertyManager>();
     // FGTable expects <table> to be the child of another XML element, hence the
@@ -1720,6 +1890,14 @@ public:
     TS_ASSERT_THROWS(t << 0.9, BaseException&);
   }
 
+  void test2DTooManyElements() {
+    FGTable t(1,2);
+    t << 1.0 << 2.0
+      << 1.0 << -1.0 << -2.5;
+    TS_ASSERT_THROWS(t << 0.9, BaseException&);
+    TS_ASSERT_EQUALS(t.GetValue(1.0, 1.5), -1.75);
+  }
+
   void testXMLRowsNotIncreasing() {
     auto pm = make_shared<FGPropertyManager>();
     // FGTable expects <table> to be the child of another XML element, hence the
@@ -0,0 +1,91 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cxxtest/TestSuite.h>
+
+#include <FGFDMExec.h>
+#include <initialization/FGTrimAnalysis.h>
+#include <initialization/FGTrimMap.h>
+#include <models/FGAuxiliary.h>
+#include "TestUtilities.h"
+
+using namespace JSBSim;
+
+// Longitudinal trim map of the c172 over 2 airspeeds.
+const char* trim_map_spec =
+  "<trim_map mode=\"longitudinal\">\n"
+  "  <script file=\"scripts/c1722.xml\"/>\n"
+  "  <axis property=\"ic/vc-kts\"> 80 100 </axis>\n"
+  "  <output file=\"trim_map.csv\"/>\n"
+  "</trim_map>\n";
+
+std::vector<double> SplitValues(const std::string& line)
+{
+  std::vector<double> values;
+  for (const auto& field: SplitFields(line)) values.push_back(std::stod(field));
+  return values;
+}
+
+class FGTrimAnalysisTest : public CxxTest::TestSuite
+{
+public:
+  void testLongitudinal() {
+    auto fdmex = LoadAircraft("c172x", "reset01");
+    TS_ASSERT(fdmex);
+
+    FGTrimAnalysis trim(fdmex.get(), taLongitudinal);
+    TS_ASSERT_EQUALS(trim.GetControls()->size(), 3);
+    TS_ASSERT(trim.DoTrim());
+    TS_ASSERT(!trim.GetTrimFailed());
+    TS_ASSERT(trim.GetIterations() > 0);
+    TS_ASSERT(trim.GetEvaluations() > trim.GetIterations());
+    TS_ASSERT_LESS_THAN(trim.GetCostFunctionValue(), trim.GetTolerance());
+
+    // The aircraft is left at the trim with the airspeed of the initial
+    // conditions.
+    auto Auxiliary = fdmex->GetAuxiliary();
+    TS_ASSERT_DELTA(Auxiliary->GetVt(), fdmex->GetIC()->GetVtrueFpsIC(), 1E-6);
+    TS_ASSERT_LESS_THAN(0.0, Auxiliary->Getalpha());
+  }
+
+  void testUnsupportedMode() {
+    auto fdmex = LoadAircraft("c172x", "reset01");
+    TS_ASSERT(fdmex);
+
+    FGTrimAnalysis trim(fdmex.get(), taGround);
+    TS_ASSERT(!trim.DoTrim());
+    TS_ASSERT(trim.GetTrimFailed());
+  }
+
+  void testMap() {
+    auto lines = SplitLines(RunOnThreads<FGTrimMap>(trim_map_spec,
+                                                    "trim_map.csv"));
+
+    TS_ASSERT_EQUALS(lines.size(), 3);
+    TS_ASSERT_EQUALS(lines[0].substr(0, 19), "ic/vc-kts, success,");
+
+    std::vector<double> slow = SplitValues(lines[1]);
+    std::vector<double> fast = SplitValues(lines[2]);
+    TS_ASSERT_EQUALS(slow.size(), 13);
+    TS_ASSERT_EQUALS(slow[0], 80.0);
+    TS_ASSERT_EQUALS(slow[1], 1.0);
+    TS_ASSERT_EQUALS(fast[1], 1.0);
+
+    // The faster the aircraft flies, the lower its angle of attack and the
+    // higher its throttle.
+    TS_ASSERT_LESS_THAN(fast[7], slow[7]);
+    TS_ASSERT_LESS_THAN(slow[3], fast[3]);
+    TS_ASSERT_LESS_THAN(0.0, slow[12]);
+  }
+
+  void testInvalidSpecification() {
+    TS_ASSERT(LoadSpecification<FGTrimMap>(trim_map_spec));
+    TS_ASSERT(!LoadSpecification<FGTrimMap>(
+      "<trim_map mode=\"ground\">\n"
+      "  <script file=\"scripts/c1722.xml\"/>\n"
+      "  <axis property=\"ic/vc-kts\"> 80 </axis>\n"
+      "  <output file=\"trim_map.csv\"/>\n"
+      "</trim_map>\n"));
+  }
+};
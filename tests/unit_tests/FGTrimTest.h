@@ -0,0 +1,113 @@
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cxxtest/TestSuite.h>
+
+#include <FGFDMExec.h>
+#include <initialization/FGTrim.h>
+#include <initialization/FGSimplexTrim.h>
+#include "TestUtilities.h"
+
+using namespace JSBSim;
+
+class FGTrimTest : public CxxTest::TestSuite
+{
+public:
+  // Both solvers trim the aircraft to the same controls but the Newton solver
+  // runs the model less often.
+  void CheckSolvers(const std::string& model, const std::string& ic,
+                    TrimMode mode)
+  {
+    std::vector<double> controls[2];
+    unsigned int runs[2];
+    const TrimSolver solvers[2] = {tAxisByAxis, tNewton};
+
+    for (unsigned int i=0; i<2; ++i) {
+      auto fdmex = LoadAircraft(model, ic);
+      TS_ASSERT(fdmex);
+      FGTrim trim(fdmex.get(), mode);
+      trim.SetSolver(solvers[i]);
+      TS_ASSERT(trim.DoTrim());
+      controls[i] = trim.GetControls();
+      runs[i] = trim.GetModelRuns();
+      TS_ASSERT(trim.GetIterations() > 0);
+    }
+
+    TS_ASSERT_EQUALS(controls[0].size(), controls[1].size());
+    for (unsigned int i=0; i<controls[0].size(); ++i)
+      TS_ASSERT_DELTA(controls[0][i], controls[1][i], 1E-2);
+    TS_ASSERT_LESS_THAN(runs[1], runs[0]);
+  }
+
+  void testLongitudinal() {
+    CheckSolvers("c172x", "reset01", tLongitudinal);
+  }
+
+  void testFull() {
+    CheckSolvers("c172x", "reset01", tFull);
+  }
+
+  // The c172 cannot fly level at 250 kts: the controls reach their limits
+  // and the Newton solver stops without trimming the aircraft.
+  void testSaturatedControls() {
+    auto fdmex = LoadAircraft("c172x", "reset01");
+    TS_ASSERT(fdmex);
+    auto ic = fdmex->GetIC();
+    ic->SetVtrueKtsIC(250.0);
+    TS_ASSERT(fdmex->RunIC());
+
+    FGTrim trim(fdmex.get(), tLongitudinal);
+    trim.SetSolver(tNewton);
+    trim.SetMaxCycles(100);
+    TS_ASSERT(!trim.DoTrim());
+    TS_ASSERT_LESS_THAN(trim.GetIterations(), 100);
+    for (double control: trim.GetControls())
+      TS_ASSERT(std::isfinite(control));
+  }
+
+  void testSimplex() {
+    auto fdmex = LoadAircraft("c172x", "reset01");
+    TS_ASSERT(fdmex);
+    auto alpha = fdmex->GetPropertyManager()->GetNode("aero/alpha-rad");
+    FGTrim trim(fdmex.get(), tFull);
+    TS_ASSERT(trim.DoTrim());
+    double alpha0 = alpha->getDoubleValue();
+
+    // The random perturbations of the simplex are seeded so the trims are
+    // repeatable.
+    double cost[2];
+    unsigned int runs[2];
+    for (unsigned int i=0; i<2; ++i) {
+      fdmex = LoadAircraft("c172x", "reset01");
+      TS_ASSERT(fdmex);
+      alpha = fdmex->GetPropertyManager()->GetNode("aero/alpha-rad");
+      FGSimplexTrim simplex(fdmex.get(), tFull);
+      TS_ASSERT(simplex.GetSuccess());
+      TS_ASSERT(simplex.GetIterations() > 0);
+      TS_ASSERT_DELTA(alpha->getDoubleValue(), alpha0, 1E-3);
+      cost[i] = simplex.GetCost();
+      runs[i] = simplex.GetModelRuns();
+    }
+    TS_ASSERT_EQUALS(cost[0], cost[1]);
+    TS_ASSERT_EQUALS(runs[0], runs[1]);
+
+    fdmex = LoadAircraft("c172x", "reset01");
+    TS_ASSERT(fdmex);
+    auto pm = fdmex->GetPropertyManager();
+    pm->GetNode("simulation/do_simplex_trim")->setIntValue(tFull);
+    TS_ASSERT_EQUALS(pm->GetNode("simulation/trim-completed")->getIntValue(), 1);
+  }
+
+  void testSolverProperty() {
+    auto fdmex = LoadAircraft("c172x", "reset01");
+    TS_ASSERT(fdmex);
+    auto pm = fdmex->GetPropertyManager();
+    TS_ASSERT_EQUALS(fdmex->GetTrimSolver(), tAxisByAxis);
+    pm->GetNode("simulation/trim-solver")->setIntValue(tNewton);
+    TS_ASSERT_EQUALS(fdmex->GetTrimSolver(), tNewton);
+    pm->GetNode("simulation/do_simple_trim")->setIntValue(tLongitudinal);
+    TS_ASSERT_EQUALS(pm->GetNode("simulation/trim-completed")->getIntValue(), 1);
+  }
+};
@@ -1,3 +1,16 @@
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <cxxtest/TestSuite.h>
+
+#include <FGFDMExec.h>
+#include <initialization/FGInitialCondition.h>
 #include <input_output/FGXMLParse.h>
 
 JSBSim::Element_ptr readFromXML(const std::string& XML) {
@@ -6,3 +19,157 @@ JSBSim::Element_ptr readFromXML(const std::string& XML) {
   readXML(data, parser);
   return parser.GetDocument();
 }
+
+// Writes an XML document to the file file_name.
+inline void WriteXMLFile(const std::string& file_name, const std::string& XML) {
+  std::ofstream file(file_name);
+  file << "<?xml version=\"1.0\"?>" << std::endl << XML;
+}
+
+// Returns the content of a file.
+inline std::string ReadFile(const std::string& file_name) {
+  std::ifstream file(file_name, std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(file),
+                     std::istreambuf_iterator<char>());
+}
+
+// Returns the lines of a text.
+inline std::vector<std::string> SplitLines(const std::string& text) {
+  std::istringstream stream(text);
+  std::vector<std::string> lines;
+  std::string line;
+
+  while (std::getline(stream, line))
+    lines.push_back(line);
+
+  return lines;
+}
+
+// Returns the comma separated fields of a line.
+inline std::vector<std::string> SplitFields(const std::string& line) {
+  std::istringstream stream(line);
+  std::vector<std::string> fields;
+  std::string field;
+
+  while (std::getline(stream, field, ','))
+    fields.push_back(field);
+
+  return fields;
+}
+
+#ifdef JSBSIM_TEST_ROOT_DIR
+// Creates a silent instance of FGFDMExec that reads the aircraft, engines,
+// systems and scripts of the repository.
+inline std::unique_ptr<JSBSim::FGFDMExec> CreateExec(void) {
+  std::unique_ptr<JSBSim::FGFDMExec> fdmex(new JSBSim::FGFDMExec);
+  fdmex->SetDebugLevel(0);
+  fdmex->SetRootDir(SGPath(JSBSIM_TEST_ROOT_DIR));
+  fdmex->SetAircraftPath(SGPath("aircraft"));
+  fdmex->SetEnginePath(SGPath("engine"));
+  fdmex->SetSystemsPath(SGPath("systems"));
+  return fdmex;
+}
+
+// Loads the aircraft at the initial conditions ic with its engines running.
+inline std::unique_ptr<JSBSim::FGFDMExec> LoadAircraft(const std::string& model,
+                                                       const std::string& ic) {
+  auto fdmex = CreateExec();
+  if (!fdmex->LoadModel(model)) return nullptr;
+  if (!fdmex->GetIC()->Load(SGPath(ic))) return nullptr;
+  if (!fdmex->RunIC()) return nullptr;
+  fdmex->GetPropertyManager()->GetNode("propulsion/set-running")->setIntValue(-1);
+  return fdmex;
+}
+
+// Loads a script of the repository with its output written to the file
+// output, then runs its initial conditions.
+inline std::unique_ptr<JSBSim::FGFDMExec> LoadScript(const std::string& script,
+                                                     const std::string& output) {
+  auto fdmex = CreateExec();
+  if (!fdmex->LoadScript(SGPath("scripts/"+script+".xml"))) return nullptr;
+  fdmex->SetOutputFileName(0, output);
+  if (!fdmex->RunIC()) return nullptr;
+  return fdmex;
+}
+
+// The properties recorded by RunFrames().
+const char* const recorded_properties[] = {
+  "position/h-sl-ft", "position/lat-geod-rad", "position/long-gc-rad",
+  "attitude/phi-rad", "attitude/theta-rad", "attitude/psi-rad",
+  "velocities/u-fps", "velocities/v-fps", "velocities/w-fps",
+  "velocities/p-rad_sec", "velocities/q-rad_sec", "velocities/r-rad_sec",
+  "fcs/elevator-pos-rad", "propulsion/engine/thrust-lbs",
+  "propulsion/total-fuel-lbs", "forces/fbz-gear-lbs", "simulation/sim-time-sec"
+};
+
+// Runs a number of frames and returns the values of the recorded properties
+// at each frame. The recording is empty if a property does not exist.
+inline std::vector<double> RunFrames(JSBSim::FGFDMExec* fdmex, int frames) {
+  auto pm = fdmex->GetPropertyManager();
+  std::vector<JSBSim::FGPropertyNode*> nodes;
+  std::vector<double> values;
+
+  for (auto name: recorded_properties) {
+    nodes.push_back(pm->GetNode(name));
+    if (!nodes.back()) return values;
+  }
+
+  values.reserve(frames*nodes.size());
+  for (int i=0; i<frames && fdmex->Run(); ++i) {
+    for (auto node: nodes)
+      values.push_back(node->getDoubleValue());
+  }
+
+  return values;
+}
+
+// Checks that two recordings of RunFrames() are the same bit for bit.
+inline void AssertSameRecording(const std::vector<double>& values,
+                                const std::vector<double>& ref) {
+  TS_ASSERT(!ref.empty());
+  TS_ASSERT_EQUALS(values.size(), ref.size());
+  if (values.size() == ref.size())
+    TS_ASSERT_EQUALS(memcmp(values.data(), ref.data(),
+                            ref.size()*sizeof(double)), 0);
+}
+
+// Writes the specification XML of a batch analysis (see FGBatchPool) to a
+// file and returns whether the analysis accepts it.
+template<class Analysis>
+bool LoadSpecification(const std::string& XML) {
+  const char* spec_name = "analysis_spec.xml";
+  WriteXMLFile(spec_name, XML);
+
+  Analysis analysis;
+  analysis.SetRootDir(SGPath(JSBSIM_TEST_ROOT_DIR));
+  bool result = analysis.Load(SGPath(spec_name));
+  remove(spec_name);
+  return result;
+}
+
+// Runs the batch analysis of the specification XML with 1 and with 3 worker
+// threads, checks that both runs write the same output file output_name and
+// returns its content. The specification file and the output are removed.
+template<class Analysis>
+std::string RunOnThreads(const std::string& XML, const std::string& output_name) {
+  const char* spec_name = "analysis_spec.xml";
+  const unsigned int threads[] = {1, 3};
+  std::string outputs[2];
+
+  WriteXMLFile(spec_name, XML);
+  for (unsigned int i=0; i<2; ++i) {
+    Analysis analysis;
+    analysis.SetRootDir(SGPath(JSBSIM_TEST_ROOT_DIR));
+    TS_ASSERT(analysis.Load(SGPath(spec_name)));
+    analysis.SetNumThreads(threads[i]);
+    TS_ASSERT(analysis.Run());
+    outputs[i] = ReadFile(output_name);
+    remove(output_name.c_str());
+  }
+  remove(spec_name);
+
+  TS_ASSERT(!outputs[0].empty());
+  TS_ASSERT(outputs[0] == outputs[1]);
+  return outputs[0];
+}
+#endif